@@ -4,6 +4,8 @@
 #include <toolbox/stream/stream.h>
 #include "../minunit.h"
 
+#define TAG "FlipperFormatTest"
+
 #define TEST_DIR TEST_DIR_NAME "/"
 #define TEST_DIR_NAME EXT_PATH("unit_tests_tmp")
 
@@ -456,6 +458,163 @@ static bool test_read_multikey(const char* file_name) {
     return result;
 }
 
+static bool test_read_multikey_indexed(const char* file_name) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool result = false;
+    FlipperFormat* file = flipper_format_file_alloc(storage);
+    flipper_format_set_key_index(file, true);
+
+    FuriString* string_value;
+    string_value = furi_string_alloc();
+    uint32_t uint32_value;
+
+    do {
+        if(!flipper_format_file_open_existing(file, file_name)) break;
+        if(!flipper_format_read_header(file, string_value, &uint32_value)) break;
+        if(furi_string_cmp_str(string_value, test_filetype) != 0) break;
+        if(uint32_value != test_version) break;
+
+        bool error = false;
+        uint8_t uint8_value;
+        for(uint8_t index = 0; index < 100; index++) {
+            if(!flipper_format_read_hex(file, test_hex_key, &uint8_value, 1) ||
+               uint8_value != index) {
+                error = true;
+                break;
+            }
+        }
+        if(error) break;
+
+        // all occurrences are consumed
+        if(flipper_format_read_hex(file, test_hex_key, &uint8_value, 1)) break;
+        if(!flipper_format_key_exist(file, "Version")) break;
+        if(flipper_format_key_exist(file, test_string_key)) break;
+
+        // random access by occurrence
+        if(!flipper_format_seek_to_nth_key(file, test_hex_key, 42)) break;
+        if(!flipper_format_read_hex(file, test_hex_key, &uint8_value, 1)) break;
+        if(uint8_value != 42) break;
+        if(!flipper_format_read_hex(file, test_hex_key, &uint8_value, 1)) break;
+        if(uint8_value != 43) break;
+        if(flipper_format_seek_to_nth_key(file, test_hex_key, 100)) break;
+
+        // writes drop the index
+        uint8_value = 0xAA;
+        if(!flipper_format_update_hex(file, test_hex_key, &uint8_value, 1)) break;
+        if(!flipper_format_rewind(file)) break;
+        if(!flipper_format_read_hex(file, test_hex_key, &uint8_value, 1)) break;
+        if(uint8_value != 0xAA) break;
+        if(!flipper_format_read_hex(file, test_hex_key, &uint8_value, 1)) break;
+        if(uint8_value != 1) break;
+
+        result = true;
+    } while(false);
+
+    furi_string_free(string_value);
+
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
+#define ARRAY_TEST_KEY "RAW_Data"
+#define ARRAY_TEST_VALUE_COUNT (2048U)
+#define ARRAY_TEST_LINE_COUNT (8U)
+
+static int32_t test_array_value(size_t index) {
+    // mix of signs and lengths, so tokens cross stream cache boundaries at random places
+    int32_t value = (int32_t)((index * 2654435761U) % 100000U);
+    return (index & 1) ? -value : value;
+}
+
+static bool test_write_array(const char* file_name) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* file = flipper_format_buffered_file_alloc(storage);
+    int32_t* values = malloc(sizeof(int32_t) * ARRAY_TEST_VALUE_COUNT);
+    bool result = false;
+
+    for(size_t i = 0; i < ARRAY_TEST_VALUE_COUNT; i++) {
+        values[i] = test_array_value(i);
+    }
+
+    do {
+        if(!flipper_format_buffered_file_open_always(file, file_name)) break;
+        if(!flipper_format_write_header_cstr(file, test_filetype, test_version)) break;
+
+        bool error = false;
+        for(size_t line = 0; line < ARRAY_TEST_LINE_COUNT; line++) {
+            if(!flipper_format_write_int32(
+                   file, ARRAY_TEST_KEY, values, ARRAY_TEST_VALUE_COUNT)) {
+                error = true;
+                break;
+            }
+        }
+        if(error) break;
+
+        result = true;
+    } while(false);
+
+    free(values);
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
+static bool test_read_array(const char* file_name, bool buffered) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* file = buffered ? flipper_format_buffered_file_alloc(storage) :
+                                     flipper_format_file_alloc(storage);
+    int32_t* values = malloc(sizeof(int32_t) * ARRAY_TEST_VALUE_COUNT);
+    FuriString* string_value = furi_string_alloc();
+    uint32_t uint32_value;
+    bool result = false;
+
+    const uint32_t start = furi_get_tick();
+
+    do {
+        if(!(buffered ? flipper_format_buffered_file_open_existing(file, file_name) :
+                        flipper_format_file_open_existing(file, file_name)))
+            break;
+        if(!flipper_format_read_header(file, string_value, &uint32_value)) break;
+
+        bool error = false;
+        for(size_t line = 0; line < ARRAY_TEST_LINE_COUNT && !error; line++) {
+            if(!flipper_format_get_value_count(file, ARRAY_TEST_KEY, &uint32_value) ||
+               uint32_value != ARRAY_TEST_VALUE_COUNT ||
+               !flipper_format_read_int32(file, ARRAY_TEST_KEY, values, uint32_value)) {
+                error = true;
+                break;
+            }
+
+            for(size_t i = 0; i < ARRAY_TEST_VALUE_COUNT; i++) {
+                if(values[i] != test_array_value(i)) {
+                    error = true;
+                    break;
+                }
+            }
+        }
+        if(error) break;
+
+        result = true;
+    } while(false);
+
+    FURI_LOG_I(
+        TAG,
+        "%s stream: %u values parsed in %lu ms",
+        buffered ? "Buffered file" : "File",
+        ARRAY_TEST_VALUE_COUNT * ARRAY_TEST_LINE_COUNT,
+        furi_get_tick() - start);
+
+    furi_string_free(string_value);
+    free(values);
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
 MU_TEST(flipper_format_write_test) {
     mu_assert(storage_write_string(test_file_linux, test_data_nix), "Write test error [Linux]");
     mu_assert(
@@ -522,6 +681,17 @@ MU_TEST(flipper_format_multikey_test) {
     mu_assert(test_read_multikey(TEST_DIR "ff_multiline.test"), "Multikey read test error");
 }
 
+MU_TEST(flipper_format_key_index_test) {
+    mu_assert(test_write_multikey(TEST_DIR "ff_indexed.test"), "Key index write test error");
+    mu_assert(test_read_multikey_indexed(TEST_DIR "ff_indexed.test"), "Key index read test error");
+}
+
+MU_TEST(flipper_format_array_test) {
+    mu_assert(test_write_array(TEST_DIR "ff_array.test"), "Array write test error");
+    mu_assert(test_read_array(TEST_DIR "ff_array.test", true), "Array read test error [Buffered]");
+    mu_assert(test_read_array(TEST_DIR "ff_array.test", false), "Array read test error [File]");
+}
+
 MU_TEST(flipper_format_oddities_test) {
     mu_assert(
         storage_write_string(test_file_oddities, test_data_odd), "Write test error [Oddities]");
@@ -541,6 +711,8 @@ MU_TEST_SUITE(flipper_format) {
     MU_RUN_TEST(flipper_format_update_2_test);
     MU_RUN_TEST(flipper_format_update_2_result_test);
     MU_RUN_TEST(flipper_format_multikey_test);
+    MU_RUN_TEST(flipper_format_key_index_test);
+    MU_RUN_TEST(flipper_format_array_test);
     MU_RUN_TEST(flipper_format_oddities_test);
     tests_teardown();
 }
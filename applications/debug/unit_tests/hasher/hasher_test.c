@@ -0,0 +1,177 @@
+#include <furi.h>
+#include <storage/storage.h>
+#include <toolbox/crc32_calc.h>
+#include <toolbox/hasher.h>
+
+#include "../minunit.h"
+
+#define TAG "HasherTest"
+
+#define HASHER_TEST_FILE EXT_PATH("unit_tests/hasher.test")
+#define HASHER_TEST_DATA_SIZE (10000U)
+#define HASHER_TEST_DATA_CRC32 (0x38E68819UL)
+#define HASHER_TEST_BENCH_SIZE (16 * 1024U)
+#define HASHER_TEST_BENCH_ROUNDS (64U)
+
+static const uint8_t hasher_test_data_md5[HASHER_MD5_SIZE] = {
+    0x7a, 0xa1, 0x68, 0xc7, 0xcc, 0xb7, 0x10, 0x34,
+    0xc8, 0x46, 0x62, 0xc1, 0xf5, 0x64, 0x56, 0xe1};
+
+static const uint8_t hasher_test_fox_md5[HASHER_MD5_SIZE] = {
+    0x9e, 0x10, 0x7d, 0x9d, 0x37, 0x2b, 0xb6, 0x82,
+    0x6b, 0xd8, 0x1d, 0x35, 0x42, 0xa4, 0x19, 0xd6};
+
+static const char* hasher_test_fox = "The quick brown fox jumps over the lazy dog";
+
+static uint8_t* hasher_test_data_alloc(size_t size) {
+    uint8_t* data = malloc(size);
+    for(size_t i = 0; i < size; i++) {
+        data[i] = i * 31 + 7;
+    }
+    return data;
+}
+
+MU_TEST(hasher_crc32_vectors) {
+    mu_assert_int_eq(0, crc32_calc_buffer(0, NULL, 0));
+    mu_assert_int_eq(0xCBF43926, crc32_calc_buffer(0, "123456789", 9));
+    mu_assert_int_eq(0xCBF43926, crc32_calc_buffer_soft(0, "123456789", 9));
+    mu_assert_int_eq(
+        0x414FA339, crc32_calc_buffer(0, hasher_test_fox, strlen(hasher_test_fox)));
+
+    uint8_t* data = hasher_test_data_alloc(HASHER_TEST_DATA_SIZE);
+    mu_assert_int_eq(HASHER_TEST_DATA_CRC32, crc32_calc_buffer(0, data, HASHER_TEST_DATA_SIZE));
+    mu_assert_int_eq(
+        HASHER_TEST_DATA_CRC32, crc32_calc_buffer_soft(0, data, HASHER_TEST_DATA_SIZE));
+
+    // every alignment and split, hardware and software must agree
+    for(size_t offset = 0; offset < 8; offset++) {
+        const size_t size = 1000 + offset;
+        const uint32_t expected = crc32_calc_buffer_soft(0, data + offset, size);
+        for(size_t split = 0; split < size; split += 97) {
+            uint32_t crc = crc32_calc_buffer(0, data + offset, split);
+            crc = crc32_calc_buffer(crc, data + offset + split, size - split);
+            mu_assert_int_eq(expected, crc);
+        }
+    }
+
+    free(data);
+}
+
+MU_TEST(hasher_md5_vectors) {
+    const uint8_t empty_md5[HASHER_MD5_SIZE] = {
+        0xd4, 0x1d, 0x8c, 0xd9, 0x8f, 0x00, 0xb2, 0x04,
+        0xe9, 0x80, 0x09, 0x98, 0xec, 0xf8, 0x42, 0x7e};
+    uint8_t md5[HASHER_MD5_SIZE];
+    Hasher* hasher = hasher_alloc(HasherTypeMd5);
+
+    hasher_get_md5(hasher, md5);
+    mu_assert_mem_eq(empty_md5, md5, HASHER_MD5_SIZE);
+
+    hasher_reset(hasher);
+    hasher_update(hasher, hasher_test_fox, 10);
+    hasher_update(hasher, hasher_test_fox + 10, strlen(hasher_test_fox) - 10);
+    hasher_get_md5(hasher, md5);
+    mu_assert_mem_eq(hasher_test_fox_md5, md5, HASHER_MD5_SIZE);
+
+    hasher_free(hasher);
+}
+
+MU_TEST(hasher_file_one_pass) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    uint8_t* data = hasher_test_data_alloc(HASHER_TEST_DATA_SIZE);
+
+    mu_check(storage_file_open(file, HASHER_TEST_FILE, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    mu_assert_int_eq(
+        HASHER_TEST_DATA_SIZE, storage_file_write(file, data, HASHER_TEST_DATA_SIZE));
+    mu_check(storage_file_seek(file, 0, true));
+
+    Hasher* hasher = hasher_alloc(HasherTypeCrc32 | HasherTypeMd5);
+    uint8_t md5[HASHER_MD5_SIZE];
+    mu_check(hasher_update_file(hasher, file, NULL, NULL));
+    mu_assert_int_eq(HASHER_TEST_DATA_SIZE, hasher_get_size(hasher));
+    mu_assert_int_eq(HASHER_TEST_DATA_CRC32, hasher_get_crc32(hasher));
+    hasher_get_md5(hasher, md5);
+    mu_assert_mem_eq(hasher_test_data_md5, md5, HASHER_MD5_SIZE);
+    hasher_free(hasher);
+
+    // legacy helper goes the same way
+    mu_assert_int_eq(HASHER_TEST_DATA_CRC32, crc32_calc_file(file, NULL, NULL));
+
+    storage_file_close(file);
+    mu_check(storage_simply_remove(storage, HASHER_TEST_FILE));
+
+    free(data);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
+static void hasher_bench_report(const char* name, uint32_t ticks) {
+    const uint32_t bytes = HASHER_TEST_BENCH_SIZE * HASHER_TEST_BENCH_ROUNDS;
+    const uint32_t ms = furi_kernel_get_tick_frequency() ?
+                            ticks * 1000 / furi_kernel_get_tick_frequency() :
+                            ticks;
+    FURI_LOG_I(
+        TAG,
+        "%s: %lu KiB in %lu ms, %lu.%02lu MB/s",
+        name,
+        bytes / 1024,
+        ms,
+        ms ? (bytes / 1000 / ms) : 0,
+        ms ? ((bytes / 10 / ms) % 100) : 0);
+}
+
+MU_TEST(hasher_benchmark) {
+    uint8_t* data = hasher_test_data_alloc(HASHER_TEST_BENCH_SIZE);
+    uint8_t md5[HASHER_MD5_SIZE];
+    uint32_t crc = 0;
+    uint32_t start;
+
+    start = furi_get_tick();
+    for(size_t i = 0; i < HASHER_TEST_BENCH_ROUNDS; i++) {
+        crc = crc32_calc_buffer_soft(crc, data, HASHER_TEST_BENCH_SIZE);
+    }
+    hasher_bench_report("CRC32 slice-by-8", furi_get_tick() - start);
+    const uint32_t crc_soft = crc;
+
+    crc = 0;
+    start = furi_get_tick();
+    for(size_t i = 0; i < HASHER_TEST_BENCH_ROUNDS; i++) {
+        crc = crc32_calc_buffer(crc, data, HASHER_TEST_BENCH_SIZE);
+    }
+    hasher_bench_report("CRC32", furi_get_tick() - start);
+    mu_assert_int_eq(crc_soft, crc);
+
+    Hasher* hasher = hasher_alloc(HasherTypeMd5);
+    start = furi_get_tick();
+    for(size_t i = 0; i < HASHER_TEST_BENCH_ROUNDS; i++) {
+        hasher_update(hasher, data, HASHER_TEST_BENCH_SIZE);
+    }
+    hasher_get_md5(hasher, md5);
+    hasher_bench_report("MD5", furi_get_tick() - start);
+    hasher_free(hasher);
+
+    hasher = hasher_alloc(HasherTypeCrc32 | HasherTypeMd5);
+    start = furi_get_tick();
+    for(size_t i = 0; i < HASHER_TEST_BENCH_ROUNDS; i++) {
+        hasher_update(hasher, data, HASHER_TEST_BENCH_SIZE);
+    }
+    hasher_get_md5(hasher, md5);
+    hasher_bench_report("CRC32 + MD5", furi_get_tick() - start);
+    mu_assert_int_eq(crc_soft, hasher_get_crc32(hasher));
+    hasher_free(hasher);
+
+    free(data);
+}
+
+MU_TEST_SUITE(hasher) {
+    MU_RUN_TEST(hasher_crc32_vectors);
+    MU_RUN_TEST(hasher_md5_vectors);
+    MU_RUN_TEST(hasher_file_one_pass);
+    MU_RUN_TEST(hasher_benchmark);
+}
+
+int run_minunit_test_hasher() {
+    MU_RUN_SUITE(hasher);
+    return MU_EXIT_CODE;
+}
@@ -64,9 +64,84 @@ MU_TEST(manifest_iteration_test) {
     mu_assert(result, "Manifest forward iterate failed\r\n");
 }
 
+#define MANIFEST_DIFF_DIR EXT_PATH("unit_tests/manifest_diff")
+#define MANIFEST_DIFF_OLD MANIFEST_DIFF_DIR "/Manifest"
+#define MANIFEST_DIFF_NEW MANIFEST_DIFF_DIR "/Manifest.new"
+
+static const char* manifest_diff_old = "V:0\n"
+                                       "T:1672531200\n"
+                                       "D:dir\n"
+                                       "F:00112233445566778899aabbccddeeff:3:dir/same.txt\n"
+                                       "F:00112233445566778899aabbccddeeff:3:dir/changed.txt\n"
+                                       "F:00112233445566778899aabbccddeeff:3:dir/missing.txt\n"
+                                       "F:00112233445566778899aabbccddeeff:3:gone.txt\n"
+                                       "D:gone\n";
+
+static const char* manifest_diff_new = "V:0\n"
+                                       "T:1675209600\n"
+                                       "D:dir\n"
+                                       "F:00112233445566778899aabbccddeeff:3:dir/same.txt\n"
+                                       "F:ffeeddccbbaa99887766554433221100:3:dir/changed.txt\n"
+                                       "F:00112233445566778899aabbccddeeff:3:dir/missing.txt\n"
+                                       "F:00112233445566778899aabbccddeeff:3:added.txt\n";
+
+static void manifest_diff_write(Storage* storage, const char* path, const char* data) {
+    File* file = storage_file_alloc(storage);
+    furi_check(storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS));
+    furi_check(storage_file_write(file, data, strlen(data)) == strlen(data));
+    storage_file_free(file);
+}
+
+MU_TEST(manifest_diff_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_remove_recursive(storage, MANIFEST_DIFF_DIR);
+    mu_check(storage_simply_mkdir(storage, MANIFEST_DIFF_DIR));
+    mu_check(storage_simply_mkdir(storage, MANIFEST_DIFF_DIR "/dir"));
+    manifest_diff_write(storage, MANIFEST_DIFF_OLD, manifest_diff_old);
+    manifest_diff_write(storage, MANIFEST_DIFF_NEW, manifest_diff_new);
+    manifest_diff_write(storage, MANIFEST_DIFF_DIR "/dir/same.txt", "abc");
+    manifest_diff_write(storage, MANIFEST_DIFF_DIR "/dir/changed.txt", "abc");
+    manifest_diff_write(storage, MANIFEST_DIFF_DIR "/gone.txt", "abc");
+
+    mu_check(!resource_manifest_diff_alloc(
+        storage, MANIFEST_DIFF_DIR "/missing", MANIFEST_DIFF_NEW, MANIFEST_DIFF_DIR));
+
+    ResourceManifestDiff* diff = resource_manifest_diff_alloc(
+        storage, MANIFEST_DIFF_OLD, MANIFEST_DIFF_NEW, MANIFEST_DIFF_DIR);
+    mu_check(diff);
+
+    mu_assert_int_eq(1, resource_manifest_diff_get_unchanged_count(diff));
+    mu_check(resource_manifest_diff_is_unchanged(diff, "dir/same.txt"));
+    mu_check(!resource_manifest_diff_is_unchanged(diff, "dir/changed.txt"));
+    mu_check(!resource_manifest_diff_is_unchanged(diff, "dir/missing.txt"));
+    mu_check(!resource_manifest_diff_is_unchanged(diff, "added.txt"));
+
+    ResourceManifestReader* manifest_reader = resource_manifest_reader_alloc(storage);
+    mu_check(resource_manifest_reader_open(manifest_reader, MANIFEST_DIFF_OLD));
+    ResourceManifestEntry* entry_ptr = NULL;
+    size_t removed = 0;
+    while((entry_ptr = resource_manifest_reader_next(manifest_reader))) {
+        if(entry_ptr->type != ResourceManifestEntryTypeFile &&
+           entry_ptr->type != ResourceManifestEntryTypeDirectory) {
+            continue;
+        }
+        const char* name = furi_string_get_cstr(entry_ptr->name);
+        const bool expected = !strcmp(name, "gone.txt") || !strcmp(name, "gone");
+        mu_assert(expected == resource_manifest_diff_is_removed(diff, entry_ptr), name);
+        removed += expected;
+    }
+    mu_assert_int_eq(2, removed);
+    resource_manifest_reader_free(manifest_reader);
+
+    resource_manifest_diff_free(diff);
+    mu_check(storage_simply_remove_recursive(storage, MANIFEST_DIFF_DIR));
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(manifest_suite) {
     MU_RUN_TEST(manifest_type_test);
     MU_RUN_TEST(manifest_iteration_test);
+    MU_RUN_TEST(manifest_diff_test);
 }
 
 int run_minunit_test_manifest() {
@@ -24,6 +24,7 @@
 #include <loader/loader.h>
 #include <storage/filesystem_api_defines.h>
 
+#include <lib/toolbox/compress.h>
 #include <lib/toolbox/md5_calc.h>
 #include <lib/toolbox/path.h>
 
@@ -61,7 +62,7 @@ static RpcSessionContext rpc_session[TEST_RPC_SESSIONS];
 #define TAG "UnitTestsRpc"
 #define MAX_RECEIVE_OUTPUT_TIMEOUT 3000
 #define MAX_NAME_LENGTH 255
-#define MAX_DATA_SIZE 512u // have to be exact as in rpc_storage.c
+#define MAX_DATA_SIZE RPC_STORAGE_TRANSFER_CHUNK_SIZE_DEFAULT
 #define TEST_DIR TEST_DIR_NAME "/"
 #define TEST_DIR_NAME EXT_PATH("unit_tests_tmp")
 #define MD5SUM_SIZE 16
@@ -941,6 +942,108 @@ MU_TEST(test_storage_read) {
     test_storage_read_run(TEST_DIR "file4.txt", ++command_id);
 }
 
+#define TEST_TRANSFER_FILE_SIZE (64 * 1024U)
+
+/* Host side of a transfer: receive the whole file and check it against test_create_file() */
+static void test_storage_read_transfer_run(
+    const char* path,
+    const RpcStorageTransfer* transfer,
+    uint32_t command_id) {
+    rpc_session_set_storage_transfer(rpc_session[0].session, transfer);
+
+    PB_Main request;
+    test_rpc_create_simple_message(&request, PB_Main_storage_read_request_tag, path, command_id);
+
+    pb_istream_t istream = {
+        .callback = test_rpc_pb_stream_read,
+        .state = &rpc_session[0],
+        .errmsg = NULL,
+        .bytes_left = 0x7FFFFFFF,
+    };
+    PB_Main result = {.cb_content.funcs.decode = NULL};
+    Compress* compress = transfer->compress ? compress_alloc(transfer->chunk_size) : NULL;
+    uint8_t* unpacked = malloc(transfer->chunk_size + 8);
+    size_t received = 0;
+    size_t chunks = 0;
+
+    const uint32_t start = furi_get_tick();
+    test_rpc_encode_and_feed_one(&request, 0);
+
+    bool has_next = true;
+    while(has_next) {
+        rpc_session[0].timeout = xTaskGetTickCount() + MAX_RECEIVE_OUTPUT_TIMEOUT;
+        if(!pb_decode_ex(&istream, &PB_Main_msg, &result, PB_DECODE_DELIMITED)) {
+            mu_fail("read response not decoded");
+            break;
+        }
+
+        mu_assert_int_eq(command_id, result.command_id);
+        mu_assert_int_eq(PB_CommandStatus_OK, result.command_status);
+        mu_assert_int_eq(PB_Main_storage_read_response_tag, result.which_content);
+        has_next = result.has_next;
+
+        pb_bytes_array_t* data = result.content.storage_read_response.file.data;
+        uint8_t* chunk = data->bytes;
+        size_t chunk_size = data->size;
+        if(compress) {
+            mu_check(compress_decode(
+                compress, data->bytes, data->size, unpacked, transfer->chunk_size, &chunk_size));
+            chunk = unpacked;
+        }
+        mu_check(chunk_size <= transfer->chunk_size);
+
+        for(size_t i = 0; i < chunk_size; i++) {
+            if(chunk[i] != '0' + (((received + i) % 128) % 10)) {
+                mu_fail("read data mismatch");
+                has_next = false;
+                break;
+            }
+        }
+        received += chunk_size;
+        chunks++;
+        pb_release(&PB_Main_msg, &result);
+    }
+
+    const uint32_t ticks = furi_get_tick() - start;
+    mu_assert_int_eq(TEST_TRANSFER_FILE_SIZE, received);
+    FURI_LOG_I(
+        TAG,
+        "chunk %u, window %u%s: %u messages, %lu ms, %lu KiB/s",
+        transfer->chunk_size,
+        transfer->window,
+        transfer->compress ? ", compressed" : "",
+        chunks,
+        ticks,
+        ticks ? (received * 1000UL / 1024UL / ticks) : 0);
+
+    if(compress) {
+        compress_free(compress);
+    }
+    free(unpacked);
+    pb_release(&PB_Main_msg, &request);
+}
+
+MU_TEST(test_storage_read_transfer) {
+    const RpcStorageTransfer transfers[] = {
+        {.chunk_size = RPC_STORAGE_TRANSFER_CHUNK_SIZE_DEFAULT, .window = 0},
+        {.chunk_size = RPC_STORAGE_TRANSFER_CHUNK_SIZE_DEFAULT,
+         .window = RPC_STORAGE_TRANSFER_WINDOW_DEFAULT},
+        {.chunk_size = 2048, .window = 4},
+        {.chunk_size = 2048, .window = 4, .compress = true},
+    };
+
+    test_create_file(TEST_DIR "transfer.bin", TEST_TRANSFER_FILE_SIZE);
+    for(size_t i = 0; i < COUNT_OF(transfers); i++) {
+        test_storage_read_transfer_run(TEST_DIR "transfer.bin", &transfers[i], ++command_id);
+    }
+
+    const RpcStorageTransfer transfer_default = {
+        .chunk_size = RPC_STORAGE_TRANSFER_CHUNK_SIZE_DEFAULT,
+        .window = RPC_STORAGE_TRANSFER_WINDOW_DEFAULT,
+    };
+    rpc_session_set_storage_transfer(rpc_session[0].session, &transfer_default);
+}
+
 static void test_storage_write_run(
     const char* path,
     size_t write_size,
@@ -1451,6 +1554,7 @@ MU_TEST_SUITE(test_rpc_storage) {
     MU_RUN_TEST(test_storage_stat);
     MU_RUN_TEST(test_storage_list);
     MU_RUN_TEST(test_storage_read);
+    MU_RUN_TEST(test_storage_read_transfer);
     MU_RUN_TEST(test_storage_write_read);
     MU_RUN_TEST(test_storage_write);
     MU_RUN_TEST(test_storage_delete);
@@ -1,10 +1,13 @@
 #include "../minunit.h"
 #include <furi.h>
 #include <storage/storage.h>
+#include <fatfs/diskio_cache.h>
+#include <toolbox/tar/tar_archive.h>
 
 // DO NOT USE THIS IN PRODUCTION CODE
 // This is a hack to access internal storage functions and definitions
 #include <storage/storage_i.h>
+#include <storage/storage_bench.h>
 
 #define UNIT_TESTS_PATH(path) EXT_PATH("unit_tests/" path)
 
@@ -115,10 +118,60 @@ MU_TEST(storage_file_open_close) {
     furi_record_close(RECORD_STORAGE);
 }
 
+#define STORAGE_STAT_CACHE_DIR UNIT_TESTS_PATH("stat_cache")
+#define STORAGE_STAT_CACHE_FILE STORAGE_STAT_CACHE_DIR "/file.test"
+
+MU_TEST(storage_file_stat_cache) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    StorageStatCache* cache = &storage->storage[ST_EXT].stat_cache;
+    FileInfo fileinfo;
+
+    storage_simply_remove_recursive(storage, STORAGE_STAT_CACHE_DIR);
+
+    // negative answers are cached
+    mu_assert_int_eq(FSE_NOT_EXIST, storage_common_stat(storage, STORAGE_STAT_CACHE_DIR, NULL));
+    uint32_t hits = cache->hits;
+    mu_assert_int_eq(FSE_NOT_EXIST, storage_common_stat(storage, STORAGE_STAT_CACHE_DIR, NULL));
+    mu_assert_int_eq(hits + 1, cache->hits);
+
+    // mkdir invalidates
+    mu_assert_int_eq(FSE_OK, storage_common_mkdir(storage, STORAGE_STAT_CACHE_DIR));
+    mu_assert_int_eq(FSE_OK, storage_common_stat(storage, STORAGE_STAT_CACHE_DIR, &fileinfo));
+    mu_check(file_info_is_dir(&fileinfo));
+
+    // file creation and writes invalidate
+    mu_assert_int_eq(FSE_NOT_EXIST, storage_common_stat(storage, STORAGE_STAT_CACHE_FILE, NULL));
+    mu_check(storage_file_create(storage, STORAGE_STAT_CACHE_FILE, "0123"));
+    mu_assert_int_eq(FSE_OK, storage_common_stat(storage, STORAGE_STAT_CACHE_FILE, &fileinfo));
+    mu_assert_int_eq(4, fileinfo.size);
+
+    File* file = storage_file_alloc(storage);
+    mu_check(storage_file_open(file, STORAGE_STAT_CACHE_FILE, FSAM_WRITE, FSOM_OPEN_APPEND));
+    mu_check(storage_file_write(file, "4567", 4) == 4);
+    mu_check(storage_file_close(file));
+    storage_file_free(file);
+    mu_assert_int_eq(FSE_OK, storage_common_stat(storage, STORAGE_STAT_CACHE_FILE, &fileinfo));
+    mu_assert_int_eq(8, fileinfo.size);
+
+    // removal invalidates everything below the path, in any case
+    mu_check(storage_simply_remove_recursive(storage, STORAGE_STAT_CACHE_DIR));
+    mu_assert_int_eq(FSE_NOT_EXIST, storage_common_stat(storage, STORAGE_STAT_CACHE_FILE, NULL));
+    mu_assert_int_eq(FSE_NOT_EXIST, storage_common_stat(storage, STORAGE_STAT_CACHE_DIR, NULL));
+
+    mu_check(storage_file_create(storage, STORAGE_STAT_CACHE_DIR, "0"));
+    mu_assert_int_eq(FSE_OK, storage_common_stat(storage, STORAGE_STAT_CACHE_DIR, &fileinfo));
+    mu_check(!file_info_is_dir(&fileinfo));
+    mu_assert_int_eq(FSE_OK, storage_common_remove(storage, UNIT_TESTS_PATH("STAT_CACHE")));
+    mu_assert_int_eq(FSE_NOT_EXIST, storage_common_stat(storage, STORAGE_STAT_CACHE_DIR, NULL));
+
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(storage_file) {
     storage_file_open_lock_setup();
     MU_RUN_TEST(storage_file_open_close);
     MU_RUN_TEST(storage_file_open_lock);
+    MU_RUN_TEST(storage_file_stat_cache);
     storage_file_open_lock_teardown();
 }
 
@@ -200,6 +253,292 @@ MU_TEST_SUITE(storage_dir) {
     MU_RUN_TEST(storage_dir_exists_test);
 }
 
+#define STORAGE_BATCH_FILE UNIT_TESTS_PATH("batch.test")
+#define STORAGE_BATCH_CHUNK_SIZE 512
+#define STORAGE_BATCH_CHUNK_COUNT 4
+
+static void storage_batch_test_callback(StorageBatch* batch, void* context) {
+    UNUSED(batch);
+    uint32_t* counter = context;
+    (*counter)++;
+}
+
+MU_TEST(storage_batch_write_read) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    StorageBatch* batch = storage_batch_alloc(storage);
+    const size_t size = STORAGE_BATCH_CHUNK_SIZE * STORAGE_BATCH_CHUNK_COUNT;
+    uint8_t* data = malloc(size);
+    uint8_t* readback = malloc(size);
+
+    for(size_t i = 0; i < size; i++) {
+        data[i] = i * 7;
+    }
+
+    mu_check(storage_batch_is_done(batch));
+    mu_check(storage_file_open(file, STORAGE_BATCH_FILE, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+
+    // write in chunks, in one go
+    for(size_t i = 0; i < STORAGE_BATCH_CHUNK_COUNT; i++) {
+        storage_batch_add_write(
+            batch, file, data + i * STORAGE_BATCH_CHUNK_SIZE, STORAGE_BATCH_CHUNK_SIZE);
+    }
+    mu_check(storage_batch_execute(batch));
+    mu_assert_int_eq(STORAGE_BATCH_CHUNK_COUNT, storage_batch_get_count(batch));
+    mu_assert_int_eq(STORAGE_BATCH_CHUNK_SIZE, storage_batch_get_result(batch, 0));
+    mu_assert_int_eq(size, storage_file_size(file));
+
+    // read back in reverse chunk order, asynchronously
+    uint32_t counter = 0;
+    storage_batch_reset(batch);
+    storage_batch_set_callback(batch, storage_batch_test_callback, &counter);
+    for(size_t i = STORAGE_BATCH_CHUNK_COUNT; i > 0; i--) {
+        const size_t offset = (i - 1) * STORAGE_BATCH_CHUNK_SIZE;
+        storage_batch_add_seek(batch, file, offset, true);
+        storage_batch_add_read(batch, file, readback + offset, STORAGE_BATCH_CHUNK_SIZE);
+    }
+    storage_batch_submit(batch);
+    mu_check(storage_batch_wait(batch, FuriWaitForever));
+    mu_check(storage_batch_wait(batch, 0));
+    mu_check(storage_batch_is_done(batch));
+    mu_assert_int_eq(1, counter);
+    mu_assert_int_eq(STORAGE_BATCH_CHUNK_COUNT * 2, storage_batch_get_count(batch));
+    for(size_t i = 0; i < storage_batch_get_count(batch); i++) {
+        mu_assert_int_eq(FSE_OK, storage_batch_get_error(batch, i));
+    }
+    mu_assert_mem_eq(data, readback, size);
+
+    // resubmit the same batch
+    memset(readback, 0, size);
+    mu_check(storage_batch_execute(batch));
+    mu_assert_int_eq(2, counter);
+    mu_assert_mem_eq(data, readback, size);
+
+    // short read stops the batch
+    storage_batch_reset(batch);
+    storage_batch_set_callback(batch, NULL, NULL);
+    storage_batch_add_seek(batch, file, size - 10, true);
+    storage_batch_add_read(batch, file, readback, STORAGE_BATCH_CHUNK_SIZE);
+    storage_batch_add_read(batch, file, readback, STORAGE_BATCH_CHUNK_SIZE);
+    mu_check(!storage_batch_execute(batch));
+    mu_assert_int_eq(1, storage_batch_get_result(batch, 0));
+    mu_assert_int_eq(10, storage_batch_get_result(batch, 1));
+    mu_assert_int_eq(FSE_OK, storage_batch_get_error(batch, 1));
+    mu_assert_int_eq(0, storage_batch_get_result(batch, 2));
+    mu_assert_int_eq(FSE_NOT_READY, storage_batch_get_error(batch, 2));
+
+    storage_file_close(file);
+    mu_check(storage_simply_remove(storage, STORAGE_BATCH_FILE));
+
+    free(readback);
+    free(data);
+    storage_batch_free(batch);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(storage_batch_in_flight) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* files[2] = {storage_file_alloc(storage), storage_file_alloc(storage)};
+    StorageBatch* batches[2] = {storage_batch_alloc(storage), storage_batch_alloc(storage)};
+    const char* paths[2] = {UNIT_TESTS_PATH("batch_0.test"), UNIT_TESTS_PATH("batch_1.test")};
+    uint8_t buffers[2][STORAGE_BATCH_CHUNK_SIZE];
+
+    for(size_t i = 0; i < COUNT_OF(files); i++) {
+        memset(buffers[i], '0' + i, STORAGE_BATCH_CHUNK_SIZE);
+        mu_check(storage_file_open(files[i], paths[i], FSAM_WRITE, FSOM_CREATE_ALWAYS));
+        for(size_t j = 0; j < STORAGE_BATCH_CHUNK_COUNT; j++) {
+            storage_batch_add_write(batches[i], files[i], buffers[i], STORAGE_BATCH_CHUNK_SIZE);
+        }
+    }
+
+    // both batches in flight at the same time
+    storage_batch_submit(batches[0]);
+    storage_batch_submit(batches[1]);
+
+    for(size_t i = 0; i < COUNT_OF(files); i++) {
+        mu_check(storage_batch_wait(batches[i], FuriWaitForever));
+        for(size_t j = 0; j < STORAGE_BATCH_CHUNK_COUNT; j++) {
+            mu_assert_int_eq(STORAGE_BATCH_CHUNK_SIZE, storage_batch_get_result(batches[i], j));
+        }
+        mu_assert_int_eq(
+            STORAGE_BATCH_CHUNK_SIZE * STORAGE_BATCH_CHUNK_COUNT, storage_file_size(files[i]));
+        storage_file_close(files[i]);
+        mu_check(storage_simply_remove(storage, paths[i]));
+        storage_batch_free(batches[i]);
+        storage_file_free(files[i]);
+    }
+
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST_SUITE(storage_batch) {
+    MU_RUN_TEST(storage_batch_write_read);
+    MU_RUN_TEST(storage_batch_in_flight);
+}
+
+#define RAM_DISK_SECTOR_SIZE 512
+#define RAM_DISK_SECTOR_COUNT 32
+
+typedef struct {
+    uint8_t* data;
+    uint32_t reads;
+    uint32_t writes;
+} RamDisk;
+
+static DRESULT ram_disk_read(void* context, BYTE* buff, DWORD sector, UINT count) {
+    RamDisk* disk = context;
+    if(sector + count > RAM_DISK_SECTOR_COUNT) return RES_PARERR;
+    memcpy(buff, disk->data + sector * RAM_DISK_SECTOR_SIZE, count * RAM_DISK_SECTOR_SIZE);
+    disk->reads++;
+    return RES_OK;
+}
+
+static DRESULT ram_disk_write(void* context, const BYTE* buff, DWORD sector, UINT count) {
+    RamDisk* disk = context;
+    if(sector + count > RAM_DISK_SECTOR_COUNT) return RES_PARERR;
+    memcpy(disk->data + sector * RAM_DISK_SECTOR_SIZE, buff, count * RAM_DISK_SECTOR_SIZE);
+    disk->writes++;
+    return RES_OK;
+}
+
+MU_TEST(storage_diskio_cache_read) {
+    RamDisk disk = {.data = malloc(RAM_DISK_SECTOR_SIZE * RAM_DISK_SECTOR_COUNT)};
+    uint8_t* buffer = malloc(RAM_DISK_SECTOR_SIZE * 4);
+    for(size_t i = 0; i < RAM_DISK_SECTOR_SIZE * RAM_DISK_SECTOR_COUNT; i++) {
+        disk.data[i] = i / RAM_DISK_SECTOR_SIZE + i;
+    }
+
+    // 4 lines of 2 sectors, 2 lines of readahead
+    DiskioCache* cache = diskio_cache_alloc(
+        4, 2, 2, RAM_DISK_SECTOR_SIZE, ram_disk_read, ram_disk_write, &disk);
+    diskio_cache_set_sector_count(cache, RAM_DISK_SECTOR_COUNT);
+    DiskioCacheStats stats;
+
+    // sequential reads are served by one device read per 4 sectors
+    for(DWORD sector = 0; sector < 16; sector++) {
+        mu_assert_int_eq(RES_OK, diskio_cache_read(cache, buffer, sector, 1));
+        mu_assert_mem_eq(
+            disk.data + sector * RAM_DISK_SECTOR_SIZE, buffer, RAM_DISK_SECTOR_SIZE);
+    }
+    diskio_cache_get_stats(cache, &stats);
+    mu_assert_int_eq(16, stats.read_hits + stats.read_misses);
+    mu_assert_int_eq(5, disk.reads);
+    mu_assert_int_eq(5, stats.read_misses);
+    mu_assert_int_eq(8, stats.prefetched);
+
+    // cached sectors are served without the device
+    disk.reads = 0;
+    mu_assert_int_eq(RES_OK, diskio_cache_read(cache, buffer, 12, 2));
+    mu_assert_mem_eq(disk.data + 12 * RAM_DISK_SECTOR_SIZE, buffer, RAM_DISK_SECTOR_SIZE * 2);
+    mu_assert_int_eq(0, disk.reads);
+
+    // large reads go straight to the device
+    mu_assert_int_eq(RES_OK, diskio_cache_read(cache, buffer, 20, 4));
+    mu_assert_int_eq(1, disk.reads);
+    diskio_cache_get_stats(cache, &stats);
+    mu_assert_int_eq(4, stats.read_bypass);
+
+    // never past the end of the device
+    mu_assert_int_eq(RES_PARERR, diskio_cache_read(cache, buffer, RAM_DISK_SECTOR_COUNT, 1));
+
+    diskio_cache_free(cache);
+    free(buffer);
+    free(disk.data);
+}
+
+MU_TEST(storage_diskio_cache_write) {
+    RamDisk disk = {.data = malloc(RAM_DISK_SECTOR_SIZE * RAM_DISK_SECTOR_COUNT)};
+    uint8_t* buffer = malloc(RAM_DISK_SECTOR_SIZE * 4);
+    memset(disk.data, 0, RAM_DISK_SECTOR_SIZE * RAM_DISK_SECTOR_COUNT);
+
+    DiskioCache* cache = diskio_cache_alloc(
+        4, 2, 1, RAM_DISK_SECTOR_SIZE, ram_disk_read, ram_disk_write, &disk);
+    diskio_cache_set_sector_count(cache, RAM_DISK_SECTOR_COUNT);
+    DiskioCacheStats stats;
+
+    // small writes are held back
+    for(DWORD sector = 4; sector < 8; sector++) {
+        memset(buffer, sector, RAM_DISK_SECTOR_SIZE);
+        mu_assert_int_eq(RES_OK, diskio_cache_write(cache, buffer, sector, 1));
+    }
+    mu_assert_int_eq(0, disk.writes);
+    mu_assert_int_eq(0, disk.data[4 * RAM_DISK_SECTOR_SIZE]);
+
+    // and seen by reads, cached or not
+    mu_assert_int_eq(RES_OK, diskio_cache_read(cache, buffer, 5, 1));
+    mu_assert_int_eq(5, buffer[0]);
+    mu_assert_int_eq(RES_OK, diskio_cache_read(cache, buffer, 3, 4));
+    mu_assert_int_eq(0, buffer[0]);
+    mu_assert_int_eq(6, buffer[3 * RAM_DISK_SECTOR_SIZE]);
+
+    // sync writes them out, one command per line
+    mu_assert_int_eq(RES_OK, diskio_cache_sync(cache));
+    mu_assert_int_eq(2, disk.writes);
+    for(DWORD sector = 4; sector < 8; sector++) {
+        mu_assert_int_eq(sector, disk.data[sector * RAM_DISK_SECTOR_SIZE]);
+    }
+    diskio_cache_get_stats(cache, &stats);
+    mu_assert_int_eq(4, stats.write_absorbed);
+    mu_assert_int_eq(4, stats.write_flushed);
+
+    // nothing left to flush
+    mu_assert_int_eq(RES_OK, diskio_cache_sync(cache));
+    mu_assert_int_eq(2, disk.writes);
+
+    // large writes update the cached copies
+    memset(buffer, 0xAA, RAM_DISK_SECTOR_SIZE * 4);
+    mu_assert_int_eq(RES_OK, diskio_cache_write(cache, buffer, 4, 4));
+    mu_assert_int_eq(RES_OK, diskio_cache_read(cache, buffer, 5, 1));
+    mu_assert_int_eq(0xAA, buffer[0]);
+    mu_assert_int_eq(RES_OK, diskio_cache_sync(cache));
+    mu_assert_int_eq(3, disk.writes);
+
+    diskio_cache_free(cache);
+    free(buffer);
+    free(disk.data);
+}
+
+MU_TEST_SUITE(storage_diskio_cache) {
+    MU_RUN_TEST(storage_diskio_cache_read);
+    MU_RUN_TEST(storage_diskio_cache_write);
+}
+
+typedef struct {
+    FuriString* line;
+    uint32_t count;
+    uint32_t failed;
+} StorageBenchTestContext;
+
+static void storage_bench_test_callback(const StorageBenchResult* result, void* context) {
+    StorageBenchTestContext* test = context;
+    storage_bench_result_format(result, test->line);
+    FURI_LOG_I("StorageBench", "%s", furi_string_get_cstr(test->line));
+    test->count++;
+    if(result->error != FSE_OK) {
+        test->failed++;
+    }
+}
+
+MU_TEST(storage_bench_smoke) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    StorageBenchTestContext test = {.line = furi_string_alloc()};
+
+    // 3 chunk sizes, read and write each, and 7 more workloads
+    mu_check(storage_bench_run(
+        storage, EXT_PATH("unit_tests"), 64 * 1024, storage_bench_test_callback, &test));
+    mu_assert_int_eq(13, test.count);
+    mu_assert_int_eq(0, test.failed);
+    mu_check(!storage_dir_exists(storage, UNIT_TESTS_PATH(STORAGE_BENCH_DIR_NAME)));
+
+    furi_string_free(test.line);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST_SUITE(storage_bench) {
+    MU_RUN_TEST(storage_bench_smoke);
+}
+
 static const char* const storage_copy_test_paths[] = {
     "1",
     "11",
@@ -591,9 +930,120 @@ MU_TEST_SUITE(test_storage_common) {
     MU_RUN_TEST(test_storage_common_migrate);
 }
 
+#define STORAGE_TAR_SRC UNIT_TESTS_PATH("tar_src")
+#define STORAGE_TAR_DST UNIT_TESTS_PATH("tar_dst")
+#define STORAGE_TAR_PLAIN UNIT_TESTS_PATH("test.tar")
+#define STORAGE_TAR_HEATSHRINK UNIT_TESTS_PATH("test.tar" TAR_HEATSHRINK_EXTENSION)
+
+static const struct {
+    const char* name;
+    size_t size;
+} storage_tar_files[] = {
+    {"/big.bin", 10000},
+    {"/empty.bin", 0},
+    {"/sub/small.bin", 700},
+};
+
+static bool storage_tar_file_process(Storage* storage, const char* path, size_t size, bool write) {
+    File* file = storage_file_alloc(storage);
+    uint8_t* data = malloc(size + 1);
+    bool result = false;
+
+    if(write) {
+        for(size_t i = 0; i < size; i++) {
+            data[i] = (i % 251) ^ (i / 251);
+        }
+        result = storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+                 (storage_file_write(file, data, size) == size);
+    } else if(storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        result = (storage_file_read(file, data, size + 1) == size);
+        for(size_t i = 0; result && (i < size); i++) {
+            result = (data[i] == ((i % 251) ^ (i / 251)));
+        }
+    }
+
+    free(data);
+    storage_file_free(file);
+    return result;
+}
+
+static void storage_tar_run(Storage* storage, const char* archive_path, size_t buffer_size) {
+    FuriString* path = furi_string_alloc();
+
+    TarArchive* archive = tar_archive_alloc(storage);
+    tar_archive_set_buffer_size(archive, buffer_size);
+    mu_check(tar_archive_open(archive, archive_path, tar_archive_get_mode_for_path(archive_path)));
+    mu_check(tar_archive_add_dir(archive, STORAGE_TAR_SRC, ""));
+    mu_check(tar_archive_finalize(archive));
+    tar_archive_free(archive);
+
+    storage_simply_remove_recursive(storage, STORAGE_TAR_DST);
+    mu_check(storage_simply_mkdir(storage, STORAGE_TAR_DST));
+
+    archive = tar_archive_alloc(storage);
+    tar_archive_set_buffer_size(archive, buffer_size);
+    mu_check(tar_archive_open(archive, archive_path, TAR_OPEN_MODE_READ));
+    mu_check(tar_archive_unpack_to(archive, STORAGE_TAR_DST, NULL));
+    uint32_t processed = 0, total = 0;
+    mu_check(tar_archive_get_read_progress(archive, &processed, &total));
+    mu_check(processed && (processed <= total));
+    tar_archive_free(archive);
+
+    for(size_t i = 0; i < COUNT_OF(storage_tar_files); i++) {
+        furi_string_printf(path, "%s%s", STORAGE_TAR_DST, storage_tar_files[i].name);
+        mu_assert(
+            storage_tar_file_process(
+                storage, furi_string_get_cstr(path), storage_tar_files[i].size, false),
+            furi_string_get_cstr(path));
+    }
+
+    furi_string_free(path);
+}
+
+MU_TEST(storage_tar_pack_unpack) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FuriString* path = furi_string_alloc();
+
+    storage_simply_remove_recursive(storage, STORAGE_TAR_SRC);
+    mu_check(storage_simply_mkdir(storage, STORAGE_TAR_SRC));
+    mu_check(storage_simply_mkdir(storage, STORAGE_TAR_SRC "/sub"));
+    for(size_t i = 0; i < COUNT_OF(storage_tar_files); i++) {
+        furi_string_printf(path, "%s%s", STORAGE_TAR_SRC, storage_tar_files[i].name);
+        mu_check(storage_tar_file_process(
+            storage, furi_string_get_cstr(path), storage_tar_files[i].size, true));
+    }
+
+    mu_assert_int_eq(TAR_OPEN_MODE_WRITE, tar_archive_get_mode_for_path(STORAGE_TAR_PLAIN));
+    storage_tar_run(storage, STORAGE_TAR_PLAIN, TAR_ARCHIVE_DEFAULT_BUFFER_SIZE);
+    // small buffer makes microtar seek back over the decoded window
+    storage_tar_run(storage, STORAGE_TAR_HEATSHRINK, 1024);
+    storage_tar_run(storage, STORAGE_TAR_HEATSHRINK, TAR_ARCHIVE_DEFAULT_BUFFER_SIZE);
+
+    FileInfo plain, compressed;
+    mu_assert_int_eq(FSE_OK, storage_common_stat(storage, STORAGE_TAR_PLAIN, &plain));
+    mu_assert_int_eq(FSE_OK, storage_common_stat(storage, STORAGE_TAR_HEATSHRINK, &compressed));
+    mu_check(compressed.size < plain.size);
+
+    storage_simply_remove_recursive(storage, STORAGE_TAR_SRC);
+    storage_simply_remove_recursive(storage, STORAGE_TAR_DST);
+    storage_simply_remove(storage, STORAGE_TAR_PLAIN);
+    storage_simply_remove(storage, STORAGE_TAR_HEATSHRINK);
+
+    furi_string_free(path);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST_SUITE(storage_tar) {
+    MU_RUN_TEST(storage_tar_pack_unpack);
+}
+
 int run_minunit_test_storage() {
     MU_RUN_SUITE(storage_file);
     MU_RUN_SUITE(storage_dir);
+    MU_RUN_SUITE(storage_batch);
+    MU_RUN_SUITE(storage_diskio_cache);
+    MU_RUN_SUITE(storage_bench);
+    MU_RUN_SUITE(storage_tar);
     MU_RUN_SUITE(storage_rename);
     MU_RUN_SUITE(test_data_path);
     MU_RUN_SUITE(test_storage_common);
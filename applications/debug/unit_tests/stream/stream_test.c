@@ -518,12 +518,123 @@ MU_TEST(stream_buffered_large_file_test) {
     furi_string_free(output_data);
 }
 
+static char stream_test_shift_char(size_t index) {
+    return 'a' + (index * 7) % 26;
+}
+
+static bool stream_test_shift_check(Stream* stream, FuriString* expected) {
+    const size_t size = furi_string_size(expected);
+    char* data = malloc(size);
+    bool result = false;
+
+    do {
+        if(stream_size(stream) != size) break;
+        if(!stream_rewind(stream)) break;
+        if(stream_read(stream, (uint8_t*)data, size) != size) break;
+        if(memcmp(data, furi_string_get_cstr(expected), size) != 0) break;
+        result = true;
+    } while(false);
+
+    free(data);
+    return result;
+}
+
+MU_TEST(stream_file_shift_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    Stream* stream = file_stream_alloc(storage);
+    FuriString* expected = furi_string_alloc();
+
+    // several shift buffers worth of data
+    const size_t data_size = 3000;
+    for(size_t i = 0; i < data_size; i++) {
+        furi_string_push_back(expected, stream_test_shift_char(i));
+    }
+
+    mu_check(
+        file_stream_open(stream, EXT_PATH("filestream.str"), FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    mu_assert_int_eq(data_size, stream_write_string(stream, expected));
+
+    // grow in the middle
+    mu_check(stream_seek(stream, 100, StreamOffsetFromStart));
+    mu_check(stream_delete_and_insert_cstring(stream, 5, "0123456789"));
+    mu_assert_int_eq(110, stream_tell(stream));
+    furi_string_replace_at(expected, 100, 5, "0123456789");
+    mu_check(stream_test_shift_check(stream, expected));
+
+    // shrink in the middle
+    mu_check(stream_seek(stream, 1500, StreamOffsetFromStart));
+    mu_check(stream_delete_and_insert_cstring(stream, 700, "xyz"));
+    mu_assert_int_eq(1503, stream_tell(stream));
+    furi_string_replace_at(expected, 1500, 700, "xyz");
+    mu_check(stream_test_shift_check(stream, expected));
+
+    // same size overwrite
+    mu_check(stream_seek(stream, 10, StreamOffsetFromStart));
+    mu_check(stream_delete_and_insert_cstring(stream, 4, "QWER"));
+    mu_assert_int_eq(14, stream_tell(stream));
+    furi_string_replace_at(expected, 10, 4, "QWER");
+    mu_check(stream_test_shift_check(stream, expected));
+
+    // grow near the start, the tail spans many buffers
+    mu_check(stream_seek(stream, 1, StreamOffsetFromStart));
+    mu_check(stream_insert_cstring(stream, "inserted at the start"));
+    furi_string_replace_at(expected, 1, 0, "inserted at the start");
+    mu_check(stream_test_shift_check(stream, expected));
+
+    stream_free(stream);
+    furi_string_free(expected);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(stream_peek_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    const uint8_t* data;
+    size_t size;
+
+    // string stream exposes its whole tail
+    Stream* stream = string_stream_alloc();
+    mu_assert_int_eq(strlen(stream_test_data), stream_write_cstring(stream, stream_test_data));
+    mu_check(stream_seek(stream, 4, StreamOffsetFromStart));
+    mu_check(stream_peek(stream, &data, &size));
+    mu_assert_int_eq(strlen(stream_test_data) - 4, size);
+    mu_check(memcmp(data, stream_test_data + 4, size) == 0);
+    mu_assert_int_eq(4, stream_tell(stream));
+    mu_check(stream_seek(stream, 0, StreamOffsetFromEnd));
+    mu_check(stream_peek(stream, &data, &size));
+    mu_assert_int_eq(0, size);
+    stream_free(stream);
+
+    // buffered stream exposes its cache window
+    stream = buffered_file_stream_alloc(storage);
+    mu_check(buffered_file_stream_open(
+        stream, EXT_PATH("filestream.str"), FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    mu_assert_int_eq(strlen(stream_test_data), stream_write_cstring(stream, stream_test_data));
+    mu_check(stream_seek(stream, 2, StreamOffsetFromStart));
+    mu_check(stream_peek(stream, &data, &size));
+    mu_check(size > 0);
+    mu_check(memcmp(data, stream_test_data + 2, size) == 0);
+    mu_assert_int_eq(2, stream_tell(stream));
+    mu_check(stream_seek(stream, size, StreamOffsetFromCurrent));
+    mu_assert_int_eq(2 + size, stream_tell(stream));
+    stream_free(stream);
+
+    // plain file stream has no direct access
+    stream = file_stream_alloc(storage);
+    mu_check(file_stream_open(stream, EXT_PATH("filestream.str"), FSAM_READ, FSOM_OPEN_EXISTING));
+    mu_check(!stream_peek(stream, &data, &size));
+    stream_free(stream);
+
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(stream_suite) {
     MU_RUN_TEST(stream_write_read_save_load_test);
     MU_RUN_TEST(stream_composite_test);
     MU_RUN_TEST(stream_split_test);
     MU_RUN_TEST(stream_buffered_write_after_read_test);
     MU_RUN_TEST(stream_buffered_large_file_test);
+    MU_RUN_TEST(stream_peek_test);
+    MU_RUN_TEST(stream_file_shift_test);
 }
 
 int run_minunit_test_stream() {
@@ -6,15 +6,23 @@
 #include <lib/subghz/subghz_keystore.h>
 #include <lib/subghz/subghz_file_encoder_worker.h>
 #include <lib/subghz/protocols/protocol_items.h>
+#include <lib/subghz/protocols/keeloq_common.h>
+#include <lib/subghz/blocks/decoder.h>
+#include <lib/subghz/blocks/encoder.h>
 #include <flipper_format/flipper_format_i.h>
 
 #define TAG "SubGhz TEST"
 #define KEYSTORE_DIR_NAME EXT_PATH("subghz/assets/keeloq_mfcodes")
+#define KEYSTORE_CACHE_NAME KEYSTORE_DIR_NAME ".cache"
 #define CAME_ATOMO_DIR_NAME EXT_PATH("subghz/assets/came_atomo")
 #define NICE_FLOR_S_DIR_NAME EXT_PATH("subghz/assets/nice_flor_s")
 #define ALUTECH_AT_4N_DIR_NAME EXT_PATH("subghz/assets/alutech_at_4n")
 #define TEST_RANDOM_DIR_NAME EXT_PATH("unit_tests/subghz/test_random_raw.sub")
+#define TEST_RANDOM_BIN_DIR_NAME EXT_PATH("unit_tests/subghz/test_random_raw_bin.sub")
+#define TEST_RANDOM_TEXT_DIR_NAME EXT_PATH("unit_tests/subghz/test_random_raw_text.sub")
 #define TEST_RANDOM_COUNT_PARSE 329
+#define TEST_RANDOM_BENCH_EDGES_MAX 4096
+#define TEST_RANDOM_BENCH_PASSES 8
 #define TEST_TIMEOUT 10000
 
 static SubGhzEnvironment* environment_handler;
@@ -27,12 +35,11 @@ static void subghz_test_rx_callback(
     SubGhzReceiver* receiver,
     SubGhzProtocolDecoderBase* decoder_base,
     void* context) {
-    UNUSED(receiver);
     UNUSED(context);
     FuriString* text;
     text = furi_string_alloc();
     subghz_protocol_decoder_base_get_string(decoder_base, text);
-    subghz_receiver_reset(receiver_handler);
+    subghz_receiver_reset(receiver);
     FURI_LOG_T(TAG, "\r\n%s", furi_string_get_cstr(text));
     furi_string_free(text);
     subghz_test_decoder_count++;
@@ -143,6 +150,115 @@ static bool subghz_decode_random_test(const char* path) {
     }
 }
 
+static size_t subghz_test_load_raw(const char* path, LevelDuration* edges, size_t edges_max) {
+    size_t edges_count = 0;
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* fff_data_file = flipper_format_file_alloc(storage);
+    int32_t* raw = malloc(sizeof(int32_t) * edges_max);
+
+    if(flipper_format_file_open_existing(fff_data_file, path)) {
+        uint32_t count = 0;
+        while(edges_count < edges_max &&
+              flipper_format_get_value_count(fff_data_file, "RAW_Data", &count)) {
+            count = MIN(count, edges_max - edges_count);
+            if(!flipper_format_read_int32(fff_data_file, "RAW_Data", raw, count)) break;
+            for(size_t i = 0; i < count; i++) {
+                edges[edges_count++] = level_duration_make(raw[i] > 0, abs(raw[i]));
+            }
+        }
+    }
+
+    free(raw);
+    flipper_format_free(fff_data_file);
+    furi_record_close(RECORD_STORAGE);
+    return edges_count;
+}
+
+static void subghz_test_bench_print(const char* name, uint32_t edges_total, uint32_t time) {
+    printf(
+        "%s: %lu edges in %lu ms, %lu edges/s, %u parsed\r\n",
+        name,
+        edges_total,
+        time,
+        time ? (uint32_t)((uint64_t)edges_total * 1000 / time) : edges_total,
+        subghz_test_decoder_count);
+}
+
+static SubGhzReceiver* subghz_test_bench_receiver_alloc(void) {
+    SubGhzReceiver* receiver = subghz_receiver_alloc_init(environment_handler);
+    subghz_receiver_set_filter(receiver, SubGhzProtocolFlag_Decodable);
+    subghz_receiver_set_rx_callback(receiver, subghz_test_rx_callback, NULL);
+    return receiver;
+}
+
+static bool subghz_decode_random_bench(const char* path) {
+    LevelDuration* edges = malloc(sizeof(LevelDuration) * TEST_RANDOM_BENCH_EDGES_MAX);
+    size_t edges_count = subghz_test_load_raw(path, edges, TEST_RANDOM_BENCH_EDGES_MAX);
+    uint32_t edges_total = edges_count * TEST_RANDOM_BENCH_PASSES;
+
+    // Fresh receivers, so that no decoder state is carried from one run to the other
+    SubGhzReceiver* linear_receiver = subghz_test_bench_receiver_alloc();
+    SubGhzReceiver* indexed_receiver = subghz_test_bench_receiver_alloc();
+
+    // Old dispatch: every decoder that passes the filter is fed on every edge
+    const size_t protocol_count = subghz_protocol_registry_count(&subghz_protocol_registry);
+    SubGhzProtocolDecoderBase** decoders =
+        malloc(sizeof(SubGhzProtocolDecoderBase*) * protocol_count);
+    size_t decoder_count = 0;
+    for(size_t i = 0; i < protocol_count; i++) {
+        const SubGhzProtocol* protocol =
+            subghz_protocol_registry_get_by_index(&subghz_protocol_registry, i);
+        if(!protocol->decoder || !(protocol->flag & SubGhzProtocolFlag_Decodable)) continue;
+        SubGhzProtocolDecoderBase* decoder =
+            subghz_receiver_search_decoder_base_by_name(linear_receiver, protocol->name);
+        if(decoder) decoders[decoder_count++] = decoder;
+    }
+
+    subghz_test_decoder_count = 0;
+
+    // Edges are preloaded, so only dispatch and decoders are measured
+    uint32_t bench_start = furi_get_tick();
+    for(size_t pass = 0; pass < TEST_RANDOM_BENCH_PASSES; pass++) {
+        for(size_t i = 0; i < edges_count; i++) {
+            for(size_t d = 0; d < decoder_count; d++) {
+                decoders[d]->protocol->decoder->feed(
+                    decoders[d],
+                    level_duration_get_level(edges[i]),
+                    level_duration_get_duration(edges[i]));
+            }
+        }
+    }
+    uint32_t linear_time = furi_get_tick() - bench_start;
+    uint16_t linear_count = subghz_test_decoder_count;
+    subghz_test_bench_print("Linear dispatch", edges_total, linear_time);
+
+    subghz_test_decoder_count = 0;
+
+    bench_start = furi_get_tick();
+    for(size_t pass = 0; pass < TEST_RANDOM_BENCH_PASSES; pass++) {
+        for(size_t i = 0; i < edges_count; i++) {
+            subghz_receiver_decode(
+                indexed_receiver,
+                level_duration_get_level(edges[i]),
+                level_duration_get_duration(edges[i]));
+        }
+    }
+    uint32_t indexed_time = furi_get_tick() - bench_start;
+    subghz_test_bench_print("Indexed dispatch", edges_total, indexed_time);
+    printf(
+        "Speedup: %lu.%02lux\r\n",
+        indexed_time ? linear_time / indexed_time : 0,
+        indexed_time ? (linear_time % indexed_time) * 100 / indexed_time : 0);
+
+    free(decoders);
+    subghz_receiver_free(indexed_receiver);
+    subghz_receiver_free(linear_receiver);
+    free(edges);
+
+    // Skipping decoders must not lose anything the old dispatch found
+    return (edges_count != 0) && (subghz_test_decoder_count == linear_count);
+}
+
 static bool subghz_encoder_test(const char* path) {
     subghz_test_decoder_count = 0;
     uint32_t test_start = furi_get_tick();
@@ -212,6 +328,94 @@ MU_TEST(subghz_keystore_test) {
         "Test keystore error");
 }
 
+MU_TEST(subghz_keystore_cache_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_remove(storage, KEYSTORE_CACHE_NAME);
+
+    // First load parses the text keystore and compiles the cache, second one uses it
+    SubGhzKeystore* keystore_text = subghz_keystore_alloc();
+    mu_assert(subghz_keystore_load(keystore_text, KEYSTORE_DIR_NAME), "Keystore load error");
+    mu_assert(storage_file_exists(storage, KEYSTORE_CACHE_NAME), "Keystore cache missing");
+    SubGhzKeystore* keystore_cache = subghz_keystore_alloc();
+    mu_assert(subghz_keystore_load(keystore_cache, KEYSTORE_DIR_NAME), "Keystore cache error");
+
+    SubGhzKeyArray_t* keys_text = subghz_keystore_get_data(keystore_text);
+    SubGhzKeyArray_t* keys_cache = subghz_keystore_get_data(keystore_cache);
+    mu_assert_int_eq(SubGhzKeyArray_size(*keys_text), SubGhzKeyArray_size(*keys_cache));
+    for(size_t i = 0; i < SubGhzKeyArray_size(*keys_text); i++) {
+        const SubGhzKey* key_text = SubGhzKeyArray_cget(*keys_text, i);
+        const SubGhzKey* key_cache = SubGhzKeyArray_cget(*keys_cache, i);
+        mu_assert(key_text->key == key_cache->key, "Key mismatch");
+        mu_assert_int_eq(key_text->type, key_cache->type);
+        mu_assert(furi_string_equal(key_text->name, key_cache->name), "Name mismatch");
+    }
+
+    subghz_keystore_free(keystore_cache);
+    subghz_keystore_free(keystore_text);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(subghz_hash_data_long_test) {
+    SubGhzBlockDecoder decoder = {.decode_data = 0x0123456789ABCDEFULL, .decode_count_bit = 64};
+    uint64_t hash = subghz_protocol_blocks_get_hash_data_long(&decoder, 8);
+    mu_assert(hash == subghz_protocol_blocks_get_hash_data_long(&decoder, 9), "Length clamp");
+
+    decoder.decode_count_bit = 63;
+    mu_assert(hash != subghz_protocol_blocks_get_hash_data_long(&decoder, 8), "Bit count");
+
+    // Payloads with equal 8-bit XOR hash must still differ
+    decoder.decode_count_bit = 64;
+    decoder.decode_data = 0x0123456789ABCDEFULL ^ 0x0101000000000000ULL;
+    mu_assert_int_eq(
+        subghz_protocol_blocks_get_hash_data(&decoder, 8),
+        subghz_protocol_blocks_get_hash_data(
+            &(SubGhzBlockDecoder){.decode_data = 0x0123456789ABCDEFULL}, 8));
+    mu_assert(hash != subghz_protocol_blocks_get_hash_data_long(&decoder, 8), "Data");
+}
+
+MU_TEST(subghz_encoder_generator_test) {
+    SubGhzProtocolBlockGenerator generator = {.repeat = 3};
+    subghz_protocol_blocks_generator_reset(&generator);
+    mu_assert(!subghz_protocol_blocks_generator_start(&generator), "Empty frame started");
+
+    // Bits 1 and 0, trailer low 5 is merged into the last bit
+    subghz_protocol_blocks_generator_set_data(&generator, 0x2, 2);
+    subghz_protocol_blocks_generator_set_bit(
+        &generator, true, level_duration_make(true, 10), level_duration_make(false, 20));
+    subghz_protocol_blocks_generator_set_bit(
+        &generator, false, level_duration_make(true, 20), level_duration_make(false, 10));
+    subghz_protocol_blocks_generator_add_trailer(&generator, level_duration_make(false, 5));
+    mu_assert(subghz_protocol_blocks_generator_start(&generator), "Generator not started");
+
+    const uint32_t expected[] = {10, 20, 20, 15};
+    size_t count = 0;
+    LevelDuration level_duration;
+    while(!level_duration_is_reset(
+        level_duration = subghz_protocol_blocks_generator_yield(&generator))) {
+        mu_assert_int_eq(!(count & 1), level_duration_get_level(level_duration));
+        mu_assert_int_eq(expected[count % 4], level_duration_get_duration(level_duration));
+        count++;
+    }
+    mu_assert_int_eq(3 * 4, count);
+    mu_assert(!generator.is_running, "Generator still running");
+}
+
+MU_TEST(subghz_keeloq_batch_decrypt_test) {
+    uint64_t keys[KEELOQ_BATCH_SIZE];
+    uint32_t decrypt[KEELOQ_BATCH_SIZE];
+    for(size_t i = 0; i < KEELOQ_BATCH_SIZE; i++) {
+        keys[i] = 0x0123456789ABCDEFULL * (i + 1) ^ ((uint64_t)i << 59);
+    }
+
+    const uint32_t hop = 0xC0FFEE42;
+    for(size_t count = 1; count <= KEELOQ_BATCH_SIZE; count += 31) {
+        subghz_protocol_keeloq_common_decrypt_batch(hop, keys, decrypt, count);
+        for(size_t i = 0; i < count; i++) {
+            mu_assert_int_eq(subghz_protocol_keeloq_common_decrypt(hop, keys[i]), decrypt[i]);
+        }
+    }
+}
+
 typedef enum {
     SubGhzHalAsyncTxTestTypeNormal,
     SubGhzHalAsyncTxTestTypeInvalidStart,
@@ -800,9 +1004,42 @@ MU_TEST(subghz_random_test) {
     mu_assert(subghz_decode_random_test(TEST_RANDOM_DIR_NAME), "Random test error\r\n");
 }
 
+MU_TEST(subghz_random_bin_test) {
+    mu_assert(
+        subghz_protocol_raw_convert_file(TEST_RANDOM_DIR_NAME, TEST_RANDOM_BIN_DIR_NAME, true),
+        "Convert to binary RAW error\r\n");
+    mu_assert(subghz_decode_random_test(TEST_RANDOM_BIN_DIR_NAME), "Random bin test error\r\n");
+    mu_assert(
+        subghz_protocol_raw_convert_file(
+            TEST_RANDOM_BIN_DIR_NAME, TEST_RANDOM_TEXT_DIR_NAME, false),
+        "Convert to text RAW error\r\n");
+    mu_assert(
+        subghz_decode_random_test(TEST_RANDOM_TEXT_DIR_NAME), "Random text test error\r\n");
+    mu_assert(
+        !subghz_protocol_raw_convert_file(
+            TEST_RANDOM_BIN_DIR_NAME, TEST_RANDOM_BIN_DIR_NAME, false),
+        "Convert in place must fail\r\n");
+    mu_assert(
+        subghz_decode_random_test(TEST_RANDOM_BIN_DIR_NAME),
+        "Random bin test error after convert in place\r\n");
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_remove(storage, TEST_RANDOM_BIN_DIR_NAME);
+    storage_simply_remove(storage, TEST_RANDOM_TEXT_DIR_NAME);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(subghz_random_bench) {
+    mu_assert(subghz_decode_random_bench(TEST_RANDOM_DIR_NAME), "Random bench error\r\n");
+}
+
 MU_TEST_SUITE(subghz) {
     subghz_test_init();
     MU_RUN_TEST(subghz_keystore_test);
+    MU_RUN_TEST(subghz_keystore_cache_test);
+    MU_RUN_TEST(subghz_hash_data_long_test);
+    MU_RUN_TEST(subghz_encoder_generator_test);
+    MU_RUN_TEST(subghz_keeloq_batch_decrypt_test);
 
     MU_RUN_TEST(subghz_hal_async_tx_test);
 
@@ -874,6 +1111,8 @@ MU_TEST_SUITE(subghz) {
     MU_RUN_TEST(subghz_encoder_dooya_test);
 
     MU_RUN_TEST(subghz_random_test);
+    MU_RUN_TEST(subghz_random_bin_test);
+    MU_RUN_TEST(subghz_random_bench);
     subghz_test_deinit();
 }
 
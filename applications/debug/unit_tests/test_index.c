@@ -26,6 +26,7 @@ int run_minunit_test_lfrfid_protocols();
 int run_minunit_test_nfc();
 int run_minunit_test_bit_lib();
 int run_minunit_test_float_tools();
+int run_minunit_test_hasher();
 int run_minunit_test_bt();
 int run_minunit_test_dialogs_file_browser_options();
 
@@ -55,6 +56,7 @@ const UnitTest unit_tests[] = {
     {.name = "lfrfid", .entry = run_minunit_test_lfrfid_protocols},
     {.name = "bit_lib", .entry = run_minunit_test_bit_lib},
     {.name = "float_tools", .entry = run_minunit_test_float_tools},
+    {.name = "hasher", .entry = run_minunit_test_hasher},
     {.name = "bt", .entry = run_minunit_test_bt},
     {.name = "dialogs_file_browser_options",
      .entry = run_minunit_test_dialogs_file_browser_options},
@@ -397,12 +397,10 @@ void archive_add_app_item(ArchiveBrowserView* browser, const char* name) {
 }
 
 static bool archive_get_fap_meta(FuriString* file_path, FuriString* fap_name, uint8_t** icon_ptr) {
-    Storage* storage = furi_record_open(RECORD_STORAGE);
-    bool success = false;
-    if(flipper_application_load_name_and_icon(file_path, storage, icon_ptr, fap_name)) {
-        success = true;
-    }
-    furi_record_close(RECORD_STORAGE);
+    Loader* loader = furi_record_open(RECORD_LOADER);
+    bool success = flipper_application_meta_cache_load_name_and_icon(
+        loader_get_meta_cache(loader), file_path, icon_ptr, fap_name);
+    furi_record_close(RECORD_LOADER);
     return success;
 }
 
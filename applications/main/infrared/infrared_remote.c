@@ -17,6 +17,8 @@ struct InfraredRemote {
     StringArray_t signal_names;
     FuriString* name;
     FuriString* path;
+    // Kept open between signal loads, so that the key index is built only once
+    FlipperFormat* signal_ff;
 };
 
 typedef struct {
@@ -42,10 +44,35 @@ InfraredRemote* infrared_remote_alloc() {
     StringArray_init(remote->signal_names);
     remote->name = furi_string_alloc();
     remote->path = furi_string_alloc();
+    remote->signal_ff = NULL;
     return remote;
 }
 
+static void infrared_remote_signal_file_close(InfraredRemote* remote) {
+    if(remote->signal_ff) {
+        flipper_format_free(remote->signal_ff);
+        furi_record_close(RECORD_STORAGE);
+        remote->signal_ff = NULL;
+    }
+}
+
+static FlipperFormat* infrared_remote_signal_file_open(InfraredRemote* remote) {
+    if(!remote->signal_ff) {
+        Storage* storage = furi_record_open(RECORD_STORAGE);
+        remote->signal_ff = flipper_format_buffered_file_alloc(storage);
+        flipper_format_set_key_index(remote->signal_ff, true);
+
+        if(!flipper_format_buffered_file_open_existing(
+               remote->signal_ff, furi_string_get_cstr(remote->path))) {
+            infrared_remote_signal_file_close(remote);
+        }
+    }
+
+    return remote->signal_ff;
+}
+
 void infrared_remote_free(InfraredRemote* remote) {
+    infrared_remote_signal_file_close(remote);
     StringArray_clear(remote->signal_names);
     furi_string_free(remote->path);
     furi_string_free(remote->name);
@@ -53,6 +80,7 @@ void infrared_remote_free(InfraredRemote* remote) {
 }
 
 void infrared_remote_reset(InfraredRemote* remote) {
+    infrared_remote_signal_file_close(remote);
     StringArray_reset(remote->signal_names);
     furi_string_reset(remote->name);
     furi_string_reset(remote->path);
@@ -80,33 +108,27 @@ const char* infrared_remote_get_signal_name(const InfraredRemote* remote, size_t
     return *StringArray_cget(remote->signal_names, index);
 }
 
-bool infrared_remote_load_signal(
-    const InfraredRemote* remote,
-    InfraredSignal* signal,
-    size_t index) {
+bool infrared_remote_load_signal(InfraredRemote* remote, InfraredSignal* signal, size_t index) {
     furi_assert(index < infrared_remote_get_signal_count(remote));
 
-    Storage* storage = furi_record_open(RECORD_STORAGE);
-    FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
-
     bool success = false;
 
     do {
         const char* path = furi_string_get_cstr(remote->path);
-        if(!flipper_format_buffered_file_open_existing(ff, path)) break;
+        FlipperFormat* ff = infrared_remote_signal_file_open(remote);
+        if(!ff) break;
 
         if(!infrared_signal_search_by_index_and_read(signal, ff, index)) {
             const char* signal_name = infrared_remote_get_signal_name(remote, index);
             FURI_LOG_E(TAG, "Failed to load signal '%s' from file '%s'", signal_name, path);
+            // Start over with a fresh file and index next time
+            infrared_remote_signal_file_close(remote);
             break;
         }
 
         success = true;
     } while(false);
 
-    flipper_format_free(ff);
-    furi_record_close(RECORD_STORAGE);
-
     return success;
 }
 
@@ -132,6 +154,8 @@ bool infrared_remote_append_signal(
     InfraredRemote* remote,
     const InfraredSignal* signal,
     const char* name) {
+    infrared_remote_signal_file_close(remote);
+
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* ff = flipper_format_file_alloc(storage);
 
@@ -156,6 +180,8 @@ static bool infrared_remote_batch_start(
     InfraredRemote* remote,
     InfraredBatchCallback batch_callback,
     const InfraredBatchTarget* target) {
+    infrared_remote_signal_file_close(remote);
+
     FuriString* tmp = furi_string_alloc();
     Storage* storage = furi_record_open(RECORD_STORAGE);
 
@@ -364,6 +390,8 @@ bool infrared_remote_create(InfraredRemote* remote, const char* path) {
 bool infrared_remote_load(InfraredRemote* remote, const char* path) {
     FURI_LOG_I(TAG, "Loading file: '%s'", path);
 
+    infrared_remote_signal_file_close(remote);
+
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
 
@@ -398,6 +426,7 @@ bool infrared_remote_load(InfraredRemote* remote, const char* path) {
 
 bool infrared_remote_rename(InfraredRemote* remote, const char* new_path) {
     const char* old_path = infrared_remote_get_path(remote);
+    infrared_remote_signal_file_close(remote);
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     const FS_Error status = storage_common_rename(storage, old_path, new_path);
@@ -413,6 +442,8 @@ bool infrared_remote_rename(InfraredRemote* remote, const char* new_path) {
 }
 
 bool infrared_remote_remove(InfraredRemote* remote) {
+    infrared_remote_signal_file_close(remote);
+
     Storage* storage = furi_record_open(RECORD_STORAGE);
     const FS_Error status = storage_common_remove(storage, infrared_remote_get_path(remote));
     furi_record_close(RECORD_STORAGE);
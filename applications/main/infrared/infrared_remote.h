@@ -100,17 +100,15 @@ bool infrared_remote_get_signal_index(
  * @brief Load a signal listed in an InfraredRemote instance.
  *
  * As mentioned above, the signals are loaded on-demand. The user code must call this function
- * each time it wants to interact with a new signal.
+ * each time it wants to interact with a new signal. The file is kept open with the key index
+ * between calls, until the remote is modified, reloaded or reset.
  *
- * @param[in] remote pointer to the instance to load from.
+ * @param[in,out] remote pointer to the instance to load from.
  * @param[out] signal pointer to the signal to load into. Must be allocated.
  * @param[in] index index of the signal to be loaded. Must be less than the total signal count.
  * @return true if the signal was successfully loaded, false otherwise.
  */
-bool infrared_remote_load_signal(
-    const InfraredRemote* remote,
-    InfraredSignal* signal,
-    size_t index);
+bool infrared_remote_load_signal(InfraredRemote* remote, InfraredSignal* signal, size_t index);
 
 /**
  * @brief Append a signal to the file associated with an InfraredRemote instance.
@@ -288,15 +288,11 @@ bool infrared_signal_search_by_index_and_read(
     InfraredSignal* signal,
     FlipperFormat* ff,
     size_t index) {
-    bool success = false;
     FuriString* tmp = furi_string_alloc();
 
-    for(uint32_t i = 0; infrared_signal_read_name(ff, tmp); ++i) {
-        if(i == index) {
-            success = infrared_signal_read_body(signal, ff);
-            break;
-        }
-    }
+    const bool success = flipper_format_seek_to_nth_key(ff, INFRARED_SIGNAL_NAME_KEY, index) &&
+                         infrared_signal_read_name(ff, tmp) &&
+                         infrared_signal_read_body(signal, ff);
 
     furi_string_free(tmp);
     return success;
@@ -171,6 +171,7 @@ bool infrared_signal_search_by_name_and_read(
  * @brief Read a signal with a particular index from a FlipperFormat file into an InfraredSignal instance.
  *
  * This function will look for a signal with the given index and if found, attempt to read it.
+ * The index is counted from the beginning of the file.
  * Same considerations apply as to infrared_signal_read().
  *
  * @param[in,out] signal pointer to the instance to be read into.
@@ -0,0 +1,350 @@
+#include "subghz_decode_raw_batch.h"
+
+#include <lib/subghz/receiver.h>
+#include <lib/subghz/protocols/raw.h>
+#include <lib/toolbox/dir_walk.h>
+#include <toolbox/stream/stream.h>
+#include <flipper_format/flipper_format_i.h>
+
+#define TAG "SubGhzDecodeRawBatch"
+
+#define SUBGHZ_DECODE_RAW_BATCH_STREAM_SIZE (2048 * sizeof(int32_t))
+#define SUBGHZ_DECODE_RAW_BATCH_CHUNK_SIZE 128
+#define SUBGHZ_DECODE_RAW_BATCH_QUEUE_SIZE 4
+#define SUBGHZ_DECODE_RAW_BATCH_TIMEOUT 100
+#define SUBGHZ_DECODE_RAW_BATCH_DATA_KEY "RAW_Data:"
+
+typedef struct {
+    FuriString* file_name; // NULL marks the end of the batch
+    bool is_valid;
+} SubGhzDecodeRawBatchJob;
+
+struct SubGhzDecodeRawBatch {
+    FuriThread* thread;
+    FuriStreamBuffer* stream;
+    FuriMessageQueue* job_queue;
+    volatile bool running;
+    FuriString* path;
+
+    // Reader thread side, durations are sent as in RAW_Data, 0 ends a file
+    FuriString* line;
+    int32_t read_chunk[SUBGHZ_DECODE_RAW_BATCH_CHUNK_SIZE];
+    size_t read_count;
+
+    // Decode thread side
+    SubGhzReceiver* receiver;
+    FuriString* protocols;
+    size_t packet_count;
+    int32_t decode_chunk[SUBGHZ_DECODE_RAW_BATCH_CHUNK_SIZE];
+    size_t decode_bytes;
+    size_t decode_pos;
+};
+
+static bool subghz_decode_raw_batch_flush(SubGhzDecodeRawBatch* instance) {
+    const uint8_t* data = (const uint8_t*)instance->read_chunk;
+    size_t size = instance->read_count * sizeof(int32_t);
+    instance->read_count = 0;
+
+    while(size) {
+        if(!instance->running) return false;
+        size_t sent = furi_stream_buffer_send(
+            instance->stream, data, size, SUBGHZ_DECODE_RAW_BATCH_TIMEOUT);
+        data += sent;
+        size -= sent;
+    }
+    return true;
+}
+
+static bool subghz_decode_raw_batch_push(SubGhzDecodeRawBatch* instance, int32_t duration) {
+    instance->read_chunk[instance->read_count++] = duration;
+    if(instance->read_count == SUBGHZ_DECODE_RAW_BATCH_CHUNK_SIZE) {
+        return subghz_decode_raw_batch_flush(instance);
+    }
+    return true;
+}
+
+static bool subghz_decode_raw_batch_push_array(const int32_t* data, size_t count, void* context) {
+    SubGhzDecodeRawBatch* instance = context;
+    for(size_t i = 0; i < count; i++) {
+        // 0 is the end of file marker
+        if(data[i] && !subghz_decode_raw_batch_push(instance, data[i])) return false;
+    }
+    return true;
+}
+
+static bool subghz_decode_raw_batch_parse_line(SubGhzDecodeRawBatch* instance, const char* line) {
+    // Line sample: "RAW_Data: -1, 2, -2..."
+    const char* cursor = line + strlen(SUBGHZ_DECODE_RAW_BATCH_DATA_KEY);
+    while(*cursor) {
+        char* end;
+        long duration = strtol(cursor, &end, 10);
+        if(end == cursor) {
+            cursor++;
+            continue;
+        }
+        cursor = end;
+        if(duration && !subghz_decode_raw_batch_push(instance, duration)) return false;
+    }
+    return true;
+}
+
+static bool subghz_decode_raw_batch_put_job(
+    SubGhzDecodeRawBatch* instance,
+    SubGhzDecodeRawBatchJob* job) {
+    while(instance->running) {
+        if(furi_message_queue_put(instance->job_queue, job, SUBGHZ_DECODE_RAW_BATCH_TIMEOUT) ==
+           FuriStatusOk) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool subghz_decode_raw_batch_open_file(
+    SubGhzDecodeRawBatch* instance,
+    FlipperFormat* flipper_format,
+    const char* file_name) {
+    uint32_t version = 0;
+    return flipper_format_file_open_existing(flipper_format, file_name) &&
+           flipper_format_read_header(flipper_format, instance->line, &version) &&
+           furi_string_equal_str(instance->line, SUBGHZ_RAW_FILE_TYPE) &&
+           version == SUBGHZ_RAW_FILE_VERSION;
+}
+
+static bool subghz_decode_raw_batch_read_file(
+    SubGhzDecodeRawBatch* instance,
+    FlipperFormat* flipper_format) {
+    bool result = true;
+    Stream* stream = flipper_format_get_raw_stream(flipper_format);
+
+    while(result && stream_read_line(stream, instance->line)) {
+        if(furi_string_start_with_str(instance->line, SUBGHZ_RAW_FILE_BIN_DATA_KEY ":")) {
+            const char* value = strchr(furi_string_get_cstr(instance->line), ' ');
+            size_t size = value ? strtoul(value, NULL, 10) : 0;
+            if(!subghz_protocol_raw_read_bin_data(
+                   stream, size, subghz_decode_raw_batch_push_array, instance)) {
+                FURI_LOG_E(TAG, "Invalid RAW_Bin_Data");
+                break;
+            }
+            //skip the end of the payload "\n"
+            stream_seek(stream, 1, StreamOffsetFromCurrent);
+        } else if(furi_string_start_with_str(instance->line, SUBGHZ_DECODE_RAW_BATCH_DATA_KEY)) {
+            result =
+                subghz_decode_raw_batch_parse_line(instance, furi_string_get_cstr(instance->line));
+        }
+    }
+
+    // Whatever was read so far is decoded, the file is always terminated
+    return subghz_decode_raw_batch_push(instance, 0) && subghz_decode_raw_batch_flush(instance) &&
+           result;
+}
+
+static bool subghz_decode_raw_batch_filter(const char* name, FileInfo* fileinfo, void* context) {
+    UNUSED(context);
+    size_t len = strlen(name);
+    return !file_info_is_dir(fileinfo) && len > 4 && strcmp(&name[len - 4], ".sub") == 0;
+}
+
+/** Reader thread, walks the directory and streams parsed durations
+ *
+ * @param context
+ * @return exit code
+ */
+static int32_t subghz_decode_raw_batch_thread(void* context) {
+    SubGhzDecodeRawBatch* instance = context;
+    FURI_LOG_I(TAG, "Reader start");
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
+    DirWalk* dir_walk = dir_walk_alloc(storage);
+    dir_walk_set_filter_cb(dir_walk, subghz_decode_raw_batch_filter, NULL);
+
+    if(dir_walk_open(dir_walk, furi_string_get_cstr(instance->path))) {
+        FuriString* file_name = furi_string_alloc();
+        while(instance->running && dir_walk_read(dir_walk, file_name, NULL) == DirWalkOK) {
+            SubGhzDecodeRawBatchJob job = {
+                .file_name = furi_string_alloc_set(file_name),
+                .is_valid = subghz_decode_raw_batch_open_file(
+                    instance, flipper_format, furi_string_get_cstr(file_name)),
+            };
+            // Job is queued before its data, the decode thread owns the name from now on
+            if(!subghz_decode_raw_batch_put_job(instance, &job)) {
+                furi_string_free(job.file_name);
+                break;
+            }
+            if(job.is_valid && !subghz_decode_raw_batch_read_file(instance, flipper_format)) {
+                break;
+            }
+            flipper_format_file_close(flipper_format);
+        }
+        furi_string_free(file_name);
+    } else {
+        FURI_LOG_E(TAG, "Unable to open %s", furi_string_get_cstr(instance->path));
+    }
+    dir_walk_close(dir_walk);
+
+    SubGhzDecodeRawBatchJob job = {.file_name = NULL, .is_valid = false};
+    subghz_decode_raw_batch_put_job(instance, &job);
+
+    dir_walk_free(dir_walk);
+    flipper_format_free(flipper_format);
+    furi_record_close(RECORD_STORAGE);
+
+    FURI_LOG_I(TAG, "Reader stop");
+    return 0;
+}
+
+static bool subghz_decode_raw_batch_read(SubGhzDecodeRawBatch* instance, int32_t* duration) {
+    while((instance->decode_pos + 1) * sizeof(int32_t) > instance->decode_bytes) {
+        // Stream buffer may split a value, keep the partial one at the start
+        uint8_t* buffer = (uint8_t*)instance->decode_chunk;
+        size_t used = instance->decode_pos * sizeof(int32_t);
+        size_t carry = instance->decode_bytes - used;
+        memmove(buffer, &buffer[used], carry);
+        instance->decode_pos = 0;
+
+        size_t received = furi_stream_buffer_receive(
+            instance->stream,
+            &buffer[carry],
+            sizeof(instance->decode_chunk) - carry,
+            SUBGHZ_DECODE_RAW_BATCH_TIMEOUT);
+        instance->decode_bytes = carry + received;
+        if(!received && furi_thread_get_state(instance->thread) == FuriThreadStateStopped) {
+            return false;
+        }
+    }
+
+    *duration = instance->decode_chunk[instance->decode_pos++];
+    return true;
+}
+
+static void subghz_decode_raw_batch_decode_file(
+    SubGhzDecodeRawBatch* instance,
+    SubGhzDecodeRawBatchResult* result) {
+    furi_string_reset(instance->protocols);
+    instance->packet_count = 0;
+    subghz_receiver_reset(instance->receiver);
+
+    uint32_t start = furi_get_tick();
+    int32_t duration;
+    while(subghz_decode_raw_batch_read(instance, &duration) && duration) {
+        if(duration > 0) {
+            subghz_receiver_decode(instance->receiver, true, duration);
+        } else {
+            subghz_receiver_decode(instance->receiver, false, -duration);
+        }
+        result->edge_count++;
+    }
+    result->decode_time = furi_get_tick() - start;
+    result->packet_count = instance->packet_count;
+    result->protocols = furi_string_get_cstr(instance->protocols);
+}
+
+static bool subghz_decode_raw_batch_has_protocol(FuriString* protocols, const char* name) {
+    size_t len = strlen(name);
+    const char* cursor = furi_string_get_cstr(protocols);
+    while(*cursor) {
+        const char* end = strchr(cursor, ',');
+        size_t item_len = end ? (size_t)(end - cursor) : strlen(cursor);
+        if(item_len == len && strncmp(cursor, name, len) == 0) return true;
+        if(!end) break;
+        cursor = end + 1;
+    }
+    return false;
+}
+
+static void subghz_decode_raw_batch_rx_callback(
+    SubGhzReceiver* receiver,
+    SubGhzProtocolDecoderBase* decoder_base,
+    void* context) {
+    SubGhzDecodeRawBatch* instance = context;
+    instance->packet_count++;
+
+    const char* name = decoder_base->protocol->name;
+    if(!subghz_decode_raw_batch_has_protocol(instance->protocols, name)) {
+        if(furi_string_size(instance->protocols)) furi_string_push_back(instance->protocols, ',');
+        furi_string_cat_str(instance->protocols, name);
+    }
+    subghz_receiver_reset(receiver);
+}
+
+SubGhzDecodeRawBatch* subghz_decode_raw_batch_alloc(SubGhzEnvironment* environment) {
+    SubGhzDecodeRawBatch* instance = malloc(sizeof(SubGhzDecodeRawBatch));
+
+    instance->thread = furi_thread_alloc_ex(
+        "SubGhzDecodeRawBatch", 2048, subghz_decode_raw_batch_thread, instance);
+    instance->stream =
+        furi_stream_buffer_alloc(SUBGHZ_DECODE_RAW_BATCH_STREAM_SIZE, sizeof(int32_t));
+    instance->job_queue = furi_message_queue_alloc(
+        SUBGHZ_DECODE_RAW_BATCH_QUEUE_SIZE, sizeof(SubGhzDecodeRawBatchJob));
+    instance->path = furi_string_alloc();
+    instance->line = furi_string_alloc();
+    instance->protocols = furi_string_alloc();
+
+    instance->receiver = subghz_receiver_alloc_init(environment);
+    subghz_receiver_set_filter(instance->receiver, SubGhzProtocolFlag_Decodable);
+    subghz_receiver_set_rx_callback(
+        instance->receiver, subghz_decode_raw_batch_rx_callback, instance);
+
+    return instance;
+}
+
+void subghz_decode_raw_batch_free(SubGhzDecodeRawBatch* instance) {
+    furi_assert(instance);
+    furi_assert(!instance->running);
+
+    subghz_receiver_free(instance->receiver);
+    furi_string_free(instance->protocols);
+    furi_string_free(instance->line);
+    furi_string_free(instance->path);
+    furi_message_queue_free(instance->job_queue);
+    furi_stream_buffer_free(instance->stream);
+    furi_thread_free(instance->thread);
+
+    free(instance);
+}
+
+size_t subghz_decode_raw_batch_run(
+    SubGhzDecodeRawBatch* instance,
+    const char* path,
+    SubGhzDecodeRawBatchCallback callback,
+    void* context) {
+    furi_assert(instance);
+    furi_assert(path);
+
+    furi_string_set(instance->path, path);
+    furi_stream_buffer_reset(instance->stream);
+    instance->read_count = 0;
+    instance->decode_bytes = 0;
+    instance->decode_pos = 0;
+    instance->running = true;
+    furi_thread_start(instance->thread);
+
+    size_t file_count = 0;
+    SubGhzDecodeRawBatchJob job;
+    while(furi_message_queue_get(instance->job_queue, &job, FuriWaitForever) == FuriStatusOk) {
+        if(!job.file_name) break;
+
+        SubGhzDecodeRawBatchResult result = {
+            .file_name = furi_string_get_cstr(job.file_name),
+            .is_valid = job.is_valid,
+            .protocols = "",
+        };
+        if(job.is_valid) subghz_decode_raw_batch_decode_file(instance, &result);
+        file_count++;
+
+        bool next = callback ? callback(&result, context) : true;
+        furi_string_free(job.file_name);
+        if(!next) break;
+    }
+
+    // Reader gives up on its next blocking call, drop whatever it managed to queue
+    instance->running = false;
+    furi_thread_join(instance->thread);
+    while(furi_message_queue_get(instance->job_queue, &job, 0) == FuriStatusOk) {
+        if(job.file_name) furi_string_free(job.file_name);
+    }
+    furi_stream_buffer_reset(instance->stream);
+
+    return file_count;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <furi.h>
+#include <lib/subghz/environment.h>
+
+typedef struct SubGhzDecodeRawBatch SubGhzDecodeRawBatch;
+
+typedef struct {
+    const char* file_name;
+    bool is_valid; // false if the file is not a RAW capture or can't be parsed
+    const char* protocols; // comma separated list of decoded protocols
+    size_t packet_count;
+    size_t edge_count;
+    uint32_t decode_time; // ms
+} SubGhzDecodeRawBatchResult;
+
+/** Result callback, called on the decode thread after every file
+ *
+ * @param result - SubGhzDecodeRawBatchResult, valid only during the call
+ * @param context
+ * @return false to stop the batch
+ */
+typedef bool (
+    *SubGhzDecodeRawBatchCallback)(const SubGhzDecodeRawBatchResult* result, void* context);
+
+/** Allocate SubGhzDecodeRawBatch
+ *
+ * @param environment SubGhzEnvironment used by the receiver
+ * @return SubGhzDecodeRawBatch*
+ */
+SubGhzDecodeRawBatch* subghz_decode_raw_batch_alloc(SubGhzEnvironment* environment);
+
+/** Free SubGhzDecodeRawBatch
+ *
+ * @param instance SubGhzDecodeRawBatch instance
+ */
+void subghz_decode_raw_batch_free(SubGhzDecodeRawBatch* instance);
+
+/** Decode every RAW capture in a directory
+ * Files are read and parsed on a worker thread while the calling thread feeds the receiver
+ *
+ * @param instance SubGhzDecodeRawBatch instance
+ * @param path Directory to walk, recursively
+ * @param callback SubGhzDecodeRawBatchCallback
+ * @param context
+ * @return number of processed files
+ */
+size_t subghz_decode_raw_batch_run(
+    SubGhzDecodeRawBatch* instance,
+    const char* path,
+    SubGhzDecodeRawBatchCallback callback,
+    void* context);
@@ -6,6 +6,9 @@
 
 #define TAG "SubGhz"
 
+// Remotes repeat a frame for as long as the button is held
+#define SUBGHZ_TXRX_REPEAT_WINDOW 500
+
 static void subghz_txrx_radio_device_power_on(SubGhzTxRx* instance) {
     UNUSED(instance);
     uint8_t attempts = 5;
@@ -58,6 +61,7 @@ SubGhzTxRx* subghz_txrx_alloc() {
     subghz_environment_set_protocol_registry(
         instance->environment, (void*)&subghz_protocol_registry);
     instance->receiver = subghz_receiver_alloc_init(instance->environment);
+    subghz_receiver_set_repeat_filter(instance->receiver, SUBGHZ_TXRX_REPEAT_WINDOW);
 
     subghz_worker_set_overrun_callback(
         instance->worker, (SubGhzWorkerOverrunCallback)subghz_receiver_reset);
@@ -176,9 +180,9 @@ static uint32_t subghz_txrx_rx(SubGhzTxRx* instance, uint32_t frequency) {
     subghz_devices_flush_rx(instance->radio_device);
     subghz_txrx_speaker_on(instance);
 
+    subghz_worker_start(instance->worker);
     subghz_devices_start_async_rx(
         instance->radio_device, subghz_worker_rx_callback, instance->worker);
-    subghz_worker_start(instance->worker);
     instance->txrx_state = SubGhzTxRxStateRx;
     return value;
 }
@@ -197,8 +201,8 @@ static void subghz_txrx_rx_end(SubGhzTxRx* instance) {
     furi_assert(instance->txrx_state == SubGhzTxRxStateRx);
 
     if(subghz_worker_is_running(instance->worker)) {
-        subghz_worker_stop(instance->worker);
         subghz_devices_stop_async_rx(instance->radio_device);
+        subghz_worker_stop(instance->worker);
     }
     subghz_devices_idle(instance->radio_device);
     subghz_txrx_speaker_off(instance);
@@ -9,6 +9,7 @@ enum SubGhzSettingIndex {
     SubGhzSettingIndexSound,
     SubGhzSettingIndexLock,
     SubGhzSettingIndexRAWThesholdRSSI,
+    SubGhzSettingIndexRAWFormat,
 };
 
 #define RAW_THRESHOLD_RSSI_COUNT 11
@@ -59,6 +60,12 @@ const uint32_t speaker_value[SPEAKER_COUNT] = {
     SubGhzSpeakerStateShutdown,
     SubGhzSpeakerStateEnable,
 };
+#define RAW_FORMAT_COUNT 2
+const char* const raw_format_text[RAW_FORMAT_COUNT] = {
+    "Text",
+    "Binary",
+};
+
 #define BIN_RAW_COUNT 2
 const char* const bin_raw_text[BIN_RAW_COUNT] = {
     "OFF",
@@ -231,6 +238,14 @@ static void subghz_scene_receiver_config_set_raw_threshold_rssi(VariableItem* it
     subghz_threshold_rssi_set(subghz->threshold_rssi, raw_theshold_rssi_value[index]);
 }
 
+static void subghz_scene_receiver_config_set_raw_format(VariableItem* item) {
+    SubGhz* subghz = variable_item_get_context(item);
+    uint8_t index = variable_item_get_current_value_index(item);
+
+    variable_item_set_current_value_text(item, raw_format_text[index]);
+    subghz->raw_binary = (index == 1);
+}
+
 static void subghz_scene_receiver_config_var_list_enter_callback(void* context, uint32_t index) {
     furi_assert(context);
     SubGhz* subghz = context;
@@ -339,6 +354,16 @@ void subghz_scene_receiver_config_on_enter(void* context) {
             RAW_THRESHOLD_RSSI_COUNT);
         variable_item_set_current_value_index(item, value_index);
         variable_item_set_current_value_text(item, raw_theshold_rssi_text[value_index]);
+
+        item = variable_item_list_add(
+            subghz->variable_item_list,
+            "RAW Format:",
+            RAW_FORMAT_COUNT,
+            subghz_scene_receiver_config_set_raw_format,
+            subghz);
+        value_index = subghz->raw_binary ? 1 : 0;
+        variable_item_set_current_value_index(item, value_index);
+        variable_item_set_current_value_text(item, raw_format_text[value_index]);
     }
     view_dispatcher_switch_to_view(subghz->view_dispatcher, SubGhzViewIdVariableItemList);
 }
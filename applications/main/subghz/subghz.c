@@ -138,6 +138,7 @@ SubGhz* subghz_alloc() {
     subghz_rx_key_state_set(subghz, SubGhzRxKeyStateIDLE);
     subghz->history = subghz_history_alloc();
     subghz->filter = SubGhzProtocolFlag_Decodable;
+    subghz->raw_binary = false;
 
     //init TxRx & History & KeyBoard
     subghz->txrx = subghz_txrx_alloc();
@@ -16,6 +16,7 @@
 #include <lib/subghz/devices/cc1101_configs.h>
 
 #include "helpers/subghz_chat.h"
+#include "helpers/subghz_decode_raw_batch.h"
 
 #include <notification/notification_messages.h>
 #include <flipper_format/flipper_format_i.h>
@@ -465,6 +466,75 @@ void subghz_cli_command_rx_raw(Cli* cli, FuriString* args, void* context) {
     free(instance);
 }
 
+static SubGhzEnvironment* subghz_cli_decode_raw_environment_alloc() {
+    SubGhzEnvironment* environment = subghz_environment_alloc();
+    if(subghz_environment_load_keystore(environment, SUBGHZ_KEYSTORE_DIR_NAME)) {
+        printf("SubGhz decode_raw: Load_keystore keeloq_mfcodes \033[0;32mOK\033[0m\r\n");
+    } else {
+        printf("SubGhz decode_raw: Load_keystore keeloq_mfcodes \033[0;31mERROR\033[0m\r\n");
+    }
+    if(subghz_environment_load_keystore(environment, SUBGHZ_KEYSTORE_DIR_USER_NAME)) {
+        printf("SubGhz decode_raw: Load_keystore keeloq_mfcodes_user \033[0;32mOK\033[0m\r\n");
+    } else {
+        printf("SubGhz decode_raw: Load_keystore keeloq_mfcodes_user \033[0;31mERROR\033[0m\r\n");
+    }
+    subghz_environment_set_came_atomo_rainbow_table_file_name(
+        environment, SUBGHZ_CAME_ATOMO_DIR_NAME);
+    subghz_environment_set_alutech_at_4n_rainbow_table_file_name(
+        environment, SUBGHZ_ALUTECH_AT_4N_DIR_NAME);
+    subghz_environment_set_nice_flor_s_rainbow_table_file_name(
+        environment, SUBGHZ_NICE_FLOR_S_DIR_NAME);
+    subghz_environment_set_protocol_registry(environment, (void*)&subghz_protocol_registry);
+    return environment;
+}
+
+typedef struct {
+    Cli* cli;
+    size_t packet_count;
+    size_t edge_count;
+} SubGhzCliCommandDecodeRawBatch;
+
+static bool subghz_cli_command_decode_raw_batch_callback(
+    const SubGhzDecodeRawBatchResult* result,
+    void* context) {
+    SubGhzCliCommandDecodeRawBatch* instance = context;
+    instance->packet_count += result->packet_count;
+    instance->edge_count += result->edge_count;
+
+    // One tab separated line per file: file, status, packets, edges, edges/s, protocols
+    uint32_t edges_per_sec =
+        (uint64_t)result->edge_count * 1000 / MAX(result->decode_time, (uint32_t)1);
+    printf(
+        "%s\t%s\t%zu\t%zu\t%lu\t%s\r\n",
+        result->file_name,
+        result->is_valid ? "ok" : "skip",
+        result->packet_count,
+        result->edge_count,
+        edges_per_sec,
+        result->protocols);
+    return !cli_cmd_interrupt_received(instance->cli);
+}
+
+static void subghz_cli_command_decode_raw_batch(Cli* cli, const char* path) {
+    SubGhzCliCommandDecodeRawBatch instance = {.cli = cli};
+    SubGhzEnvironment* environment = subghz_cli_decode_raw_environment_alloc();
+    SubGhzDecodeRawBatch* batch = subghz_decode_raw_batch_alloc(environment);
+
+    printf("file\tstatus\tpackets\tedges\tedges_per_sec\tprotocols\r\n");
+    uint32_t start = furi_get_tick();
+    size_t file_count = subghz_decode_raw_batch_run(
+        batch, path, subghz_cli_command_decode_raw_batch_callback, &instance);
+    printf(
+        "total\t%zu files\t%zu\t%zu\t%lu ms\r\n",
+        file_count,
+        instance.packet_count,
+        instance.edge_count,
+        furi_get_tick() - start);
+
+    subghz_decode_raw_batch_free(batch);
+    subghz_environment_free(environment);
+}
+
 void subghz_cli_command_decode_raw(Cli* cli, FuriString* args, void* context) {
     UNUSED(context);
     FuriString* file_name;
@@ -482,11 +552,19 @@ void subghz_cli_command_decode_raw(Cli* cli, FuriString* args, void* context) {
         if(furi_string_size(args)) {
             if(!args_read_string_and_trim(args, file_name)) {
                 cli_print_usage(
-                    "subghz decode_raw", "<file_name: path_RAW_file>", furi_string_get_cstr(args));
+                    "subghz decode_raw",
+                    "<file_name: path_RAW_file or directory>",
+                    furi_string_get_cstr(args));
                 break;
             }
         }
 
+        if(storage_dir_exists(storage, furi_string_get_cstr(file_name))) {
+            // Batch mode, the directory is decoded right here
+            subghz_cli_command_decode_raw_batch(cli, furi_string_get_cstr(file_name));
+            break;
+        }
+
         if(!flipper_format_file_open_existing(fff_data_file, furi_string_get_cstr(file_name))) {
             printf(
                 "subghz decode_raw \033[0;31mError open file\033[0m %s\r\n",
@@ -500,7 +578,7 @@ void subghz_cli_command_decode_raw(Cli* cli, FuriString* args, void* context) {
         }
 
         if(!strcmp(furi_string_get_cstr(temp_str), SUBGHZ_RAW_FILE_TYPE) &&
-           temp_data32 == SUBGHZ_KEY_FILE_VERSION) {
+           temp_data32 == SUBGHZ_RAW_FILE_VERSION) {
         } else {
             printf("subghz decode_raw \033[0;31mType or version mismatch\033[0m\r\n");
             break;
@@ -517,25 +595,7 @@ void subghz_cli_command_decode_raw(Cli* cli, FuriString* args, void* context) {
         // Allocate context
         SubGhzCliCommandRx* instance = malloc(sizeof(SubGhzCliCommandRx));
 
-        SubGhzEnvironment* environment = subghz_environment_alloc();
-        if(subghz_environment_load_keystore(environment, SUBGHZ_KEYSTORE_DIR_NAME)) {
-            printf("SubGhz decode_raw: Load_keystore keeloq_mfcodes \033[0;32mOK\033[0m\r\n");
-        } else {
-            printf("SubGhz decode_raw: Load_keystore keeloq_mfcodes \033[0;31mERROR\033[0m\r\n");
-        }
-        if(subghz_environment_load_keystore(environment, SUBGHZ_KEYSTORE_DIR_USER_NAME)) {
-            printf("SubGhz decode_raw: Load_keystore keeloq_mfcodes_user \033[0;32mOK\033[0m\r\n");
-        } else {
-            printf(
-                "SubGhz decode_raw: Load_keystore keeloq_mfcodes_user \033[0;31mERROR\033[0m\r\n");
-        }
-        subghz_environment_set_came_atomo_rainbow_table_file_name(
-            environment, SUBGHZ_CAME_ATOMO_DIR_NAME);
-        subghz_environment_set_alutech_at_4n_rainbow_table_file_name(
-            environment, SUBGHZ_ALUTECH_AT_4N_DIR_NAME);
-        subghz_environment_set_nice_flor_s_rainbow_table_file_name(
-            environment, SUBGHZ_NICE_FLOR_S_DIR_NAME);
-        subghz_environment_set_protocol_registry(environment, (void*)&subghz_protocol_registry);
+        SubGhzEnvironment* environment = subghz_cli_decode_raw_environment_alloc();
 
         SubGhzReceiver* receiver = subghz_receiver_alloc_init(environment);
         subghz_receiver_set_filter(receiver, SubGhzProtocolFlag_Decodable);
@@ -591,7 +651,9 @@ static void subghz_cli_command_print_usage() {
         "\ttx <3 byte Key: in hex> <frequency: in Hz> <te: us> <repeat: count> <device: 0 - CC1101_INT, 1 - CC1101_EXT>\t - Transmitting key\r\n");
     printf("\trx <frequency:in Hz> <device: 0 - CC1101_INT, 1 - CC1101_EXT>\t - Receive\r\n");
     printf("\trx_raw <frequency:in Hz>\t - Receive RAW\r\n");
-    printf("\tdecode_raw <file_name: path_RAW_file>\t - Testing\r\n");
+    printf("\tdecode_raw <file_name: path_RAW_file or directory>\t - Testing\r\n");
+    printf(
+        "\tconvert_raw <path_RAW_file> <path_output_file> <format: bin, text>\t - Convert RAW data format\r\n");
 
     if(furi_hal_rtc_is_flag_set(FuriHalRtcFlagDebug)) {
         printf("\r\n");
@@ -685,6 +747,47 @@ static void subghz_cli_command_encrypt_raw(Cli* cli, FuriString* args) {
     furi_string_free(source);
 }
 
+static void subghz_cli_command_convert_raw(Cli* cli, FuriString* args) {
+    UNUSED(cli);
+
+    FuriString* source;
+    FuriString* destination;
+    FuriString* format;
+    source = furi_string_alloc();
+    destination = furi_string_alloc();
+    format = furi_string_alloc();
+
+    do {
+        if(!args_read_string_and_trim(args, source) ||
+           !args_read_string_and_trim(args, destination) ||
+           !args_read_string_and_trim(args, format)) {
+            subghz_cli_command_print_usage();
+            break;
+        }
+
+        bool binary;
+        if(furi_string_cmp_str(format, "bin") == 0) {
+            binary = true;
+        } else if(furi_string_cmp_str(format, "text") == 0) {
+            binary = false;
+        } else {
+            subghz_cli_command_print_usage();
+            break;
+        }
+
+        if(!subghz_protocol_raw_convert_file(
+               furi_string_get_cstr(source), furi_string_get_cstr(destination), binary)) {
+            printf("Failed to convert RAW file\r\n");
+            break;
+        }
+        printf("Converted to %s\r\n", furi_string_get_cstr(destination));
+    } while(false);
+
+    furi_string_free(format);
+    furi_string_free(destination);
+    furi_string_free(source);
+}
+
 static void subghz_cli_command_chat(Cli* cli, FuriString* args) {
     uint32_t frequency = 433920000;
     uint32_t device_ind = 0; // 0 - CC1101_INT, 1 - CC1101_EXT
@@ -915,6 +1018,11 @@ static void subghz_cli_command(Cli* cli, FuriString* args, void* context) {
             break;
         }
 
+        if(furi_string_cmp_str(cmd, "convert_raw") == 0) {
+            subghz_cli_command_convert_raw(cli, args);
+            break;
+        }
+
         if(furi_hal_rtc_is_flag_set(FuriHalRtcFlagDebug)) {
             if(furi_string_cmp_str(cmd, "encrypt_keeloq") == 0) {
                 subghz_cli_command_encrypt_keeloq(cli, args);
@@ -1,92 +1,205 @@
 #include "subghz_history.h"
 #include <lib/subghz/receiver.h>
-#include <lib/subghz/protocols/came.h>
+#include <lib/subghz/subghz_protocol_registry.h>
+#include <flipper_format/flipper_format_i.h>
+#include <toolbox/stream/file_stream.h>
+#include <storage/storage.h>
 
 #include <furi.h>
 
-#define SUBGHZ_HISTORY_MAX 50
+#define SUBGHZ_HISTORY_MAX 4096
+#define SUBGHZ_HISTORY_RAM_MAX 32
 #define SUBGHZ_HISTORY_FREE_HEAP 20480
+#define SUBGHZ_HISTORY_LABEL_SIZE 32
+#define SUBGHZ_HISTORY_PROTOCOL_UNKNOWN UINT16_MAX
+#define SUBGHZ_HISTORY_RECORD_PATH SUBGHZ_RAW_FOLDER "/.history.rec"
+#define SUBGHZ_HISTORY_DATA_PATH SUBGHZ_RAW_FOLDER "/.history.dat"
 #define TAG "SubGhzHistory"
 
+/** Fixed-size history record, also the on-disk layout of the record file */
 typedef struct {
-    FuriString* item_str;
-    FlipperFormat* flipper_string;
+    uint32_t timestamp;
+    uint32_t frequency;
+    uint64_t key;
+    uint32_t data_offset;
+    uint32_t data_size;
+    uint16_t protocol_index;
+    uint16_t bit_count;
+    uint8_t preset_index;
     uint8_t type;
-    SubGhzRadioPreset* preset;
-} SubGhzHistoryItem;
+    char label[SUBGHZ_HISTORY_LABEL_SIZE];
+} SubGhzHistoryRecord;
 
-ARRAY_DEF(SubGhzHistoryItemArray, SubGhzHistoryItem, M_POD_OPLIST)
+/** Item kept in RAM until it is spilled to SD */
+typedef struct {
+    SubGhzHistoryRecord record;
+    FlipperFormat* flipper_string;
+} SubGhzHistoryItem;
 
-#define M_OPL_SubGhzHistoryItemArray_t() ARRAY_OPLIST(SubGhzHistoryItemArray, M_POD_OPLIST)
+ARRAY_DEF(SubGhzHistoryPresetArray, SubGhzRadioPreset, M_POD_OPLIST)
 
-typedef struct {
-    SubGhzHistoryItemArray_t data;
-} SubGhzHistoryStruct;
+#define M_OPL_SubGhzHistoryPresetArray_t() ARRAY_OPLIST(SubGhzHistoryPresetArray, M_POD_OPLIST)
 
 struct SubGhzHistory {
-    uint32_t last_update_timestamp;
+    FuriMutex* mutex;
     uint16_t last_index_write;
-    uint8_t code_last_hash_data;
+    bool storage_error;
+
+    // Items [0, spilled) live on SD, the rest in the RAM window
+    SubGhzHistoryItem window[SUBGHZ_HISTORY_RAM_MAX];
+    uint16_t spilled;
+    uint32_t data_size;
+
+    Storage* storage;
+    Stream* record_stream;
+    Stream* data_stream;
+
+    SubGhzHistoryPresetArray_t presets;
+    SubGhzHistoryRecord read_record;
+    uint16_t read_record_idx;
+
     FuriString* tmp_string;
-    SubGhzHistoryStruct* history;
+    FlipperFormat* tmp_flipper;
 };
 
 SubGhzHistory* subghz_history_alloc(void) {
     SubGhzHistory* instance = malloc(sizeof(SubGhzHistory));
+    instance->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    instance->storage = furi_record_open(RECORD_STORAGE);
+    instance->read_record_idx = UINT16_MAX;
+    SubGhzHistoryPresetArray_init(instance->presets);
     instance->tmp_string = furi_string_alloc();
-    instance->history = malloc(sizeof(SubGhzHistoryStruct));
-    SubGhzHistoryItemArray_init(instance->history->data);
+    instance->tmp_flipper = flipper_format_string_alloc();
     return instance;
 }
 
+static void subghz_history_close_files(SubGhzHistory* instance) {
+    if(instance->record_stream) {
+        file_stream_close(instance->record_stream);
+        stream_free(instance->record_stream);
+        instance->record_stream = NULL;
+        storage_simply_remove(instance->storage, SUBGHZ_HISTORY_RECORD_PATH);
+    }
+    if(instance->data_stream) {
+        file_stream_close(instance->data_stream);
+        stream_free(instance->data_stream);
+        instance->data_stream = NULL;
+        storage_simply_remove(instance->storage, SUBGHZ_HISTORY_DATA_PATH);
+    }
+}
+
+static void subghz_history_clear(SubGhzHistory* instance) {
+    for(uint16_t i = instance->spilled; i < instance->last_index_write; i++) {
+        SubGhzHistoryItem* item = &instance->window[i % SUBGHZ_HISTORY_RAM_MAX];
+        flipper_format_free(item->flipper_string);
+        item->flipper_string = NULL;
+    }
+    subghz_history_close_files(instance);
+    for
+        M_EACH(preset, instance->presets, SubGhzHistoryPresetArray_t) {
+            furi_string_free(preset->name);
+        }
+    SubGhzHistoryPresetArray_reset(instance->presets);
+    instance->last_index_write = 0;
+    instance->spilled = 0;
+    instance->data_size = 0;
+    instance->storage_error = false;
+    instance->read_record_idx = UINT16_MAX;
+}
+
 void subghz_history_free(SubGhzHistory* instance) {
     furi_assert(instance);
+    subghz_history_clear(instance);
+    SubGhzHistoryPresetArray_clear(instance->presets);
+    flipper_format_free(instance->tmp_flipper);
     furi_string_free(instance->tmp_string);
-    for
-        M_EACH(item, instance->history->data, SubGhzHistoryItemArray_t) {
-            furi_string_free(item->item_str);
-            furi_string_free(item->preset->name);
-            free(item->preset);
-            flipper_format_free(item->flipper_string);
-            item->type = 0;
-        }
-    SubGhzHistoryItemArray_clear(instance->history->data);
-    free(instance->history);
+    furi_record_close(RECORD_STORAGE);
+    furi_mutex_free(instance->mutex);
     free(instance);
 }
 
-uint32_t subghz_history_get_frequency(SubGhzHistory* instance, uint16_t idx) {
+void subghz_history_reset(SubGhzHistory* instance) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->preset->frequency;
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    subghz_history_clear(instance);
+    furi_string_reset(instance->tmp_string);
+    furi_mutex_release(instance->mutex);
 }
 
-SubGhzRadioPreset* subghz_history_get_radio_preset(SubGhzHistory* instance, uint16_t idx) {
+/** Get record for idx, must be called with mutex held */
+static const SubGhzHistoryRecord*
+    subghz_history_get_record(SubGhzHistory* instance, uint16_t idx) {
+    furi_check(idx < instance->last_index_write);
+    if(idx >= instance->spilled) {
+        return &instance->window[idx % SUBGHZ_HISTORY_RAM_MAX].record;
+    }
+
+    if(instance->read_record_idx != idx) {
+        memset(&instance->read_record, 0, sizeof(SubGhzHistoryRecord));
+        instance->read_record_idx = UINT16_MAX;
+        if(stream_seek(
+               instance->record_stream,
+               idx * sizeof(SubGhzHistoryRecord),
+               StreamOffsetFromStart) &&
+           stream_read(
+               instance->record_stream,
+               (uint8_t*)&instance->read_record,
+               sizeof(SubGhzHistoryRecord)) == sizeof(SubGhzHistoryRecord)) {
+            instance->read_record_idx = idx;
+        } else {
+            FURI_LOG_E(TAG, "Record %u read error", idx);
+        }
+    }
+    return &instance->read_record;
+}
+
+static const SubGhzRadioPreset*
+    subghz_history_get_preset_by_index(SubGhzHistory* instance, uint8_t preset_index) {
+    if(preset_index >= SubGhzHistoryPresetArray_size(instance->presets)) return NULL;
+    return SubGhzHistoryPresetArray_cget(instance->presets, preset_index);
+}
+
+uint32_t subghz_history_get_frequency(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->preset;
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    uint32_t frequency = subghz_history_get_record(instance, idx)->frequency;
+    furi_mutex_release(instance->mutex);
+    return frequency;
 }
 
-const char* subghz_history_get_preset(SubGhzHistory* instance, uint16_t idx) {
+void subghz_history_get_radio_preset(
+    SubGhzHistory* instance,
+    uint16_t idx,
+    SubGhzRadioPreset* radio_preset) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return furi_string_get_cstr(item->preset->name);
+    furi_assert(radio_preset);
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    const SubGhzHistoryRecord* record = subghz_history_get_record(instance, idx);
+    const SubGhzRadioPreset* preset =
+        subghz_history_get_preset_by_index(instance, record->preset_index);
+    radio_preset->frequency = record->frequency;
+    if(preset) {
+        furi_string_set(radio_preset->name, preset->name);
+        // Preset data is only released on reset
+        radio_preset->data = preset->data;
+        radio_preset->data_size = preset->data_size;
+    } else {
+        furi_string_reset(radio_preset->name);
+        radio_preset->data = NULL;
+        radio_preset->data_size = 0;
+    }
+    furi_mutex_release(instance->mutex);
 }
 
-void subghz_history_reset(SubGhzHistory* instance) {
+const char* subghz_history_get_preset(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    furi_string_reset(instance->tmp_string);
-    for
-        M_EACH(item, instance->history->data, SubGhzHistoryItemArray_t) {
-            furi_string_free(item->item_str);
-            furi_string_free(item->preset->name);
-            free(item->preset);
-            flipper_format_free(item->flipper_string);
-            item->type = 0;
-        }
-    SubGhzHistoryItemArray_reset(instance->history->data);
-    instance->last_index_write = 0;
-    instance->code_last_hash_data = 0;
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    const SubGhzHistoryRecord* record = subghz_history_get_record(instance, idx);
+    const SubGhzRadioPreset* preset =
+        subghz_history_get_preset_by_index(instance, record->preset_index);
+    furi_mutex_release(instance->mutex);
+    // Preset names are only released on reset
+    return preset ? furi_string_get_cstr(preset->name) : "";
 }
 
 uint16_t subghz_history_get_item(SubGhzHistory* instance) {
@@ -96,144 +209,251 @@ uint16_t subghz_history_get_item(SubGhzHistory* instance) {
 
 uint8_t subghz_history_get_type_protocol(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->type;
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    uint8_t type = subghz_history_get_record(instance, idx)->type;
+    furi_mutex_release(instance->mutex);
+    return type;
 }
 
 const char* subghz_history_get_protocol_name(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    flipper_format_rewind(item->flipper_string);
-    if(!flipper_format_read_string(item->flipper_string, "Protocol", instance->tmp_string)) {
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    uint16_t protocol_index = subghz_history_get_record(instance, idx)->protocol_index;
+    furi_mutex_release(instance->mutex);
+
+    if(protocol_index == SUBGHZ_HISTORY_PROTOCOL_UNKNOWN) {
         FURI_LOG_E(TAG, "Missing Protocol");
-        furi_string_reset(instance->tmp_string);
+        return "";
     }
-    return furi_string_get_cstr(instance->tmp_string);
+    return subghz_protocol_registry_get_by_index(&subghz_protocol_registry, protocol_index)
+        ->name;
 }
 
 FlipperFormat* subghz_history_get_raw_data(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    if(item->flipper_string) {
-        return item->flipper_string;
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    FlipperFormat* result = NULL;
+    Stream* dst = flipper_format_get_raw_stream(instance->tmp_flipper);
+    stream_clean(dst);
+
+    // Always hand out a private copy: the RAM window item may be spilled at any moment
+    furi_check(idx < instance->last_index_write);
+    if(idx >= instance->spilled) {
+        SubGhzHistoryItem* item = &instance->window[idx % SUBGHZ_HISTORY_RAM_MAX];
+        Stream* src = flipper_format_get_raw_stream(item->flipper_string);
+        stream_rewind(src);
+        if(stream_copy_full(src, dst) == stream_size(src)) result = instance->tmp_flipper;
     } else {
-        return NULL;
+        const SubGhzHistoryRecord* record = subghz_history_get_record(instance, idx);
+        if(stream_seek(instance->data_stream, record->data_offset, StreamOffsetFromStart) &&
+           stream_copy(instance->data_stream, dst, record->data_size) == record->data_size) {
+            result = instance->tmp_flipper;
+        } else {
+            FURI_LOG_E(TAG, "Data %u read error", idx);
+        }
     }
+
+    if(result) flipper_format_rewind(result);
+    furi_mutex_release(instance->mutex);
+    return result;
 }
+
 bool subghz_history_get_text_space_left(SubGhzHistory* instance, FuriString* output) {
     furi_assert(instance);
     if(memmgr_get_free_heap() < SUBGHZ_HISTORY_FREE_HEAP) {
         if(output != NULL) furi_string_printf(output, "    Free heap LOW");
         return true;
     }
-    if(instance->last_index_write == SUBGHZ_HISTORY_MAX) {
+    if(instance->last_index_write == SUBGHZ_HISTORY_MAX || instance->storage_error) {
         if(output != NULL) furi_string_printf(output, "   Memory is FULL");
         return true;
     }
-    if(output != NULL)
-        furi_string_printf(output, "%02u/%02u", instance->last_index_write, SUBGHZ_HISTORY_MAX);
+    if(output != NULL) furi_string_printf(output, "%04u", instance->last_index_write);
     return false;
 }
 
 void subghz_history_get_text_item_menu(SubGhzHistory* instance, FuriString* output, uint16_t idx) {
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    furi_string_set(output, item->item_str);
+    furi_assert(instance);
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    furi_string_set(output, subghz_history_get_record(instance, idx)->label);
+    furi_mutex_release(instance->mutex);
 }
 
-bool subghz_history_add_to_history(
-    SubGhzHistory* instance,
-    void* context,
-    SubGhzRadioPreset* preset) {
-    furi_assert(instance);
-    furi_assert(context);
+/** Move the oldest RAM window item to SD, must be called with mutex held */
+static bool subghz_history_spill(SubGhzHistory* instance) {
+    if(instance->storage_error) return false;
 
-    if(memmgr_get_free_heap() < SUBGHZ_HISTORY_FREE_HEAP) return false;
-    if(instance->last_index_write >= SUBGHZ_HISTORY_MAX) return false;
+    if(!instance->record_stream) {
+        storage_simply_mkdir(instance->storage, SUBGHZ_RAW_FOLDER);
+        instance->record_stream = file_stream_alloc(instance->storage);
+        instance->data_stream = file_stream_alloc(instance->storage);
+        if(!file_stream_open(
+               instance->record_stream,
+               SUBGHZ_HISTORY_RECORD_PATH,
+               FSAM_READ_WRITE,
+               FSOM_CREATE_ALWAYS) ||
+           !file_stream_open(
+               instance->data_stream,
+               SUBGHZ_HISTORY_DATA_PATH,
+               FSAM_READ_WRITE,
+               FSOM_CREATE_ALWAYS)) {
+            FURI_LOG_E(TAG, "Unable to open spill files");
+            subghz_history_close_files(instance);
+            instance->storage_error = true;
+            return false;
+        }
+    }
 
-    SubGhzProtocolDecoderBase* decoder_base = context;
-    if((instance->code_last_hash_data ==
-        subghz_protocol_decoder_base_get_hash_data(decoder_base)) &&
-       ((furi_get_tick() - instance->last_update_timestamp) < 500)) {
-        instance->last_update_timestamp = furi_get_tick();
+    SubGhzHistoryItem* item = &instance->window[instance->spilled % SUBGHZ_HISTORY_RAM_MAX];
+    Stream* src = flipper_format_get_raw_stream(item->flipper_string);
+    item->record.data_offset = instance->data_size;
+    item->record.data_size = stream_size(src);
+
+    // Both files are append-only, position is kept at the end between calls
+    stream_rewind(src);
+    if(!stream_seek(instance->data_stream, instance->data_size, StreamOffsetFromStart) ||
+       stream_copy_full(src, instance->data_stream) != item->record.data_size ||
+       !stream_seek(
+           instance->record_stream,
+           instance->spilled * sizeof(SubGhzHistoryRecord),
+           StreamOffsetFromStart) ||
+       stream_write(
+           instance->record_stream,
+           (const uint8_t*)&item->record,
+           sizeof(SubGhzHistoryRecord)) != sizeof(SubGhzHistoryRecord)) {
+        FURI_LOG_E(TAG, "Spill write error");
+        instance->storage_error = true;
         return false;
     }
 
-    instance->code_last_hash_data = subghz_protocol_decoder_base_get_hash_data(decoder_base);
-    instance->last_update_timestamp = furi_get_tick();
+    instance->data_size += item->record.data_size;
+    flipper_format_free(item->flipper_string);
+    item->flipper_string = NULL;
+    instance->spilled++;
+    return true;
+}
 
-    FuriString* text;
-    text = furi_string_alloc();
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_push_raw(instance->history->data);
-    item->preset = malloc(sizeof(SubGhzRadioPreset));
-    item->type = decoder_base->protocol->type;
-    item->preset->frequency = preset->frequency;
-    item->preset->name = furi_string_alloc();
-    furi_string_set(item->preset->name, preset->name);
-    item->preset->data = preset->data;
-    item->preset->data_size = preset->data_size;
+static uint8_t
+    subghz_history_get_preset_index(SubGhzHistory* instance, SubGhzRadioPreset* preset) {
+    size_t index = 0;
+    for
+        M_EACH(item, instance->presets, SubGhzHistoryPresetArray_t) {
+            if(item->data == preset->data && furi_string_equal(item->name, preset->name)) {
+                return index;
+            }
+            index++;
+        }
+    furi_check(index < UINT8_MAX);
+    SubGhzRadioPreset* item = SubGhzHistoryPresetArray_push_raw(instance->presets);
+    item->name = furi_string_alloc_set(preset->name);
+    item->frequency = 0;
+    item->data = preset->data;
+    item->data_size = preset->data_size;
+    return index;
+}
+
+static uint16_t subghz_history_get_protocol_index(const SubGhzProtocol* protocol) {
+    size_t count = subghz_protocol_registry_count(&subghz_protocol_registry);
+    for(size_t i = 0; i < count; i++) {
+        if(subghz_protocol_registry_get_by_index(&subghz_protocol_registry, i) == protocol) {
+            return i;
+        }
+    }
+    return SUBGHZ_HISTORY_PROTOCOL_UNKNOWN;
+}
 
-    item->item_str = furi_string_alloc();
-    item->flipper_string = flipper_format_string_alloc();
-    subghz_protocol_decoder_base_serialize(decoder_base, item->flipper_string, preset);
+static void subghz_history_fill_record(
+    SubGhzHistoryRecord* record,
+    FlipperFormat* flipper_string,
+    const char* protocol_name) {
+    FuriString* text = furi_string_alloc();
+    FuriString* label = furi_string_alloc_set(protocol_name);
 
     do {
-        if(!flipper_format_rewind(item->flipper_string)) {
-            FURI_LOG_E(TAG, "Rewind error");
-            break;
-        }
-        if(!flipper_format_read_string(item->flipper_string, "Protocol", instance->tmp_string)) {
-            FURI_LOG_E(TAG, "Missing Protocol");
-            break;
-        }
-        if(!strcmp(furi_string_get_cstr(instance->tmp_string), "KeeLoq")) {
-            furi_string_set(instance->tmp_string, "KL ");
-            if(!flipper_format_read_string(item->flipper_string, "Manufacture", text)) {
-                FURI_LOG_E(TAG, "Missing Protocol");
+        if(!strcmp(protocol_name, "KeeLoq") || !strcmp(protocol_name, "Star Line")) {
+            furi_string_set(label, protocol_name[0] == 'K' ? "KL " : "SL ");
+            if(!flipper_format_rewind(flipper_string)) {
+                FURI_LOG_E(TAG, "Rewind error");
                 break;
             }
-            furi_string_cat(instance->tmp_string, text);
-        } else if(!strcmp(furi_string_get_cstr(instance->tmp_string), "Star Line")) {
-            furi_string_set(instance->tmp_string, "SL ");
-            if(!flipper_format_read_string(item->flipper_string, "Manufacture", text)) {
-                FURI_LOG_E(TAG, "Missing Protocol");
+            if(!flipper_format_read_string(flipper_string, "Manufacture", text)) {
+                FURI_LOG_E(TAG, "Missing Manufacture");
                 break;
             }
-            furi_string_cat(instance->tmp_string, text);
+            furi_string_cat(label, text);
         }
-        if(!flipper_format_rewind(item->flipper_string)) {
+        if(!flipper_format_rewind(flipper_string)) {
             FURI_LOG_E(TAG, "Rewind error");
             break;
         }
+        uint32_t bit_count = 0;
+        if(flipper_format_read_uint32(flipper_string, "Bit", &bit_count, 1)) {
+            record->bit_count = MIN(bit_count, UINT16_MAX);
+        }
         uint8_t key_data[sizeof(uint64_t)] = {0};
-        if(!flipper_format_read_hex(item->flipper_string, "Key", key_data, sizeof(uint64_t))) {
+        if(!flipper_format_read_hex(flipper_string, "Key", key_data, sizeof(uint64_t))) {
             FURI_LOG_D(TAG, "No Key");
         }
-        uint64_t data = 0;
         for(uint8_t i = 0; i < sizeof(uint64_t); i++) {
-            data = (data << 8) | key_data[i];
+            record->key = (record->key << 8) | key_data[i];
         }
-        if(data != 0) {
-            if(!(uint32_t)(data >> 32)) {
-                furi_string_printf(
-                    item->item_str,
-                    "%s %lX",
-                    furi_string_get_cstr(instance->tmp_string),
-                    (uint32_t)(data & 0xFFFFFFFF));
-            } else {
-                furi_string_printf(
-                    item->item_str,
-                    "%s %lX%08lX",
-                    furi_string_get_cstr(instance->tmp_string),
-                    (uint32_t)(data >> 32),
-                    (uint32_t)(data & 0xFFFFFFFF));
-            }
+    } while(false);
+
+    if(record->key != 0) {
+        if(!(uint32_t)(record->key >> 32)) {
+            furi_string_cat_printf(label, " %lX", (uint32_t)(record->key & 0xFFFFFFFF));
         } else {
-            furi_string_printf(item->item_str, "%s", furi_string_get_cstr(instance->tmp_string));
+            furi_string_cat_printf(
+                label,
+                " %lX%08lX",
+                (uint32_t)(record->key >> 32),
+                (uint32_t)(record->key & 0xFFFFFFFF));
+        }
+    }
+    strncpy(record->label, furi_string_get_cstr(label), SUBGHZ_HISTORY_LABEL_SIZE - 1);
+
+    furi_string_free(label);
+    furi_string_free(text);
+}
+
+bool subghz_history_add_to_history(
+    SubGhzHistory* instance,
+    void* context,
+    SubGhzRadioPreset* preset) {
+    furi_assert(instance);
+    furi_assert(context);
+
+    if(memmgr_get_free_heap() < SUBGHZ_HISTORY_FREE_HEAP) return false;
+    if(instance->last_index_write >= SUBGHZ_HISTORY_MAX) return false;
+
+    // Repeats are already suppressed by the receiver
+    SubGhzProtocolDecoderBase* decoder_base = context;
+
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    bool result = false;
+    do {
+        if(instance->last_index_write - instance->spilled == SUBGHZ_HISTORY_RAM_MAX) {
+            if(!subghz_history_spill(instance)) break;
         }
 
+        SubGhzHistoryItem* item =
+            &instance->window[instance->last_index_write % SUBGHZ_HISTORY_RAM_MAX];
+        memset(&item->record, 0, sizeof(SubGhzHistoryRecord));
+        item->record.timestamp = furi_hal_rtc_get_timestamp();
+        item->record.frequency = preset->frequency;
+        item->record.preset_index = subghz_history_get_preset_index(instance, preset);
+        item->record.protocol_index = subghz_history_get_protocol_index(decoder_base->protocol);
+        item->record.type = decoder_base->protocol->type;
+
+        item->flipper_string = flipper_format_string_alloc();
+        subghz_protocol_decoder_base_serialize(decoder_base, item->flipper_string, preset);
+        subghz_history_fill_record(
+            &item->record, item->flipper_string, decoder_base->protocol->name);
+
+        instance->last_index_write++;
+        result = true;
     } while(false);
+    furi_mutex_release(instance->mutex);
 
-    furi_string_free(text);
-    instance->last_index_write++;
-    return true;
+    return result;
 }
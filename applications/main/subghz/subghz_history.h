@@ -35,7 +35,16 @@ void subghz_history_reset(SubGhzHistory* instance);
  */
 uint32_t subghz_history_get_frequency(SubGhzHistory* instance, uint16_t idx);
 
-SubGhzRadioPreset* subghz_history_get_radio_preset(SubGhzHistory* instance, uint16_t idx);
+/** Copy radio preset of history[idx]
+ * 
+ * @param instance      - SubGhzHistory instance
+ * @param idx           - record index  
+ * @param radio_preset  - SubGhzRadioPreset with allocated name, filled on return
+ */
+void subghz_history_get_radio_preset(
+    SubGhzHistory* instance,
+    uint16_t idx,
+    SubGhzRadioPreset* radio_preset);
 
 /** Get preset to history[idx]
  * 
@@ -97,6 +106,7 @@ bool subghz_history_add_to_history(
     SubGhzRadioPreset* preset);
 
 /** Get SubGhzProtocolCommonLoad to load into the protocol decoder bin data
+ * Returned FlipperFormat is a copy owned by history, valid until the next call
  * 
  * @param instance  - SubGhzHistory instance
  * @param idx       - record index
@@ -62,6 +62,7 @@ struct SubGhz {
     SubGhzReadRAW* subghz_read_raw;
 
     SubGhzProtocolFlag filter;
+    bool raw_binary;
     FuriString* error_str;
     SubGhzLock lock;
     SubGhzThresholdRssi* threshold_rssi;
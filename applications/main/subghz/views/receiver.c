@@ -5,7 +5,6 @@
 #include <input/input.h>
 #include <gui/elements.h>
 #include <assets_icons.h>
-#include <m-array.h>
 
 #define FRAME_HEIGHT 12
 #define MAX_LEN_PX 111
@@ -14,22 +13,6 @@
 
 #define SUBGHZ_RAW_THRESHOLD_MIN -90.0f
 
-typedef struct {
-    FuriString* item_str;
-    uint8_t type;
-} SubGhzReceiverMenuItem;
-
-ARRAY_DEF(SubGhzReceiverMenuItemArray, SubGhzReceiverMenuItem, M_POD_OPLIST)
-
-#define M_OPL_SubGhzReceiverMenuItemArray_t() \
-    ARRAY_OPLIST(SubGhzReceiverMenuItemArray, M_POD_OPLIST)
-
-struct SubGhzReceiverHistory {
-    SubGhzReceiverMenuItemArray_t data;
-};
-
-typedef struct SubGhzReceiverHistory SubGhzReceiverHistory;
-
 static const Icon* ReceiverItemIcons[] = {
     [SubGhzProtocolTypeUnknown] = &I_Quest_7x8,
     [SubGhzProtocolTypeStatic] = &I_Unlock_7x8,
@@ -50,13 +33,20 @@ struct SubGhzViewReceiver {
     View* view;
     SubGhzViewReceiverCallback callback;
     void* context;
+    SubGhzViewReceiverItemCallback item_callback;
+    void* item_context;
 };
 
 typedef struct {
     FuriString* frequency_str;
     FuriString* preset_str;
     FuriString* history_stat_str;
-    SubGhzReceiverHistory* history;
+    // Menu items are not stored in the view, only visible ones are fetched
+    // outside of draw callback, history may have to read them from storage
+    FuriString* item_str[MENU_ITEMS];
+    uint8_t item_type[MENU_ITEMS];
+    uint16_t item_offset;
+    uint16_t item_count;
     uint16_t idx;
     uint16_t list_offset;
     uint16_t history_item;
@@ -111,6 +101,69 @@ void subghz_view_receiver_set_callback(
     subghz_receiver->context = context;
 }
 
+static void subghz_view_receiver_get_items_window(
+    SubGhzViewReceiverModel* model,
+    uint16_t* offset,
+    uint16_t* count) {
+    *count = MIN(model->history_item, MENU_ITEMS);
+    *offset = model->list_offset;
+    if(*offset + *count > model->history_item) *offset = model->history_item - *count;
+}
+
+static void subghz_view_receiver_update_items(SubGhzViewReceiver* subghz_receiver) {
+    // Called from the app and the worker thread, so each call fetches into its own strings
+    FuriString* item_str[MENU_ITEMS];
+    uint8_t type[MENU_ITEMS];
+    for(size_t i = 0; i < MENU_ITEMS; ++i) {
+        item_str[i] = furi_string_alloc();
+    }
+
+    bool updated = false;
+    while(!updated) {
+        uint16_t offset = 0;
+        uint16_t count = 0;
+        with_view_model(
+            subghz_receiver->view,
+            SubGhzViewReceiverModel * model,
+            { subghz_view_receiver_get_items_window(model, &offset, &count); },
+            false);
+
+        // Fetch without model lock held, so draw is never blocked by history
+        for(uint16_t i = 0; i < count; ++i) {
+            furi_string_reset(item_str[i]);
+            type[i] = SubGhzProtocolTypeUnknown;
+            if(subghz_receiver->item_callback) {
+                subghz_receiver->item_callback(
+                    subghz_receiver->item_context, offset + i, item_str[i], &type[i]);
+            }
+        }
+
+        with_view_model(
+            subghz_receiver->view,
+            SubGhzViewReceiverModel * model,
+            {
+                // Window moved meanwhile, fetch again rather than show stale rows
+                uint16_t current_offset = 0;
+                uint16_t current_count = 0;
+                subghz_view_receiver_get_items_window(model, &current_offset, &current_count);
+                if(current_offset == offset && current_count == count) {
+                    for(uint16_t i = 0; i < count; ++i) {
+                        furi_string_swap(model->item_str[i], item_str[i]);
+                        model->item_type[i] = type[i];
+                    }
+                    model->item_offset = offset;
+                    model->item_count = count;
+                    updated = true;
+                }
+            },
+            updated);
+    }
+
+    for(size_t i = 0; i < MENU_ITEMS; ++i) {
+        furi_string_free(item_str[i]);
+    }
+}
+
 static void subghz_view_receiver_update_offset(SubGhzViewReceiver* subghz_receiver) {
     furi_assert(subghz_receiver);
 
@@ -130,22 +183,36 @@ static void subghz_view_receiver_update_offset(SubGhzViewReceiver* subghz_receiv
                 model->list_offset = CLAMP(model->idx - 1, (int16_t)(history_item - bounds), 0);
             }
         },
-        true);
+        false);
+    subghz_view_receiver_update_items(subghz_receiver);
 }
 
-void subghz_view_receiver_add_item_to_menu(
+void subghz_view_receiver_set_item_callback(
     SubGhzViewReceiver* subghz_receiver,
-    const char* name,
-    uint8_t type) {
+    SubGhzViewReceiverItemCallback callback,
+    void* context) {
+    furi_assert(subghz_receiver);
+    furi_assert(callback);
+    subghz_receiver->item_callback = callback;
+    subghz_receiver->item_context = context;
+}
+
+void subghz_view_receiver_set_item_count(SubGhzViewReceiver* subghz_receiver, uint16_t count) {
+    furi_assert(subghz_receiver);
+    with_view_model(
+        subghz_receiver->view,
+        SubGhzViewReceiverModel * model,
+        { model->history_item = count; },
+        true);
+    subghz_view_receiver_update_offset(subghz_receiver);
+}
+
+void subghz_view_receiver_add_item_to_menu(SubGhzViewReceiver* subghz_receiver) {
     furi_assert(subghz_receiver);
     with_view_model(
         subghz_receiver->view,
         SubGhzViewReceiverModel * model,
         {
-            SubGhzReceiverMenuItem* item_menu =
-                SubGhzReceiverMenuItemArray_push_raw(model->history->data);
-            item_menu->item_str = furi_string_alloc_set(name);
-            item_menu->type = type;
             if((model->idx == model->history_item - 1)) {
                 model->history_item++;
                 model->idx++;
@@ -220,21 +287,17 @@ void subghz_view_receiver_draw(Canvas* canvas, SubGhzViewReceiverModel* model) {
     FuriString* str_buff;
     str_buff = furi_string_alloc();
 
-    SubGhzReceiverMenuItem* item_menu;
-
-    for(size_t i = 0; i < MIN(model->history_item, MENU_ITEMS); ++i) {
-        size_t idx = CLAMP((uint16_t)(i + model->list_offset), model->history_item, 0);
-        item_menu = SubGhzReceiverMenuItemArray_get(model->history->data, idx);
-        furi_string_set(str_buff, item_menu->item_str);
+    for(size_t i = 0; i < model->item_count; ++i) {
+        size_t idx = model->item_offset + i;
+        furi_string_set(str_buff, model->item_str[i]);
         elements_string_fit_width(canvas, str_buff, scrollbar ? MAX_LEN_PX - 7 : MAX_LEN_PX);
         if(model->idx == idx) {
             subghz_view_receiver_draw_frame(canvas, i, scrollbar);
         } else {
             canvas_set_color(canvas, ColorBlack);
         }
-        canvas_draw_icon(canvas, 4, 2 + i * FRAME_HEIGHT, ReceiverItemIcons[item_menu->type]);
+        canvas_draw_icon(canvas, 4, 2 + i * FRAME_HEIGHT, ReceiverItemIcons[model->item_type[i]]);
         canvas_draw_str(canvas, 15, 9 + i * FRAME_HEIGHT, furi_string_get_cstr(str_buff));
-        furi_string_reset(str_buff);
     }
     if(scrollbar) {
         elements_scrollbar_pos(canvas, 128, 0, 49, model->idx, model->history_item);
@@ -393,15 +456,11 @@ void subghz_view_receiver_exit(void* context) {
             furi_string_reset(model->frequency_str);
             furi_string_reset(model->preset_str);
             furi_string_reset(model->history_stat_str);
-                for
-                    M_EACH(item_menu, model->history->data, SubGhzReceiverMenuItemArray_t) {
-                        furi_string_free(item_menu->item_str);
-                        item_menu->type = 0;
-                    }
-                SubGhzReceiverMenuItemArray_reset(model->history->data);
-                model->idx = 0;
-                model->list_offset = 0;
-                model->history_item = 0;
+            model->idx = 0;
+            model->list_offset = 0;
+            model->history_item = 0;
+            model->item_offset = 0;
+            model->item_count = 0;
         },
         false);
     furi_timer_stop(subghz_receiver->timer);
@@ -430,9 +489,10 @@ SubGhzViewReceiver* subghz_view_receiver_alloc() {
             model->frequency_str = furi_string_alloc();
             model->preset_str = furi_string_alloc();
             model->history_stat_str = furi_string_alloc();
+            for(size_t i = 0; i < MENU_ITEMS; ++i) {
+                model->item_str[i] = furi_string_alloc();
+            }
             model->bar_show = SubGhzViewReceiverBarShowDefault;
-            model->history = malloc(sizeof(SubGhzReceiverHistory));
-            SubGhzReceiverMenuItemArray_init(model->history->data);
         },
         true);
     subghz_receiver->timer =
@@ -450,13 +510,9 @@ void subghz_view_receiver_free(SubGhzViewReceiver* subghz_receiver) {
             furi_string_free(model->frequency_str);
             furi_string_free(model->preset_str);
             furi_string_free(model->history_stat_str);
-                for
-                    M_EACH(item_menu, model->history->data, SubGhzReceiverMenuItemArray_t) {
-                        furi_string_free(item_menu->item_str);
-                        item_menu->type = 0;
-                    }
-                SubGhzReceiverMenuItemArray_clear(model->history->data);
-                free(model->history);
+            for(size_t i = 0; i < MENU_ITEMS; ++i) {
+                furi_string_free(model->item_str[i]);
+            }
         },
         false);
     furi_timer_free(subghz_receiver->timer);
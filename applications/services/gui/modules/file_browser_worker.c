@@ -7,6 +7,7 @@
 #include <core/check.h>
 #include <core/common_defines.h>
 #include <furi.h>
+#include <furi_hal_rtc.h>
 
 #include <m-array.h>
 #include <stdbool.h>
@@ -19,6 +20,9 @@
 #define FILE_NAME_LEN_MAX 256
 #define LONG_LOAD_THRESHOLD 100
 
+#define SNAPSHOT_NAMES_SIZE_MIN 512
+#define SNAPSHOT_NAMES_SIZE_MAX (32 * 1024)
+
 typedef enum {
     WorkerEvtStop = (1 << 0),
     WorkerEvtLoad = (1 << 1),
@@ -34,6 +38,25 @@ typedef enum {
 
 ARRAY_DEF(idx_last_array, int32_t)
 
+typedef struct {
+    uint32_t name_offset : 31;
+    uint32_t is_dir : 1;
+} BrowserSnapshotItem;
+
+ARRAY_DEF(BrowserSnapshotItemArray, BrowserSnapshotItem, M_POD_OPLIST)
+
+/* Filtered folder listing, built by one directory scan and sliced into pages */
+typedef struct {
+    FuriString* path;
+    BrowserSnapshotItemArray_t items;
+    char* names;
+    size_t names_size;
+    size_t names_capacity;
+    uint32_t timestamp;
+    uint32_t built_at;
+    bool valid;
+} BrowserSnapshot;
+
 struct BrowserWorker {
     FuriThread* thread;
 
@@ -48,6 +71,9 @@ struct BrowserWorker {
     bool hide_dot_files;
     idx_last_array_t idx_last;
 
+    BrowserSnapshot snapshot;
+    volatile bool snapshot_dirty;
+
     void* cb_ctx;
     BrowserWorkerFolderOpenCallback folder_cb;
     BrowserWorkerListLoadCallback list_load_cb;
@@ -107,6 +133,76 @@ static bool browser_filter_by_name(BrowserWorker* browser, FuriString* name, boo
     return false;
 }
 
+static void browser_snapshot_reset(BrowserSnapshot* snapshot, FuriString* path) {
+    furi_string_set(snapshot->path, path);
+    BrowserSnapshotItemArray_reset(snapshot->items);
+    free(snapshot->names);
+    snapshot->names = NULL;
+    snapshot->names_size = 0;
+    snapshot->names_capacity = 0;
+    snapshot->valid = false;
+}
+
+static bool browser_snapshot_push(BrowserSnapshot* snapshot, const char* name, bool is_dir) {
+    const size_t name_size = strlen(name) + 1;
+    const size_t names_size = snapshot->names_size + name_size;
+
+    if(names_size > snapshot->names_capacity) {
+        size_t capacity = MAX(snapshot->names_capacity, (size_t)SNAPSHOT_NAMES_SIZE_MIN);
+        while(capacity < names_size) {
+            capacity *= 2;
+        }
+        if(capacity > SNAPSHOT_NAMES_SIZE_MAX) {
+            return false;
+        }
+        snapshot->names = realloc(snapshot->names, capacity); //-V701
+        snapshot->names_capacity = capacity;
+    }
+
+    memcpy(&snapshot->names[snapshot->names_size], name, name_size);
+    BrowserSnapshotItem item = {
+        .name_offset = snapshot->names_size,
+        .is_dir = is_dir,
+    };
+    BrowserSnapshotItemArray_push_back(snapshot->items, item);
+    snapshot->names_size = names_size;
+    return true;
+}
+
+static bool browser_snapshot_is_current(BrowserWorker* browser, FuriString* path) {
+    BrowserSnapshot* snapshot = &browser->snapshot;
+    if(!snapshot->valid || browser->snapshot_dirty ||
+       (furi_string_cmp(snapshot->path, path) != 0)) {
+        return false;
+    }
+
+    // Storage timestamp has 1 second resolution, changes made in the second the snapshot
+    // was built may not move it, so such a snapshot is rebuilt once
+    if(snapshot->timestamp >= snapshot->built_at) {
+        return false;
+    }
+
+    // Storage timestamp is bumped by every write, removal and rename
+    uint32_t timestamp = 0;
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FS_Error error = storage_common_timestamp(storage, furi_string_get_cstr(path), &timestamp);
+    furi_record_close(RECORD_STORAGE);
+
+    return (error == FSE_OK) && (timestamp == snapshot->timestamp);
+}
+
+static void browser_storage_callback(const void* message, void* context) {
+    const StorageEvent* event = message;
+    BrowserWorker* browser = context;
+
+    // File and directory events are skipped, reading doesn't change folder contents
+    // and modifications are caught by storage timestamp
+    if(event->type == StorageEventTypeCardMount || event->type == StorageEventTypeCardUnmount ||
+       event->type == StorageEventTypeCardMountError) {
+        browser->snapshot_dirty = true;
+    }
+}
+
 static bool browser_folder_check_and_switch(FuriString* path) {
     FileInfo file_info;
     Storage* storage = furi_record_open(RECORD_STORAGE);
@@ -132,12 +228,13 @@ static bool browser_folder_check_and_switch(FuriString* path) {
     return is_root;
 }
 
-static bool browser_folder_init(
+static bool browser_folder_scan(
     BrowserWorker* browser,
     FuriString* path,
     FuriString* filename,
     uint32_t* item_cnt,
-    int32_t* file_idx) {
+    int32_t* file_idx,
+    bool long_load_notify) {
     bool state = false;
     FileInfo file_info;
     uint32_t total_files_cnt = 0;
@@ -152,6 +249,15 @@ static bool browser_folder_init(
     *item_cnt = 0;
     *file_idx = -1;
 
+    BrowserSnapshot* snapshot = &browser->snapshot;
+    browser_snapshot_reset(snapshot, path);
+    // Sampled before the storage timestamp, so a change in between is not missed
+    snapshot->built_at = furi_hal_rtc_get_timestamp();
+    bool snapshot_complete =
+        (storage_common_timestamp(storage, furi_string_get_cstr(path), &snapshot->timestamp) ==
+         FSE_OK);
+    browser->snapshot_dirty = false;
+
     if(storage_dir_open(directory, furi_string_get_cstr(path))) {
         state = true;
         while(1) {
@@ -162,14 +268,18 @@ static bool browser_folder_init(
                 total_files_cnt++;
                 furi_string_set(name_str, name_temp);
                 if(browser_filter_by_name(browser, name_str, file_info_is_dir(&file_info))) {
-                    if(!furi_string_empty(filename)) {
+                    if(filename && !furi_string_empty(filename)) {
                         if(furi_string_cmp(name_str, filename) == 0) {
                             *file_idx = *item_cnt;
                         }
                     }
+                    if(snapshot_complete) {
+                        snapshot_complete = browser_snapshot_push(
+                            snapshot, name_temp, file_info_is_dir(&file_info));
+                    }
                     (*item_cnt)++;
                 }
-                if(total_files_cnt == LONG_LOAD_THRESHOLD) {
+                if(long_load_notify && (total_files_cnt == LONG_LOAD_THRESHOLD)) {
                     // There are too many files in folder and counting them will take some time - send callback to app
                     if(browser->long_load_cb) {
                         browser->long_load_cb(browser->cb_ctx);
@@ -179,6 +289,11 @@ static bool browser_folder_init(
         }
     }
 
+    snapshot->valid = state && snapshot_complete;
+    if(!snapshot->valid) {
+        browser_snapshot_reset(snapshot, path);
+    }
+
     furi_string_free(name_str);
 
     storage_dir_close(directory);
@@ -189,8 +304,59 @@ static bool browser_folder_init(
     return state;
 }
 
-static bool
-    browser_folder_load(BrowserWorker* browser, FuriString* path, uint32_t offset, uint32_t count) {
+static bool browser_folder_init(
+    BrowserWorker* browser,
+    FuriString* path,
+    FuriString* filename,
+    uint32_t* item_cnt,
+    int32_t* file_idx) {
+    return browser_folder_scan(browser, path, filename, item_cnt, file_idx, true);
+}
+
+static bool browser_folder_load_snapshot(
+    BrowserWorker* browser,
+    FuriString* path,
+    uint32_t offset,
+    uint32_t count) {
+    BrowserSnapshot* snapshot = &browser->snapshot;
+    const size_t items_total = BrowserSnapshotItemArray_size(snapshot->items);
+    uint32_t items_cnt = 0;
+
+    if(offset > items_total) {
+        return false;
+    }
+
+    if(browser->list_load_cb) {
+        browser->list_load_cb(browser->cb_ctx, offset);
+    }
+
+    FuriString* name_str = furi_string_alloc();
+    while((items_cnt < count) && (offset + items_cnt < items_total)) {
+        const BrowserSnapshotItem* item =
+            BrowserSnapshotItemArray_cget(snapshot->items, offset + items_cnt);
+        furi_string_printf(
+            name_str,
+            "%s/%s",
+            furi_string_get_cstr(path),
+            &snapshot->names[item->name_offset]);
+        if(browser->list_item_cb) {
+            browser->list_item_cb(browser->cb_ctx, name_str, item->is_dir, false);
+        }
+        items_cnt++;
+    }
+    if(browser->list_item_cb) {
+        browser->list_item_cb(browser->cb_ctx, NULL, false, true);
+    }
+    furi_string_free(name_str);
+
+    return (items_cnt == count);
+}
+
+static bool browser_folder_load_direct(
+    BrowserWorker* browser,
+    FuriString* path,
+    uint32_t offset,
+    uint32_t count) {
     FileInfo file_info;
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
@@ -263,6 +429,25 @@ static bool
     return (items_cnt == count);
 }
 
+static bool browser_folder_load(
+    BrowserWorker* browser,
+    FuriString* path,
+    uint32_t offset,
+    uint32_t count) {
+    if(!browser_snapshot_is_current(browser, path)) {
+        uint32_t item_cnt = 0;
+        int32_t file_idx = 0;
+        browser_folder_scan(browser, path, NULL, &item_cnt, &file_idx, false);
+    }
+
+    if(browser->snapshot.valid) {
+        return browser_folder_load_snapshot(browser, path, offset, count);
+    } else {
+        // Folder is too large for a snapshot, skip to the offset on every load
+        return browser_folder_load_direct(browser, path, offset, count);
+    }
+}
+
 static int32_t browser_worker(void* context) {
     BrowserWorker* browser = (BrowserWorker*)context;
     furi_assert(browser);
@@ -276,6 +461,10 @@ static int32_t browser_worker(void* context) {
     FuriString* filename;
     filename = furi_string_alloc();
 
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FuriPubSubSubscription* storage_subscription =
+        furi_pubsub_subscribe(storage_get_pubsub(storage), browser_storage_callback, browser);
+
     furi_thread_flags_set(furi_thread_get_id(browser->thread), WorkerEvtConfigChange);
 
     while(1) {
@@ -365,6 +554,9 @@ static int32_t browser_worker(void* context) {
         }
     }
 
+    furi_pubsub_unsubscribe(storage_get_pubsub(storage), storage_subscription);
+    furi_record_close(RECORD_STORAGE);
+
     furi_string_free(filename);
     furi_string_free(path);
 
@@ -382,6 +574,9 @@ BrowserWorker* file_browser_worker_alloc(
 
     idx_last_array_init(browser->idx_last);
 
+    browser->snapshot.path = furi_string_alloc();
+    BrowserSnapshotItemArray_init(browser->snapshot.items);
+
     browser->filter_extension = furi_string_alloc_set(filter_ext);
     browser->skip_assets = skip_assets;
     browser->hide_dot_files = hide_dot_files;
@@ -414,6 +609,10 @@ void file_browser_worker_free(BrowserWorker* browser) {
 
     idx_last_array_clear(browser->idx_last);
 
+    BrowserSnapshotItemArray_clear(browser->snapshot.items);
+    free(browser->snapshot.names);
+    furi_string_free(browser->snapshot.path);
+
     free(browser);
 }
 
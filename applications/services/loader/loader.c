@@ -13,6 +13,7 @@
 
 #define TAG "Loader"
 #define LOADER_MAGIC_THREAD_VALUE 0xDEADBEEF
+#define LOADER_META_CACHE_PATH EXT_PATH("apps_data/loader/fap_meta.cache")
 
 // helpers
 
@@ -127,6 +128,12 @@ FuriPubSub* loader_get_pubsub(Loader* loader) {
     return loader->pubsub;
 }
 
+FlipperApplicationMetaCache* loader_get_meta_cache(Loader* loader) {
+    furi_assert(loader);
+    // same as pubsub, created with the loader and never freed
+    return loader->meta_cache;
+}
+
 // callbacks
 
 static void loader_menu_closed_callback(void* context) {
@@ -171,6 +178,8 @@ static Loader* loader_alloc() {
     loader->app.thread = NULL;
     loader->app.insomniac = false;
     loader->app.fap = NULL;
+    loader->meta_cache = flipper_application_meta_cache_alloc(
+        furi_record_open(RECORD_STORAGE), LOADER_META_CACHE_PATH, EXT_PATH("apps"));
     return loader;
 }
 
@@ -501,6 +510,9 @@ int32_t loader_srv(void* p) {
         loader_do_start_by_name(loader, FLIPPER_AUTORUN_APP_NAME, NULL, NULL);
     }
 
+    // Card mounted before us won't send an event, so catch up here
+    flipper_application_meta_cache_refresh(loader->meta_cache);
+
     LoaderMessage message;
     while(true) {
         if(furi_message_queue_get(loader->queue, &message, FuriWaitForever) == FuriStatusOk) {
@@ -1,5 +1,6 @@
 #pragma once
 #include <furi.h>
+#include <flipper_application/application_meta_cache.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -79,6 +80,13 @@ void loader_show_menu(Loader* instance);
  */
 FuriPubSub* loader_get_pubsub(Loader* instance);
 
+/**
+ * @brief Get application name and icon cache, shared by all application lists
+ * @param[in] instance loader instance
+ * @return FlipperApplicationMetaCache* 
+ */
+FlipperApplicationMetaCache* loader_get_meta_cache(Loader* instance);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -38,7 +38,6 @@ void loader_applications_free(LoaderApplications* loader_applications) {
 typedef struct {
     FuriString* fap_path;
     DialogsApp* dialogs;
-    Storage* storage;
     Loader* loader;
 
     Gui* gui;
@@ -50,7 +49,6 @@ static LoaderApplicationsApp* loader_applications_app_alloc() {
     LoaderApplicationsApp* app = malloc(sizeof(LoaderApplicationsApp)); //-V799
     app->fap_path = furi_string_alloc_set(EXT_PATH("apps"));
     app->dialogs = furi_record_open(RECORD_DIALOGS);
-    app->storage = furi_record_open(RECORD_STORAGE);
     app->loader = furi_record_open(RECORD_LOADER);
 
     app->gui = furi_record_open(RECORD_GUI);
@@ -72,7 +70,6 @@ static void loader_applications_app_free(LoaderApplicationsApp* app) {
 
     furi_record_close(RECORD_LOADER);
     furi_record_close(RECORD_DIALOGS);
-    furi_record_close(RECORD_STORAGE);
     furi_string_free(app->fap_path);
     free(app);
 }
@@ -84,8 +81,8 @@ static bool loader_applications_item_callback(
     FuriString* item_name) {
     LoaderApplicationsApp* loader_applications_app = context;
     furi_assert(loader_applications_app);
-    return flipper_application_load_name_and_icon(
-        path, loader_applications_app->storage, icon_ptr, item_name);
+    return flipper_application_meta_cache_load_name_and_icon(
+        loader_get_meta_cache(loader_applications_app->loader), path, icon_ptr, item_name);
 }
 
 static bool loader_applications_select_app(LoaderApplicationsApp* loader_applications_app) {
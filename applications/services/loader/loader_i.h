@@ -19,6 +19,7 @@ struct Loader {
     LoaderMenu* loader_menu;
     LoaderApplications* loader_applications;
     LoaderAppData app;
+    FlipperApplicationMetaCache* meta_cache;
 };
 
 typedef enum {
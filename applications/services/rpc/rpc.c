@@ -26,6 +26,10 @@ typedef enum {
 
 #define RPC_ALL_EVENTS (RpcEvtNewData | RpcEvtDisconnect)
 
+/* Room for the varint length prefix of a delimited message */
+#define RPC_TX_HEADER_SIZE (5U)
+#define RPC_TX_BUFFER_SIZE_MIN (256U)
+
 DICT_DEF2(RpcHandlerDict, pb_size_t, M_DEFAULT_OPLIST, RpcHandler, M_POD_OPLIST)
 
 typedef struct {
@@ -77,6 +81,12 @@ struct RpcSession {
     void** system_contexts;
     bool decode_error;
 
+    FuriMutex* tx_mutex;
+    uint8_t* tx_buffer;
+    size_t tx_buffer_size;
+
+    RpcStorageTransfer storage_transfer;
+
     FuriMutex* callbacks_mutex;
     RpcSendBytesCallback send_bytes_callback;
     RpcBufferIsEmptyCallback buffer_is_empty_callback;
@@ -95,6 +105,27 @@ RpcOwner rpc_session_get_owner(RpcSession* session) {
     return session->owner;
 }
 
+void rpc_session_set_storage_transfer(RpcSession* session, const RpcStorageTransfer* transfer) {
+    furi_assert(session);
+    furi_assert(transfer);
+    furi_check(transfer->chunk_size);
+    furi_check(transfer->chunk_size <= RPC_STORAGE_TRANSFER_CHUNK_SIZE_MAX);
+    furi_check(transfer->window <= RPC_STORAGE_TRANSFER_WINDOW_MAX);
+
+    furi_mutex_acquire(session->callbacks_mutex, FuriWaitForever);
+    session->storage_transfer = *transfer;
+    furi_mutex_release(session->callbacks_mutex);
+}
+
+void rpc_session_get_storage_transfer(RpcSession* session, RpcStorageTransfer* transfer) {
+    furi_assert(session);
+    furi_assert(transfer);
+
+    furi_mutex_acquire(session->callbacks_mutex, FuriWaitForever);
+    *transfer = session->storage_transfer;
+    furi_mutex_release(session->callbacks_mutex);
+}
+
 static void rpc_close_session_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -362,6 +393,8 @@ static void rpc_session_thread_pending_callback(void* context, uint32_t arg) {
     furi_mutex_release(session->callbacks_mutex);
 
     furi_mutex_free(session->callbacks_mutex);
+    furi_mutex_free(session->tx_mutex);
+    free(session->tx_buffer);
     furi_thread_join(session->thread);
     furi_thread_free(session->thread);
     free(session);
@@ -378,11 +411,17 @@ RpcSession* rpc_session_open(Rpc* rpc, RpcOwner owner) {
 
     RpcSession* session = malloc(sizeof(RpcSession));
     session->callbacks_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    session->tx_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    session->tx_buffer_size = RPC_TX_BUFFER_SIZE_MIN;
+    session->tx_buffer = malloc(session->tx_buffer_size);
     session->stream = furi_stream_buffer_alloc(RPC_BUFFER_SIZE, 1);
     session->rpc = rpc;
     session->terminate = false;
     session->decode_error = false;
     session->owner = owner;
+    session->storage_transfer.chunk_size = RPC_STORAGE_TRANSFER_CHUNK_SIZE_DEFAULT;
+    session->storage_transfer.window = RPC_STORAGE_TRANSFER_WINDOW_DEFAULT;
+    session->storage_transfer.compress = false;
     RpcHandlerDict_init(session->handlers);
 
     session->decoded_message = malloc(sizeof(PB_Main));
@@ -440,36 +479,60 @@ void rpc_add_handler(RpcSession* session, pb_size_t message_tag, RpcHandler* han
     RpcHandlerDict_set_at(session->handlers, message_tag, *handler);
 }
 
+/* Appends to the session TX buffer, growing it when a message doesn't fit */
+static bool rpc_tx_write_callback(pb_ostream_t* stream, const pb_byte_t* buf, size_t count) {
+    RpcSession* session = stream->state;
+    const size_t required = RPC_TX_HEADER_SIZE + stream->bytes_written + count;
+
+    if(required > session->tx_buffer_size) {
+        session->tx_buffer_size = MAX(required, session->tx_buffer_size * 2);
+        session->tx_buffer = realloc(session->tx_buffer, session->tx_buffer_size); //-V701
+    }
+
+    memcpy(session->tx_buffer + RPC_TX_HEADER_SIZE + stream->bytes_written, buf, count);
+    return true;
+}
+
 void rpc_send(RpcSession* session, PB_Main* message) {
     furi_assert(session);
     furi_assert(message);
 
-    pb_ostream_t ostream = PB_OSTREAM_SIZING;
-
 #if SRV_RPC_DEBUG
     FURI_LOG_I(TAG, "OUTPUT:");
     rpc_debug_print_message(message);
 #endif
 
-    bool result = pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
+    furi_mutex_acquire(session->tx_mutex, FuriWaitForever);
+
+    // One pass: the body goes after the header room, the length prefix is put in front of it
+    pb_ostream_t ostream = {
+        .callback = rpc_tx_write_callback,
+        .state = session,
+        .max_size = SIZE_MAX,
+        .bytes_written = 0,
+    };
+    bool result = pb_encode(&ostream, &PB_Main_msg, message);
     furi_check(result && ostream.bytes_written);
 
-    uint8_t* buffer = malloc(ostream.bytes_written);
-    ostream = pb_ostream_from_buffer(buffer, ostream.bytes_written);
+    uint8_t header[RPC_TX_HEADER_SIZE];
+    pb_ostream_t header_ostream = pb_ostream_from_buffer(header, sizeof(header));
+    furi_check(pb_encode_varint(&header_ostream, ostream.bytes_written));
 
-    pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
+    uint8_t* buffer = session->tx_buffer + RPC_TX_HEADER_SIZE - header_ostream.bytes_written;
+    const size_t size = header_ostream.bytes_written + ostream.bytes_written;
+    memcpy(buffer, header, header_ostream.bytes_written);
 
 #if SRV_RPC_DEBUG
-    rpc_debug_print_data("OUTPUT", buffer, ostream.bytes_written);
+    rpc_debug_print_data("OUTPUT", buffer, size);
 #endif
 
     furi_mutex_acquire(session->callbacks_mutex, FuriWaitForever);
     if(session->send_bytes_callback) {
-        session->send_bytes_callback(session->context, buffer, ostream.bytes_written);
+        session->send_bytes_callback(session->context, buffer, size);
     }
     furi_mutex_release(session->callbacks_mutex);
 
-    free(buffer);
+    furi_mutex_release(session->tx_mutex);
 }
 
 void rpc_send_and_release(RpcSession* session, PB_Main* message) {
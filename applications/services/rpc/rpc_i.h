@@ -17,6 +17,30 @@ typedef struct {
     void* context;
 } RpcHandler;
 
+#define RPC_STORAGE_TRANSFER_CHUNK_SIZE_DEFAULT (512U)
+#define RPC_STORAGE_TRANSFER_CHUNK_SIZE_MAX (4096U)
+#define RPC_STORAGE_TRANSFER_WINDOW_DEFAULT (2U)
+#define RPC_STORAGE_TRANSFER_WINDOW_MAX (8U)
+
+/** Storage file transfer mode of a session */
+typedef struct {
+    uint16_t chunk_size; /**< payload size of a read response */
+    uint8_t window; /**< chunks read ahead while the current one is sent */
+    bool compress; /**< read payloads are compress_encode() blocks */
+} RpcStorageTransfer;
+
+/** Set storage file transfer mode, applies to the next read request
+ * @param session
+ * @param transfer
+ */
+void rpc_session_set_storage_transfer(RpcSession* session, const RpcStorageTransfer* transfer);
+
+/** Get storage file transfer mode
+ * @param session
+ * @param transfer
+ */
+void rpc_session_get_storage_transfer(RpcSession* session, RpcStorageTransfer* transfer);
+
 void rpc_send(RpcSession* session, PB_Main* main_message);
 
 void rpc_send_and_release(RpcSession* session, PB_Main* main_message);
@@ -5,6 +5,7 @@
 #include <rpc/rpc_i.h>
 #include <storage/filesystem_api_defines.h>
 #include <storage/storage.h>
+#include <lib/toolbox/compress.h>
 #include <lib/toolbox/md5_calc.h>
 #include <lib/toolbox/path.h>
 #include <update_util/lfs_backup.h>
@@ -17,8 +18,6 @@
 
 #define MAX_NAME_LENGTH 255
 
-static const size_t MAX_DATA_SIZE = 512;
-
 typedef enum {
     RpcStorageStateIdle = 0,
     RpcStorageStateWriting,
@@ -354,6 +353,30 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
     furi_record_close(RECORD_STORAGE);
 }
 
+typedef struct {
+    StorageBatch* batch;
+    pb_bytes_array_t* data;
+    size_t size;
+} RpcStorageReadSlot;
+
+/* Compressed chunk never grows by more than one flag bit per byte */
+#define RPC_STORAGE_PACKED_SIZE(size) ((size) + (size) / 8 + 8)
+
+static void rpc_system_storage_read_slot_submit(
+    RpcStorageReadSlot* slot,
+    File* file,
+    size_t* size_requested,
+    size_t file_size,
+    size_t chunk_size) {
+    slot->size = MIN(file_size - *size_requested, chunk_size);
+    if(slot->size) {
+        storage_batch_reset(slot->batch);
+        storage_batch_add_read(slot->batch, file, slot->data->bytes, slot->size);
+        storage_batch_submit(slot->batch);
+        *size_requested += slot->size;
+    }
+}
+
 static void rpc_system_storage_read_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -367,53 +390,112 @@ static void rpc_system_storage_read_process(const PB_Main* request, void* contex
 
     rpc_system_storage_reset_state(rpc_storage, session, true);
 
-    /* use same message memory to send response */
+    RpcStorageTransfer transfer;
+    rpc_session_get_storage_transfer(session, &transfer);
+    const size_t chunk_size = transfer.chunk_size;
+
+    /* use same message and payload memory for every chunk */
     PB_Main* response = malloc(sizeof(PB_Main));
     const char* path = request->content.storage_read_request.path;
     Storage* fs_api = furi_record_open(RECORD_STORAGE);
     File* file = storage_file_alloc(fs_api);
     bool fs_operation_success = storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING);
+    FS_Error fs_error = FSE_OK;
+
+    /* the storage thread fills the other slots while one chunk is being sent */
+    const size_t slots_count = transfer.window + 1;
+    RpcStorageReadSlot* slots = malloc(sizeof(RpcStorageReadSlot) * slots_count);
+    for(size_t i = 0; i < slots_count; i++) {
+        slots[i].batch = storage_batch_alloc(fs_api);
+        slots[i].data = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(chunk_size));
+    }
 
-    if(fs_operation_success) {
-        size_t size_left = storage_file_size(file);
-        do {
-            response->command_id = request->command_id;
-            response->which_content = PB_Main_storage_read_response_tag;
-            response->command_status = PB_CommandStatus_OK;
-
-            size_t read_size = MIN(size_left, MAX_DATA_SIZE);
-            if(read_size) {
-                response->content.storage_read_response.has_file = true;
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(read_size));
-                uint8_t* buffer = &response->content.storage_read_response.file.data->bytes[0];
-                uint16_t* read_size_msg = &response->content.storage_read_response.file.data->size;
+    Compress* compress = NULL;
+    pb_bytes_array_t* packed = NULL;
+    if(transfer.compress) {
+        compress = compress_alloc(chunk_size);
+        packed = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(RPC_STORAGE_PACKED_SIZE(chunk_size)));
+    }
 
-                *read_size_msg = storage_file_read(file, buffer, read_size);
-                size_left -= *read_size_msg;
-                fs_operation_success = (*read_size_msg == read_size);
+    if(fs_operation_success) {
+        const size_t file_size = storage_file_size(file);
+        size_t size_requested = 0;
+        size_t size_left = file_size;
+        size_t current = 0;
+
+        for(size_t i = 0; i < slots_count; i++) {
+            rpc_system_storage_read_slot_submit(
+                &slots[i], file, &size_requested, file_size, chunk_size);
+        }
 
-                response->has_next = fs_operation_success && (size_left > 0);
+        do {
+            RpcStorageReadSlot* slot = &slots[current];
+            pb_bytes_array_t* data = slot->data;
+
+            if(slot->size) {
+                storage_batch_wait(slot->batch, FuriWaitForever);
+                data->size = storage_batch_get_result(slot->batch, 0);
+                fs_error = storage_batch_get_error(slot->batch, 0);
+                size_left -= data->size;
+                fs_operation_success = (data->size == slot->size);
             } else {
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(0));
-                response->content.storage_read_response.file.data->size = 0;
-                response->content.storage_read_response.has_file = true;
-                response->has_next = false;
+                data->size = 0;
                 fs_operation_success = true;
             }
 
+            if(fs_operation_success && compress && data->size) {
+                size_t packed_size = 0;
+                if(compress_encode(
+                       compress,
+                       data->bytes,
+                       data->size,
+                       packed->bytes,
+                       RPC_STORAGE_PACKED_SIZE(chunk_size),
+                       &packed_size)) {
+                    packed->size = packed_size;
+                    data = packed;
+                } else {
+                    fs_error = FSE_INTERNAL;
+                    fs_operation_success = false;
+                }
+            }
+
             if(fs_operation_success) {
-                rpc_send_and_release(session, response);
+                response->command_id = request->command_id;
+                response->which_content = PB_Main_storage_read_response_tag;
+                response->command_status = PB_CommandStatus_OK;
+                response->content.storage_read_response.has_file = true;
+                response->content.storage_read_response.file.data = data;
+                response->has_next = (size_left > 0);
+                // not released, the payload is ours
+                rpc_send(session, response);
+
+                rpc_system_storage_read_slot_submit(
+                    slot, file, &size_requested, file_size, chunk_size);
+                current = (current + 1) % slots_count;
             }
         } while((size_left != 0) && fs_operation_success);
+    } else {
+        fs_error = storage_file_get_error(file);
     }
 
     if(!fs_operation_success) {
         rpc_send_and_release_empty(
-            session, request->command_id, rpc_system_storage_get_file_error(file));
+            session,
+            request->command_id,
+            rpc_system_storage_get_error(fs_error));
     }
 
+    if(compress) {
+        compress_free(compress);
+        free(packed);
+    }
+    /* waits for reads still in flight, before the file is closed */
+    for(size_t i = 0; i < slots_count; i++) {
+        storage_batch_free(slots[i].batch);
+        free(slots[i].data);
+    }
+    free(slots);
     free(response);
     storage_file_close(file);
     storage_file_free(file);
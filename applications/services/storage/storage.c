@@ -74,6 +74,8 @@ void storage_tick(Storage* app) {
         app->sd_gui.enabled = false;
         view_port_enabled_set(app->sd_gui.view_port, false);
 
+        storage_process_stat_cache_reset(&app->storage[ST_EXT]);
+
         FURI_LOG_I(TAG, "SD card unmount");
         StorageEvent event = {.type = StorageEventTypeCardUnmount};
         furi_pubsub_publish(app->pubsub, &event);
@@ -88,6 +90,7 @@ void storage_tick(Storage* app) {
        app->sd_gui.enabled == false) {
         app->sd_gui.enabled = true;
         view_port_enabled_set(app->sd_gui.view_port, true);
+        storage_process_stat_cache_reset(&app->storage[ST_EXT]);
 
         if(app->storage[ST_EXT].status == StorageStatusOK) {
             FURI_LOG_I(TAG, "SD card mount");
@@ -209,6 +209,166 @@ bool storage_file_exists(Storage* storage, const char* path);
  */
 bool storage_file_copy_to_file(File* source, File* destination, size_t size);
 
+/******************* Batch Functions *******************/
+
+/**
+ * @brief Batch of file requests executed by the storage service in one go.
+ *
+ * Read, write and seek requests are queued with caller-owned buffers and
+ * submitted as a single message. The storage thread executes them back to back,
+ * without a round trip per request or per 64 KiB chunk. Submission does not block,
+ * so several batches may be kept in flight to overlap storage access with other work.
+ *
+ * Requests are executed in order. Execution stops at the first request that fails
+ * or transfers fewer bytes than requested, the remaining requests are skipped and
+ * report FSE_NOT_READY.
+ *
+ * While a batch is in flight, neither the batch, its buffers nor its files may be touched.
+ */
+typedef struct StorageBatch StorageBatch;
+
+/**
+ * @brief Batch completion callback.
+ *
+ * Called from the storage thread once all requests are processed, must not block
+ * and must not free the batch.
+ *
+ * @param batch pointer to the completed batch instance.
+ * @param context pointer to a user-specified context object.
+ */
+typedef void (*StorageBatchCallback)(StorageBatch* batch, void* context);
+
+/**
+ * @brief Allocate an empty batch.
+ *
+ * @param storage pointer to a storage API instance.
+ * @return pointer to the created instance.
+ */
+StorageBatch* storage_batch_alloc(Storage* storage);
+
+/**
+ * @brief Free the batch. Waits for the batch to complete if it is in flight.
+ *
+ * @param batch pointer to the batch instance to be freed.
+ */
+void storage_batch_free(StorageBatch* batch);
+
+/**
+ * @brief Remove all requests from the batch.
+ *
+ * @param batch pointer to a batch instance, must not be in flight.
+ */
+void storage_batch_reset(StorageBatch* batch);
+
+/**
+ * @brief Queue a read request.
+ *
+ * @param batch pointer to a batch instance, must not be in flight.
+ * @param file pointer to an open file instance.
+ * @param buff pointer to the buffer to be filled, must stay valid until completion.
+ * @param bytes_to_read number of bytes to read.
+ * @return index of the request in the batch.
+ */
+size_t storage_batch_add_read(StorageBatch* batch, File* file, void* buff, size_t bytes_to_read);
+
+/**
+ * @brief Queue a write request.
+ *
+ * @param batch pointer to a batch instance, must not be in flight.
+ * @param file pointer to an open file instance.
+ * @param buff pointer to the data to be written, must stay valid until completion.
+ * @param bytes_to_write number of bytes to write.
+ * @return index of the request in the batch.
+ */
+size_t storage_batch_add_write(
+    StorageBatch* batch,
+    File* file,
+    const void* buff,
+    size_t bytes_to_write);
+
+/**
+ * @brief Queue a seek request.
+ *
+ * @param batch pointer to a batch instance, must not be in flight.
+ * @param file pointer to an open file instance.
+ * @param offset access position offset (meaning depends on from_start parameter).
+ * @param from_start if true, set the access position relative to the file start, otherwise relative to the current position.
+ * @return index of the request in the batch.
+ */
+size_t storage_batch_add_seek(StorageBatch* batch, File* file, uint32_t offset, bool from_start);
+
+/**
+ * @brief Set the completion callback.
+ *
+ * @param batch pointer to a batch instance, must not be in flight.
+ * @param callback pointer to a callback function, NULL to disable.
+ * @param context pointer to a user-specified context object.
+ */
+void storage_batch_set_callback(
+    StorageBatch* batch,
+    StorageBatchCallback callback,
+    void* context);
+
+/**
+ * @brief Submit the batch to the storage service and return immediately.
+ *
+ * A completed batch may be submitted again, its results are reset.
+ *
+ * @param batch pointer to a batch instance, must not be in flight.
+ */
+void storage_batch_submit(StorageBatch* batch);
+
+/**
+ * @brief Check whether the batch is completed (or was never submitted).
+ *
+ * @param batch pointer to a batch instance.
+ * @return true if the batch is not in flight, false otherwise.
+ */
+bool storage_batch_is_done(StorageBatch* batch);
+
+/**
+ * @brief Wait for the batch to complete.
+ *
+ * @param batch pointer to a batch instance.
+ * @param timeout timeout in ticks, FuriWaitForever to wait indefinitely.
+ * @return true if the batch is completed, false on timeout.
+ */
+bool storage_batch_wait(StorageBatch* batch, uint32_t timeout);
+
+/**
+ * @brief Submit the batch and wait for it to complete.
+ *
+ * @param batch pointer to a batch instance, must not be in flight.
+ * @return true if every request was executed and transferred all requested bytes, false otherwise.
+ */
+bool storage_batch_execute(StorageBatch* batch);
+
+/**
+ * @brief Get the number of requests in the batch.
+ *
+ * @param batch pointer to a batch instance.
+ * @return number of requests.
+ */
+size_t storage_batch_get_count(StorageBatch* batch);
+
+/**
+ * @brief Get the result of a completed request.
+ *
+ * @param batch pointer to a completed batch instance.
+ * @param index request index.
+ * @return number of bytes transferred for reads and writes, 1 for a successful seek, 0 otherwise.
+ */
+size_t storage_batch_get_result(StorageBatch* batch, size_t index);
+
+/**
+ * @brief Get the error of a completed request.
+ *
+ * @param batch pointer to a completed batch instance.
+ * @param index request index.
+ * @return FSE_OK, the file error of the request, or FSE_NOT_READY if it was skipped.
+ */
+FS_Error storage_batch_get_error(StorageBatch* batch, size_t index);
+
 /******************* Directory Functions *******************/
 
 /**
@@ -0,0 +1,429 @@
+#include "storage_bench.h"
+
+#include <furi_hal.h>
+#include <toolbox/stream/buffered_file_stream.h>
+#include <flipper_format/flipper_format.h>
+
+#define TAG "StorageBench"
+
+#define STORAGE_BENCH_RANDOM_READ_SIZE (4096U)
+#define STORAGE_BENCH_RANDOM_READ_COUNT (64U)
+#define STORAGE_BENCH_SMALL_FILE_SIZE (64U)
+#define STORAGE_BENCH_SMALL_FILE_COUNT (32U)
+#define STORAGE_BENCH_ROUNDS (4U)
+#define STORAGE_BENCH_STREAM_LINES (256U)
+#define STORAGE_BENCH_FF_KEYS (64U)
+#define STORAGE_BENCH_FF_VALUES (16U)
+#define STORAGE_BENCH_NAME_SIZE (32U)
+
+static const uint32_t storage_bench_chunk_sizes[] = {512, 4096, 16384};
+
+static const char* const storage_bench_test_names[] = {
+    [StorageBenchTestSeqWrite] = "seq_write",
+    [StorageBenchTestSeqRead] = "seq_read",
+    [StorageBenchTestRandomRead] = "random_read",
+    [StorageBenchTestSmallCreate] = "small_create",
+    [StorageBenchTestDirList] = "dir_list",
+    [StorageBenchTestStat] = "stat",
+    [StorageBenchTestSmallRemove] = "small_remove",
+    [StorageBenchTestStreamParse] = "stream_parse",
+    [StorageBenchTestFlipperFormatParse] = "ff_parse",
+};
+
+typedef struct {
+    Storage* storage;
+    FuriString* dir;
+    FuriString* path;
+    uint32_t file_size;
+    uint8_t* buffer;
+    size_t buffer_size;
+    StorageBenchCallback callback;
+    void* context;
+    bool success;
+} StorageBench;
+
+const char* storage_bench_test_get_name(StorageBenchTest test) {
+    furi_check(test < COUNT_OF(storage_bench_test_names));
+    return storage_bench_test_names[test];
+}
+
+void storage_bench_result_format(const StorageBenchResult* result, FuriString* output) {
+    const uint32_t time_us = MAX(result->time_us, 1UL);
+    furi_string_printf(
+        output,
+        "test=%s param=%lu ops=%lu bytes=%lu time_us=%lu kib_s=%lu ops_s=%lu error=%s",
+        storage_bench_test_get_name(result->test),
+        result->param,
+        result->ops,
+        result->bytes,
+        result->time_us,
+        (uint32_t)((uint64_t)result->bytes * 1000000 / 1024 / time_us),
+        (uint32_t)((uint64_t)result->ops * 1000000 / time_us),
+        storage_error_get_desc(result->error));
+}
+
+static inline uint32_t storage_bench_timer_start(void) {
+    return DWT->CYCCNT;
+}
+
+static inline uint32_t storage_bench_timer_us(uint32_t start) {
+    return (DWT->CYCCNT - start) / furi_hal_cortex_instructions_per_microsecond();
+}
+
+/* Fixed seed, so every run does the same work */
+static inline uint32_t storage_bench_random(uint32_t* state) {
+    *state = *state * 1664525UL + 1013904223UL;
+    return *state >> 8;
+}
+
+static void storage_bench_report(StorageBench* bench, StorageBenchResult* result) {
+    if(result->error != FSE_OK) {
+        bench->success = false;
+    }
+    if(bench->callback) {
+        bench->callback(result, bench->context);
+    }
+}
+
+static const char* storage_bench_path(StorageBench* bench, const char* name) {
+    furi_string_printf(bench->path, "%s/%s", furi_string_get_cstr(bench->dir), name);
+    return furi_string_get_cstr(bench->path);
+}
+
+static const char* storage_bench_small_path(StorageBench* bench, uint32_t index) {
+    furi_string_printf(bench->path, "%s/s_%02lu", furi_string_get_cstr(bench->dir), index);
+    return furi_string_get_cstr(bench->path);
+}
+
+static void storage_bench_sequential(StorageBench* bench, uint32_t chunk, bool write) {
+    StorageBenchResult result = {
+        .test = write ? StorageBenchTestSeqWrite : StorageBenchTestSeqRead,
+        .param = chunk,
+        .error = FSE_OK,
+    };
+    File* file = storage_file_alloc(bench->storage);
+    const char* path = storage_bench_path(bench, "seq");
+
+    const uint32_t start = storage_bench_timer_start();
+    if(write ? storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS) :
+               storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        while(result.bytes < bench->file_size) {
+            const size_t size = MIN(chunk, bench->file_size - result.bytes);
+            const size_t done = write ? storage_file_write(file, bench->buffer, size) :
+                                        storage_file_read(file, bench->buffer, size);
+            result.bytes += done;
+            result.ops++;
+            if(done != size) break;
+        }
+        result.error = storage_file_get_error(file);
+        storage_file_close(file);
+    } else {
+        result.error = storage_file_get_error(file);
+    }
+    result.time_us = storage_bench_timer_us(start);
+
+    if(result.error == FSE_OK && result.bytes != bench->file_size) {
+        result.error = FSE_INTERNAL;
+    }
+    storage_file_free(file);
+
+    storage_bench_report(bench, &result);
+}
+
+static void storage_bench_random_read(StorageBench* bench) {
+    StorageBenchResult result = {
+        .test = StorageBenchTestRandomRead,
+        .param = STORAGE_BENCH_RANDOM_READ_SIZE,
+        .error = FSE_OK,
+    };
+    const uint32_t blocks = bench->file_size / STORAGE_BENCH_RANDOM_READ_SIZE;
+    if(blocks == 0) {
+        result.error = FSE_INVALID_PARAMETER;
+        storage_bench_report(bench, &result);
+        return;
+    }
+
+    File* file = storage_file_alloc(bench->storage);
+    uint32_t seed = 0;
+
+    const char* path = storage_bench_path(bench, "seq");
+
+    const uint32_t start = storage_bench_timer_start();
+    if(storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        for(; result.ops < STORAGE_BENCH_RANDOM_READ_COUNT; result.ops++) {
+            const uint32_t offset =
+                (storage_bench_random(&seed) % blocks) * STORAGE_BENCH_RANDOM_READ_SIZE;
+            if(!storage_file_seek(file, offset, true)) break;
+            const size_t done =
+                storage_file_read(file, bench->buffer, STORAGE_BENCH_RANDOM_READ_SIZE);
+            result.bytes += done;
+            if(done != STORAGE_BENCH_RANDOM_READ_SIZE) break;
+        }
+        result.error = storage_file_get_error(file);
+        storage_file_close(file);
+    } else {
+        result.error = storage_file_get_error(file);
+    }
+    result.time_us = storage_bench_timer_us(start);
+
+    if(result.error == FSE_OK && result.ops != STORAGE_BENCH_RANDOM_READ_COUNT) {
+        result.error = FSE_INTERNAL;
+    }
+    storage_file_free(file);
+
+    storage_bench_report(bench, &result);
+}
+
+static void storage_bench_small_files(StorageBench* bench, bool create) {
+    StorageBenchResult result = {
+        .test = create ? StorageBenchTestSmallCreate : StorageBenchTestSmallRemove,
+        .param = STORAGE_BENCH_SMALL_FILE_SIZE,
+        .error = FSE_OK,
+    };
+    File* file = storage_file_alloc(bench->storage);
+
+    const uint32_t start = storage_bench_timer_start();
+    for(; result.ops < STORAGE_BENCH_SMALL_FILE_COUNT; result.ops++) {
+        const char* path = storage_bench_small_path(bench, result.ops);
+        if(create) {
+            if(storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+                result.bytes +=
+                    storage_file_write(file, bench->buffer, STORAGE_BENCH_SMALL_FILE_SIZE);
+                result.error = storage_file_get_error(file);
+                storage_file_close(file);
+            } else {
+                result.error = storage_file_get_error(file);
+            }
+        } else {
+            result.error = storage_common_remove(bench->storage, path);
+            result.bytes += STORAGE_BENCH_SMALL_FILE_SIZE;
+        }
+        if(result.error != FSE_OK) break;
+    }
+    result.time_us = storage_bench_timer_us(start);
+    storage_file_free(file);
+
+    storage_bench_report(bench, &result);
+}
+
+static void storage_bench_dir_list(StorageBench* bench) {
+    StorageBenchResult result = {
+        .test = StorageBenchTestDirList,
+        .param = STORAGE_BENCH_SMALL_FILE_COUNT,
+        .error = FSE_OK,
+    };
+    File* dir = storage_file_alloc(bench->storage);
+    FileInfo fileinfo;
+    char name[STORAGE_BENCH_NAME_SIZE];
+
+    const uint32_t start = storage_bench_timer_start();
+    for(size_t round = 0; round < STORAGE_BENCH_ROUNDS && result.error == FSE_OK; round++) {
+        uint32_t entries = 0;
+        if(storage_dir_open(dir, furi_string_get_cstr(bench->dir))) {
+            while(storage_dir_read(dir, &fileinfo, name, sizeof(name))) {
+                entries++;
+            }
+        }
+        result.error = storage_file_get_error(dir);
+        storage_dir_close(dir);
+
+        // End of directory is reported as FSE_NOT_EXIST
+        if(result.error == FSE_NOT_EXIST) {
+            result.error = FSE_OK;
+        }
+        // "seq" is listed as well
+        if(result.error == FSE_OK && entries < STORAGE_BENCH_SMALL_FILE_COUNT) {
+            result.error = FSE_INTERNAL;
+        }
+        result.ops += entries;
+    }
+    result.time_us = storage_bench_timer_us(start);
+    storage_file_free(dir);
+
+    storage_bench_report(bench, &result);
+}
+
+static void storage_bench_stat(StorageBench* bench) {
+    StorageBenchResult result = {
+        .test = StorageBenchTestStat,
+        .param = STORAGE_BENCH_SMALL_FILE_COUNT,
+        .error = FSE_OK,
+    };
+    FileInfo fileinfo;
+
+    const uint32_t start = storage_bench_timer_start();
+    for(size_t round = 0; round < STORAGE_BENCH_ROUNDS && result.error == FSE_OK; round++) {
+        for(uint32_t i = 0; i < STORAGE_BENCH_SMALL_FILE_COUNT; i++) {
+            result.error =
+                storage_common_stat(bench->storage, storage_bench_small_path(bench, i), &fileinfo);
+            if(result.error != FSE_OK) break;
+            result.ops++;
+        }
+    }
+    result.time_us = storage_bench_timer_us(start);
+
+    storage_bench_report(bench, &result);
+}
+
+static bool storage_bench_write_text(StorageBench* bench, const char* path, FuriString* text) {
+    File* file = storage_file_alloc(bench->storage);
+    bool result = false;
+
+    if(storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+        const size_t size = furi_string_size(text);
+        result = (storage_file_write(file, furi_string_get_cstr(text), size) == size);
+        storage_file_close(file);
+    }
+    storage_file_free(file);
+
+    return result;
+}
+
+static void storage_bench_stream_parse(StorageBench* bench) {
+    StorageBenchResult result = {
+        .test = StorageBenchTestStreamParse,
+        .param = STORAGE_BENCH_STREAM_LINES,
+        .error = FSE_OK,
+    };
+    FuriString* line = furi_string_alloc();
+    const char* path = storage_bench_path(bench, "lines.txt");
+
+    for(uint32_t i = 0; i < STORAGE_BENCH_STREAM_LINES; i++) {
+        furi_string_cat_printf(line, "Key_%03lu: %08lX %08lX\n", i, i * 7919, ~i);
+    }
+    if(!storage_bench_write_text(bench, path, line)) {
+        result.error = FSE_INTERNAL;
+    }
+
+    Stream* stream = buffered_file_stream_alloc(bench->storage);
+    const uint32_t start = storage_bench_timer_start();
+    if(result.error == FSE_OK &&
+       buffered_file_stream_open(stream, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        while(stream_read_line(stream, line)) {
+            result.bytes += furi_string_size(line);
+            result.ops++;
+        }
+    }
+    result.time_us = storage_bench_timer_us(start);
+    if(result.error == FSE_OK) {
+        result.error = buffered_file_stream_get_error(stream);
+    }
+    if(result.error == FSE_OK && result.ops != STORAGE_BENCH_STREAM_LINES) {
+        result.error = FSE_INTERNAL;
+    }
+    buffered_file_stream_close(stream);
+    stream_free(stream);
+    furi_string_free(line);
+
+    storage_bench_report(bench, &result);
+}
+
+static void storage_bench_flipper_format_parse(StorageBench* bench) {
+    StorageBenchResult result = {
+        .test = StorageBenchTestFlipperFormatParse,
+        .param = STORAGE_BENCH_FF_KEYS,
+        .error = FSE_OK,
+    };
+    FlipperFormat* ff = flipper_format_file_alloc(bench->storage);
+    FuriString* key = furi_string_alloc();
+    uint32_t values[STORAGE_BENCH_FF_VALUES];
+    uint32_t version = 1;
+    const char* path = storage_bench_path(bench, "bench.ff");
+
+    bool written = flipper_format_file_open_always(ff, path) &&
+                   flipper_format_write_header_cstr(ff, "Storage Bench", version);
+    for(uint32_t i = 0; i < STORAGE_BENCH_FF_KEYS && written; i++) {
+        for(size_t j = 0; j < COUNT_OF(values); j++) {
+            values[j] = i * 1000 + j;
+        }
+        furi_string_printf(key, "Key_%03lu", i);
+        written =
+            flipper_format_write_uint32(ff, furi_string_get_cstr(key), values, COUNT_OF(values));
+    }
+    if(!flipper_format_file_close(ff) || !written) {
+        result.error = FSE_INTERNAL;
+    }
+    flipper_format_free(ff);
+
+    ff = flipper_format_buffered_file_alloc(bench->storage);
+    const uint32_t start = storage_bench_timer_start();
+    if(result.error == FSE_OK && flipper_format_buffered_file_open_existing(ff, path) &&
+       flipper_format_read_header(ff, key, &version)) {
+        for(; result.ops < STORAGE_BENCH_FF_KEYS; result.ops++) {
+            furi_string_printf(key, "Key_%03lu", result.ops);
+            if(!flipper_format_read_uint32(
+                   ff, furi_string_get_cstr(key), values, COUNT_OF(values)) ||
+               values[COUNT_OF(values) - 1] != result.ops * 1000 + COUNT_OF(values) - 1) {
+                break;
+            }
+            result.bytes += sizeof(values);
+        }
+    }
+    result.time_us = storage_bench_timer_us(start);
+    if(result.error == FSE_OK && result.ops != STORAGE_BENCH_FF_KEYS) {
+        result.error = FSE_INTERNAL;
+    }
+    flipper_format_buffered_file_close(ff);
+    flipper_format_free(ff);
+    furi_string_free(key);
+
+    storage_bench_report(bench, &result);
+}
+
+bool storage_bench_run(
+    Storage* storage,
+    const char* path,
+    uint32_t file_size,
+    StorageBenchCallback callback,
+    void* context) {
+    furi_assert(storage);
+    furi_assert(path);
+
+    StorageBench bench = {
+        .storage = storage,
+        .dir = furi_string_alloc_printf("%s/%s", path, STORAGE_BENCH_DIR_NAME),
+        .path = furi_string_alloc(),
+        .file_size = file_size,
+        .buffer_size = storage_bench_chunk_sizes[COUNT_OF(storage_bench_chunk_sizes) - 1],
+        .callback = callback,
+        .context = context,
+        .success = true,
+    };
+    const char* dir = furi_string_get_cstr(bench.dir);
+
+    storage_simply_remove_recursive(storage, dir);
+    if(storage_common_mkdir(storage, dir) != FSE_OK) {
+        FURI_LOG_E(TAG, "Can't create %s", dir);
+        furi_string_free(bench.path);
+        furi_string_free(bench.dir);
+        return false;
+    }
+
+    bench.buffer = malloc(bench.buffer_size);
+    for(size_t i = 0; i < bench.buffer_size; i++) {
+        bench.buffer[i] = i;
+    }
+
+    for(size_t i = 0; i < COUNT_OF(storage_bench_chunk_sizes); i++) {
+        const uint32_t chunk = storage_bench_chunk_sizes[i];
+        if(chunk > file_size) break;
+        storage_bench_sequential(&bench, chunk, true);
+        storage_bench_sequential(&bench, chunk, false);
+    }
+    storage_bench_random_read(&bench);
+
+    storage_bench_small_files(&bench, true);
+    storage_bench_dir_list(&bench);
+    storage_bench_stat(&bench);
+    storage_bench_small_files(&bench, false);
+
+    storage_bench_stream_parse(&bench);
+    storage_bench_flipper_format_parse(&bench);
+
+    free(bench.buffer);
+    storage_simply_remove_recursive(storage, dir);
+    furi_string_free(bench.path);
+    furi_string_free(bench.dir);
+
+    return bench.success;
+}
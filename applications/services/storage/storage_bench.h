@@ -0,0 +1,72 @@
+/**
+ * @file storage_bench.h
+ * Storage performance benchmark
+ *
+ * Runs a fixed set of workloads in a scratch directory and reports one
+ * result per workload. Workloads are deterministic, so reports from
+ * different builds can be compared line by line.
+ */
+#pragma once
+
+#include <furi.h>
+#include "storage.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STORAGE_BENCH_DIR_NAME ".bench"
+
+typedef enum {
+    StorageBenchTestSeqWrite, /**< sequential write, param is chunk size */
+    StorageBenchTestSeqRead, /**< sequential read, param is chunk size */
+    StorageBenchTestRandomRead, /**< aligned random reads, param is read size */
+    StorageBenchTestSmallCreate, /**< create small files, param is file size */
+    StorageBenchTestDirList, /**< list the small files, param is entry count */
+    StorageBenchTestStat, /**< stat the small files, param is entry count */
+    StorageBenchTestSmallRemove, /**< remove the small files, param is file size */
+    StorageBenchTestStreamParse, /**< buffered file stream line reads, param is line count */
+    StorageBenchTestFlipperFormatParse, /**< FlipperFormat array reads, param is key count */
+} StorageBenchTest;
+
+typedef struct {
+    StorageBenchTest test;
+    uint32_t param;
+    uint32_t ops; /**< operations done */
+    uint32_t bytes; /**< payload bytes moved or parsed */
+    uint32_t time_us;
+    FS_Error error; /**< FSE_OK if the workload completed */
+} StorageBenchResult;
+
+typedef void (*StorageBenchCallback)(const StorageBenchResult* result, void* context);
+
+/** Get workload name
+ * @param test
+ * @return const char*
+ */
+const char* storage_bench_test_get_name(StorageBenchTest test);
+
+/** Format a result as a single key=value line, without line end
+ * @param result
+ * @param output
+ */
+void storage_bench_result_format(const StorageBenchResult* result, FuriString* output);
+
+/** Run all workloads
+ * @param storage
+ * @param path directory to create the scratch directory in, e.g. /ext
+ * @param file_size size of the sequential transfer file
+ * @param callback called with every result
+ * @param context callback context
+ * @return true if all workloads completed
+ */
+bool storage_bench_run(
+    Storage* storage,
+    const char* path,
+    uint32_t file_size,
+    StorageBenchCallback callback,
+    void* context);
+
+#ifdef __cplusplus
+}
+#endif
@@ -5,8 +5,12 @@
 #include <lib/toolbox/args.h>
 #include <lib/toolbox/md5_calc.h>
 #include <lib/toolbox/dir_walk.h>
+#include <lib/toolbox/version.h>
 #include <storage/storage.h>
 #include <storage/storage_sd_api.h>
+#include <storage/storage_i.h>
+#include <storage/storages/storage_ext.h>
+#include <storage/storage_bench.h>
 #include <power/power_service/power.h>
 
 #define MAX_NAME_LENGTH 255
@@ -16,7 +20,7 @@ static void storage_cli_print_usage() {
     printf("storage <cmd> <path> <args>\r\n");
     printf("The path must start with /int or /ext\r\n");
     printf("Cmd list:\r\n");
-    printf("\tinfo\t - get FS info\r\n");
+    printf("\tinfo\t - get FS info and cache counters\r\n");
     printf("\tformat\t - format filesystem\r\n");
     printf("\tlist\t - list files and dirs\r\n");
     printf("\ttree\t - list files and dirs, recursive\r\n");
@@ -33,12 +37,43 @@ static void storage_cli_print_usage() {
     printf("\tmd5\t - md5 hash of the file\r\n");
     printf("\tstat\t - info about file or dir\r\n");
     printf("\ttimestamp\t - last modification timestamp\r\n");
+    printf(
+        "\tbench\t - run storage benchmark in <path>/" STORAGE_BENCH_DIR_NAME
+        ", <args> can contain transfer size in KiB\r\n");
 };
 
 static void storage_cli_print_error(FS_Error error) {
     printf("Storage error: %s\r\n", storage_error_get_desc(error));
 }
 
+static void storage_cli_print_stat_cache(Storage* api, StorageType type) {
+    // here we don't care about thread race when reading the counters
+    const StorageStatCache* cache = &api->storage[type].stat_cache;
+    printf("Stat cache: %lu hits, %lu misses\r\n", cache->hits, cache->misses);
+}
+
+static void storage_cli_print_sector_cache(Storage* api) {
+    // same as above, the counters are only read
+    DiskioCacheStats stats;
+    if(sd_cache_stats(&api->storage[ST_EXT], &stats)) {
+        const uint32_t requested = stats.read_hits + stats.read_misses;
+        printf(
+            "Sector cache: %lu hits, %lu misses (%lu%%), %lu prefetched, %lu bypassed\r\n"
+            "Sector cache: %lu writes held back, %lu flushed, %lu bypassed\r\n"
+            "Sector cache: %lu device reads, %lu device writes\r\n",
+            stats.read_hits,
+            stats.read_misses,
+            requested ? (stats.read_hits * 100UL / requested) : 0UL,
+            stats.prefetched,
+            stats.read_bypass,
+            stats.write_absorbed,
+            stats.write_flushed,
+            stats.write_bypass,
+            stats.device_reads,
+            stats.device_writes);
+    }
+}
+
 static void storage_cli_info(Cli* cli, FuriString* path) {
     UNUSED(cli);
     Storage* api = furi_record_open(RECORD_STORAGE);
@@ -58,6 +93,7 @@ static void storage_cli_info(Cli* cli, FuriString* path) {
                 (uint32_t)(total_space / 1024),
                 (uint32_t)(free_space / 1024));
         }
+        storage_cli_print_stat_cache(api, ST_INT);
     } else if(furi_string_cmp_str(path, STORAGE_EXT_PATH_PREFIX) == 0) {
         SDInfo sd_info;
         FS_Error error = storage_sd_info(api, &sd_info);
@@ -81,6 +117,8 @@ static void storage_cli_info(Cli* cli, FuriString* path) {
                 sd_info.manufacturing_month,
                 sd_info.manufacturing_year);
         }
+        storage_cli_print_stat_cache(api, ST_EXT);
+        storage_cli_print_sector_cache(api);
     } else {
         storage_cli_print_usage();
     }
@@ -496,6 +534,37 @@ static void storage_cli_md5(Cli* cli, FuriString* path) {
     furi_record_close(RECORD_STORAGE);
 }
 
+static void storage_cli_bench_callback(const StorageBenchResult* result, void* context) {
+    FuriString* line = context;
+    storage_bench_result_format(result, line);
+    printf("%s\r\n", furi_string_get_cstr(line));
+}
+
+static void storage_cli_bench(Cli* cli, FuriString* path, FuriString* args) {
+    UNUSED(cli);
+    uint32_t size_kib = furi_string_start_with_str(path, STORAGE_INT_PATH_PREFIX) ? 16 : 1024;
+
+    if(furi_string_size(args) && sscanf(furi_string_get_cstr(args), "%lu", &size_kib) != 1) {
+        storage_cli_print_usage();
+        return;
+    }
+
+    Storage* api = furi_record_open(RECORD_STORAGE);
+    FuriString* line = furi_string_alloc();
+
+    printf(
+        "bench path=%s size=%lu version=%s\r\n",
+        furi_string_get_cstr(path),
+        size_kib * 1024,
+        version_get_version(NULL));
+    bool result = storage_bench_run(
+        api, furi_string_get_cstr(path), size_kib * 1024, storage_cli_bench_callback, line);
+    printf("result=%s\r\n", result ? "ok" : "fail");
+
+    furi_string_free(line);
+    furi_record_close(RECORD_STORAGE);
+}
+
 void storage_cli(Cli* cli, FuriString* args, void* context) {
     UNUSED(context);
     FuriString* cmd;
@@ -589,6 +658,11 @@ void storage_cli(Cli* cli, FuriString* args, void* context) {
             break;
         }
 
+        if(furi_string_cmp_str(cmd, "bench") == 0) {
+            storage_cli_bench(cli, path, args);
+            break;
+        }
+
         storage_cli_print_usage();
     } while(false);
 
@@ -289,24 +289,153 @@ bool storage_file_exists(Storage* storage, const char* path) {
 
 bool storage_file_copy_to_file(File* source, File* destination, size_t size) {
     uint8_t* buffer = malloc(FILE_BUFFER_SIZE);
+    StorageBatch* batch = storage_batch_alloc(source->storage);
 
+    // one round trip per chunk: the write is skipped if the read comes up short
     while(size) {
         uint32_t read_size = size > FILE_BUFFER_SIZE ? FILE_BUFFER_SIZE : size;
-        if(storage_file_read(source, buffer, read_size) != read_size) {
-            break;
-        }
-
-        if(storage_file_write(destination, buffer, read_size) != read_size) {
+        storage_batch_reset(batch);
+        storage_batch_add_read(batch, source, buffer, read_size);
+        storage_batch_add_write(batch, destination, buffer, read_size);
+        if(!storage_batch_execute(batch)) {
             break;
         }
 
         size -= read_size;
     }
 
+    storage_batch_free(batch);
     free(buffer);
     return size == 0;
 }
 
+/****************** BATCH ******************/
+
+StorageBatch* storage_batch_alloc(Storage* storage) {
+    furi_check(storage);
+    StorageBatch* batch = malloc(sizeof(StorageBatch));
+    batch->storage = storage;
+    StorageBatchRequestArray_init(batch->requests);
+    batch->lock = api_lock_alloc_locked();
+    // a fresh batch is not in flight
+    api_lock_unlock(batch->lock);
+    return batch;
+}
+
+void storage_batch_free(StorageBatch* batch) {
+    furi_check(batch);
+    api_lock_wait_unlock(batch->lock);
+    api_lock_free(batch->lock);
+    StorageBatchRequestArray_clear(batch->requests);
+    free(batch);
+}
+
+void storage_batch_reset(StorageBatch* batch) {
+    furi_check(storage_batch_is_done(batch));
+    StorageBatchRequestArray_reset(batch->requests);
+}
+
+static size_t storage_batch_add(StorageBatch* batch, const StorageBatchRequest* request) {
+    furi_check(storage_batch_is_done(batch));
+    furi_check(request->file);
+    StorageBatchRequestArray_push_back(batch->requests, *request);
+    return StorageBatchRequestArray_size(batch->requests) - 1;
+}
+
+size_t storage_batch_add_read(StorageBatch* batch, File* file, void* buff, size_t bytes_to_read) {
+    StorageBatchRequest request = {
+        .type = StorageBatchRequestTypeRead,
+        .file = file,
+        .buff.read = buff,
+        .size = bytes_to_read,
+    };
+    return storage_batch_add(batch, &request);
+}
+
+size_t storage_batch_add_write(
+    StorageBatch* batch,
+    File* file,
+    const void* buff,
+    size_t bytes_to_write) {
+    StorageBatchRequest request = {
+        .type = StorageBatchRequestTypeWrite,
+        .file = file,
+        .buff.write = buff,
+        .size = bytes_to_write,
+    };
+    return storage_batch_add(batch, &request);
+}
+
+size_t storage_batch_add_seek(StorageBatch* batch, File* file, uint32_t offset, bool from_start) {
+    StorageBatchRequest request = {
+        .type = StorageBatchRequestTypeSeek,
+        .file = file,
+        .size = offset,
+        .from_start = from_start,
+    };
+    return storage_batch_add(batch, &request);
+}
+
+void storage_batch_set_callback(
+    StorageBatch* batch,
+    StorageBatchCallback callback,
+    void* context) {
+    furi_check(storage_batch_is_done(batch));
+    batch->callback = callback;
+    batch->context = context;
+}
+
+void storage_batch_submit(StorageBatch* batch) {
+    furi_check(storage_batch_is_done(batch));
+    furi_event_flag_clear(batch->lock, API_LOCK_EVENT);
+
+    batch->data.batch.batch = batch;
+    StorageMessage message = {
+        .lock = batch->lock,
+        .command = StorageCommandBatch,
+        .data = &batch->data,
+        .return_data = &batch->return_data,
+    };
+
+    furi_check(
+        furi_message_queue_put(batch->storage->message_queue, &message, FuriWaitForever) ==
+        FuriStatusOk);
+}
+
+bool storage_batch_is_done(StorageBatch* batch) {
+    furi_check(batch);
+    return furi_event_flag_get(batch->lock) & API_LOCK_EVENT;
+}
+
+bool storage_batch_wait(StorageBatch* batch, uint32_t timeout) {
+    furi_check(batch);
+    // FuriFlagNoClear keeps the batch completed for the following calls
+    uint32_t flags = furi_event_flag_wait(
+        batch->lock, API_LOCK_EVENT, FuriFlagWaitAny | FuriFlagNoClear, timeout);
+    return !(flags & FuriFlagError) && (flags & API_LOCK_EVENT);
+}
+
+bool storage_batch_execute(StorageBatch* batch) {
+    storage_batch_submit(batch);
+    storage_batch_wait(batch, FuriWaitForever);
+    return batch->success;
+}
+
+size_t storage_batch_get_count(StorageBatch* batch) {
+    furi_check(batch);
+    return StorageBatchRequestArray_size(batch->requests);
+}
+
+size_t storage_batch_get_result(StorageBatch* batch, size_t index) {
+    furi_check(storage_batch_is_done(batch));
+    return StorageBatchRequestArray_cget(batch->requests, index)->result;
+}
+
+FS_Error storage_batch_get_error(StorageBatch* batch, size_t index) {
+    furi_check(storage_batch_is_done(batch));
+    return StorageBatchRequestArray_cget(batch->requests, index)->error;
+}
+
 /****************** DIR ******************/
 
 static bool storage_dir_open_internal(File* file, const char* path) {
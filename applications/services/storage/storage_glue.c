@@ -33,6 +33,7 @@ void storage_data_init(StorageData* storage) {
     storage->data = NULL;
     storage->status = StorageStatusNotReady;
     StorageFileList_init(storage->files);
+    memset(&storage->stat_cache, 0, sizeof(StorageStatCache));
 }
 
 StorageStatus storage_data_status(StorageData* storage) {
@@ -50,6 +50,23 @@ LIST_DEF(
      INIT_SET(API_6(storage_file_set)),
      CLEAR(API_2(storage_file_clear))))
 
+#define STORAGE_STAT_CACHE_SIZE 16
+
+typedef struct {
+    FuriString* path;
+    FileInfo fileinfo;
+    FS_Error error;
+    uint32_t last_used;
+    bool valid;
+} StorageStatCacheEntry;
+
+typedef struct {
+    StorageStatCacheEntry entries[STORAGE_STAT_CACHE_SIZE];
+    uint32_t clock;
+    uint32_t hits;
+    uint32_t misses;
+} StorageStatCache;
+
 struct StorageData {
     const FS_Api* fs_api;
     StorageApi api;
@@ -57,6 +74,7 @@ struct StorageData {
     StorageStatus status;
     StorageFileList_t files;
     uint32_t timestamp;
+    StorageStatCache stat_cache;
 };
 
 bool storage_has_file(const File* file, StorageData* storage_data);
@@ -1,6 +1,8 @@
 #pragma once
 #include <furi.h>
 #include <toolbox/api_lock.h>
+#include <m-array.h>
+#include "storage.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -93,6 +95,10 @@ typedef struct {
     SDInfo* info;
 } SAInfo;
 
+typedef struct {
+    StorageBatch* batch;
+} SADataBatch;
+
 typedef union {
     SADataFOpen fopen;
     SADataFRead fread;
@@ -114,6 +120,8 @@ typedef union {
     SADataPath path;
 
     SAInfo sdinfo;
+
+    SADataBatch batch;
 } SAData;
 
 typedef union {
@@ -151,6 +159,7 @@ typedef enum {
     StorageCommandCommonResolvePath,
     StorageCommandSDMount,
     StorageCommandCommonEquivalentPath,
+    StorageCommandBatch,
 } StorageCommand;
 
 typedef struct {
@@ -160,6 +169,40 @@ typedef struct {
     SAReturn* return_data;
 } StorageMessage;
 
+typedef enum {
+    StorageBatchRequestTypeRead,
+    StorageBatchRequestTypeWrite,
+    StorageBatchRequestTypeSeek,
+} StorageBatchRequestType;
+
+typedef struct {
+    StorageBatchRequestType type;
+    File* file;
+    union {
+        void* read;
+        const void* write;
+    } buff;
+    size_t size;
+    bool from_start;
+
+    size_t result;
+    FS_Error error;
+} StorageBatchRequest;
+
+ARRAY_DEF(StorageBatchRequestArray, StorageBatchRequest, M_POD_OPLIST);
+
+struct StorageBatch {
+    Storage* storage;
+    StorageBatchRequestArray_t requests;
+    StorageBatchCallback callback;
+    void* context;
+    bool success;
+
+    FuriApiLock lock;
+    SAData data;
+    SAReturn return_data;
+};
+
 #ifdef __cplusplus
 }
 #endif
@@ -104,6 +104,85 @@ static void storage_path_trim_trailing_slashes(FuriString* path) {
     }
 }
 
+/******************* Stat Cache *******************/
+
+static bool storage_stat_cache_usable(StorageData* storage, FuriString* path) {
+    // Open files may change under the cache, their FileInfo is not cached
+    return (storage_data_status(storage) == StorageStatusOK) &&
+           !storage_path_already_open(path, storage);
+}
+
+static StorageStatCacheEntry* storage_stat_cache_find(StorageData* storage, FuriString* path) {
+    StorageStatCache* cache = &storage->stat_cache;
+
+    for(size_t i = 0; i < STORAGE_STAT_CACHE_SIZE; i++) {
+        StorageStatCacheEntry* entry = &cache->entries[i];
+        if(entry->valid && furi_string_equal(entry->path, path)) {
+            entry->last_used = ++cache->clock;
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+static void storage_stat_cache_store(
+    StorageData* storage,
+    FuriString* path,
+    FS_Error error,
+    const FileInfo* fileinfo) {
+    StorageStatCache* cache = &storage->stat_cache;
+    StorageStatCacheEntry* victim = &cache->entries[0];
+
+    for(size_t i = 0; i < STORAGE_STAT_CACHE_SIZE; i++) {
+        StorageStatCacheEntry* entry = &cache->entries[i];
+        if(!entry->valid) {
+            victim = entry;
+            break;
+        } else if(entry->last_used < victim->last_used) {
+            victim = entry;
+        }
+    }
+
+    if(victim->path == NULL) {
+        victim->path = furi_string_alloc();
+    }
+    furi_string_set(victim->path, path);
+    victim->fileinfo = *fileinfo;
+    victim->error = error;
+    victim->last_used = ++cache->clock;
+    victim->valid = true;
+}
+
+static void storage_stat_cache_invalidate(StorageData* storage, FuriString* path) {
+    StorageStatCache* cache = &storage->stat_cache;
+    const char* path_cstr = furi_string_get_cstr(path);
+    size_t path_len = furi_string_size(path);
+    while(path_len > 1 && path_cstr[path_len - 1] == '/') {
+        path_len--;
+    }
+
+    // The path itself and everything below it, FAT names are case insensitive
+    for(size_t i = 0; i < STORAGE_STAT_CACHE_SIZE; i++) {
+        StorageStatCacheEntry* entry = &cache->entries[i];
+        if(!entry->valid) continue;
+
+        const char* entry_cstr = furi_string_get_cstr(entry->path);
+        if((strncasecmp(entry_cstr, path_cstr, path_len) == 0) &&
+           (entry_cstr[path_len] == '\0' || entry_cstr[path_len] == '/')) {
+            entry->valid = false;
+        }
+    }
+}
+
+void storage_process_stat_cache_reset(StorageData* storage) {
+    StorageStatCache* cache = &storage->stat_cache;
+
+    for(size_t i = 0; i < STORAGE_STAT_CACHE_SIZE; i++) {
+        cache->entries[i].valid = false;
+    }
+}
+
 /******************* File Functions *******************/
 
 bool storage_process_file_open(
@@ -123,6 +202,9 @@ bool storage_process_file_open(
             if(access_mode & FSAM_WRITE) {
                 storage_data_timestamp(storage);
             }
+            if((access_mode & FSAM_WRITE) || (open_mode != FSOM_OPEN_EXISTING)) {
+                storage_stat_cache_invalidate(storage, path);
+            }
             storage_push_storage_file(file, path, storage);
 
             const char* path_cstr_no_vfs = cstr_path_without_vfs_prefix(path);
@@ -352,7 +434,30 @@ static FS_Error storage_process_common_stat(Storage* app, FuriString* path, File
     FS_Error ret = storage_get_data(app, path, &storage);
 
     if(ret == FSE_OK) {
-        FS_CALL(storage, common.stat(storage, cstr_path_without_vfs_prefix(path), fileinfo));
+        const bool cacheable = storage_stat_cache_usable(storage, path);
+        StorageStatCacheEntry* entry = cacheable ? storage_stat_cache_find(storage, path) : NULL;
+
+        if(entry) {
+            storage->stat_cache.hits++;
+            ret = entry->error;
+            if(fileinfo) {
+                *fileinfo = entry->fileinfo;
+            }
+        } else {
+            FileInfo stat_fileinfo = {0};
+            FS_CALL(
+                storage, common.stat(storage, cstr_path_without_vfs_prefix(path), &stat_fileinfo));
+            // Only definite answers are cached, everything else is retried
+            if(cacheable) {
+                storage->stat_cache.misses++;
+                if(ret == FSE_OK || ret == FSE_NOT_EXIST) {
+                    storage_stat_cache_store(storage, path, ret, &stat_fileinfo);
+                }
+            }
+            if(fileinfo) {
+                *fileinfo = stat_fileinfo;
+            }
+        }
     }
 
     return ret;
@@ -371,6 +476,7 @@ static FS_Error storage_process_common_remove(Storage* app, FuriString* path) {
         }
 
         storage_data_timestamp(storage);
+        storage_stat_cache_invalidate(storage, path);
         FS_CALL(storage, common.remove(storage, cstr_path_without_vfs_prefix(path)));
     } while(false);
 
@@ -383,6 +489,7 @@ static FS_Error storage_process_common_mkdir(Storage* app, FuriString* path) {
 
     if(ret == FSE_OK) {
         storage_data_timestamp(storage);
+        storage_stat_cache_invalidate(storage, path);
         FS_CALL(storage, common.mkdir(storage, cstr_path_without_vfs_prefix(path)));
     }
 
@@ -443,6 +550,7 @@ static FS_Error storage_process_sd_format(Storage* app) {
     } else {
         ret = sd_format_card(&app->storage[ST_EXT]);
         storage_data_timestamp(&app->storage[ST_EXT]);
+        storage_process_stat_cache_reset(&app->storage[ST_EXT]);
     }
 
     return ret;
@@ -465,6 +573,7 @@ static FS_Error storage_process_sd_unmount(Storage* app) {
 
         sd_unmount_card(storage);
         storage_data_timestamp(storage);
+        storage_process_stat_cache_reset(storage);
     } while(false);
 
     return ret;
@@ -482,6 +591,7 @@ static FS_Error storage_process_sd_mount(Storage* app) {
 
         ret = sd_mount_card(storage, true);
         storage_data_timestamp(storage);
+        storage_process_stat_cache_reset(storage);
     } while(false);
 
     return ret;
@@ -562,6 +672,73 @@ void storage_process_alias(
     }
 }
 
+/******************* Batch Functions *******************/
+
+static size_t storage_process_batch_transfer(Storage* app, StorageBatchRequest* request) {
+    size_t total = 0;
+
+    do {
+        const uint16_t chunk = MIN(request->size - total, UINT16_MAX);
+        uint16_t done;
+        if(request->type == StorageBatchRequestTypeRead) {
+            done = storage_process_file_read(
+                app, request->file, (uint8_t*)request->buff.read + total, chunk);
+        } else {
+            done = storage_process_file_write(
+                app, request->file, (const uint8_t*)request->buff.write + total, chunk);
+        }
+        total += done;
+
+        if(request->file->error_id != FSE_OK || done != chunk) {
+            break;
+        }
+    } while(total != request->size);
+
+    return total;
+}
+
+static void storage_process_batch(Storage* app, StorageBatch* batch) {
+    bool success = true;
+
+    StorageBatchRequestArray_it_t it;
+    for(StorageBatchRequestArray_it(it, batch->requests); !StorageBatchRequestArray_end_p(it);
+        StorageBatchRequestArray_next(it)) {
+        StorageBatchRequest* request = StorageBatchRequestArray_ref(it);
+
+        if(!success) {
+            request->result = 0;
+            request->error = FSE_NOT_READY;
+            continue;
+        }
+
+        request->result = 0;
+        request->error = FSE_OK;
+
+        switch(request->type) {
+        case StorageBatchRequestTypeRead:
+        case StorageBatchRequestTypeWrite:
+            if(request->size) {
+                request->result = storage_process_batch_transfer(app, request);
+                request->error = request->file->error_id;
+            }
+            success = (request->error == FSE_OK) && (request->result == request->size);
+            break;
+        case StorageBatchRequestTypeSeek:
+            request->result = storage_process_file_seek(
+                app, request->file, request->size, request->from_start);
+            request->error = request->file->error_id;
+            success = (request->error == FSE_OK) && request->result;
+            break;
+        }
+    }
+
+    batch->success = success;
+
+    if(batch->callback) {
+        batch->callback(batch, batch->context);
+    }
+}
+
 /****************** API calls processing ******************/
 
 void storage_process_message_internal(Storage* app, StorageMessage* message) {
@@ -699,6 +876,11 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
         break;
     }
 
+    // Batch operations
+    case StorageCommandBatch:
+        storage_process_batch(app, message->data->batch.batch);
+        break;
+
     // SD operations
     case StorageCommandSDFormat:
         message->return_data->error_value = storage_process_sd_format(app);
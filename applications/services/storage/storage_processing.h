@@ -11,6 +11,8 @@ extern "C" {
 
 void storage_process_message(Storage* app, StorageMessage* message);
 
+void storage_process_stat_cache_reset(StorageData* storage);
+
 #ifdef __cplusplus
 }
 #endif
@@ -100,6 +100,11 @@ FS_Error sd_unmount_card(StorageData* storage) {
     storage->status = StorageStatusNotReady;
     error = FR_DISK_ERR;
 
+    // write out sectors held back by the diskio cache while the card is still there
+    if(sd_data->fs->fs_type != 0 && furi_hal_sd_is_present()) {
+        disk_ioctl(sd_data->fs->drv, CTRL_SYNC, NULL);
+    }
+
     // TODO FL-3522: do i need to close the files?
     f_mount(0, sd_data->path, 0);
 
@@ -242,6 +247,11 @@ FS_Error sd_card_info(StorageData* storage, SDInfo* sd_info) {
     return storage_ext_parse_error(error);
 }
 
+bool sd_cache_stats(StorageData* storage, DiskioCacheStats* stats) {
+    SDData* sd_data = storage->data;
+    return disk_cache_get_stats(sd_data->fs->drv, stats) == RES_OK;
+}
+
 static void storage_ext_tick_internal(StorageData* storage, bool notify) {
     SDData* sd_data = storage->data;
 
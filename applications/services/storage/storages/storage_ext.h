@@ -2,6 +2,7 @@
 #include <furi.h>
 #include "../storage_glue.h"
 #include "../storage_sd_api.h"
+#include <fatfs/diskio_cache.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -12,6 +13,7 @@ FS_Error sd_mount_card(StorageData* storage, bool notify);
 FS_Error sd_unmount_card(StorageData* storage);
 FS_Error sd_format_card(StorageData* storage);
 FS_Error sd_card_info(StorageData* storage, SDInfo* sd_info);
+bool sd_cache_stats(StorageData* storage, DiskioCacheStats* stats);
 #ifdef __cplusplus
 }
 #endif
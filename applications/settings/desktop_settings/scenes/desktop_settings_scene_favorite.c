@@ -3,6 +3,7 @@
 #include "desktop_settings_scene.h"
 #include "desktop_settings_scene_i.h"
 #include <flipper_application/flipper_application.h>
+#include <loader/loader.h>
 #include <storage/storage.h>
 #include <dialogs/dialogs.h>
 
@@ -34,9 +35,10 @@ static bool favorite_fap_selector_item_callback(
     uint8_t** icon_ptr,
     FuriString* item_name) {
     UNUSED(context);
-    Storage* storage = furi_record_open(RECORD_STORAGE);
-    bool success = flipper_application_load_name_and_icon(file_path, storage, icon_ptr, item_name);
-    furi_record_close(RECORD_STORAGE);
+    Loader* loader = furi_record_open(RECORD_LOADER);
+    bool success = flipper_application_meta_cache_load_name_and_icon(
+        loader_get_meta_cache(loader), file_path, icon_ptr, item_name);
+    furi_record_close(RECORD_LOADER);
     return success;
 }
 
@@ -42,51 +42,90 @@ typedef enum {
     UpdateTaskResourcesWeightsFileUnpack = 60,
 } UpdateTaskResourcesWeights;
 
-#define UPDATE_TASK_RESOURCES_FILE_TO_TOTAL_PERCENT 90
+#define UPDATE_TASK_RESOURCES_MANIFEST_NAME "Manifest"
+#define UPDATE_TASK_RESOURCES_NEW_MANIFEST_NAME "Manifest.new"
 
 typedef struct {
     UpdateTask* update_task;
-    int32_t total_files, processed_files;
+    TarArchive* archive;
+    ResourceManifestDiff* diff;
 } TarUnpackProgress;
 
 static bool update_task_resource_unpack_cb(const char* name, bool is_directory, void* context) {
-    UNUSED(name);
-    UNUSED(is_directory);
     TarUnpackProgress* unpack_progress = context;
-    unpack_progress->processed_files++;
-    update_task_set_progress(
-        unpack_progress->update_task,
-        UpdateTaskStageProgress,
-        /* For this stage, last progress segment = extraction */
-        (UpdateTaskResourcesWeightsFileCleanup + UpdateTaskResourcesWeightsDirCleanup) +
-            (unpack_progress->processed_files * UpdateTaskResourcesWeightsFileUnpack) /
-                (unpack_progress->total_files + 1));
-    return true;
+    uint32_t processed = 0, total = 0;
+    if(tar_archive_get_read_progress(unpack_progress->archive, &processed, &total) && total) {
+        update_task_set_progress(
+            unpack_progress->update_task,
+            UpdateTaskStageProgress,
+            /* For this stage, last progress segment = extraction */
+            (UpdateTaskResourcesWeightsFileCleanup + UpdateTaskResourcesWeightsDirCleanup) +
+                (uint64_t)processed * UpdateTaskResourcesWeightsFileUnpack / total);
+    }
+
+    /* Same size and hash as installed file - leave it alone */
+    return is_directory || !unpack_progress->diff ||
+           !resource_manifest_diff_is_unchanged(unpack_progress->diff, name);
 }
 
-static void update_task_cleanup_resources(UpdateTask* update_task, const uint32_t n_tar_entries) {
+/* Compare installed resources with the bundle's manifest, NULL if not possible */
+static ResourceManifestDiff*
+    update_task_diff_resources(UpdateTask* update_task, TarArchive* archive) {
+    ResourceManifestDiff* diff = NULL;
+    FuriString* new_manifest_path = furi_string_alloc();
+    path_concat(
+        furi_string_get_cstr(update_task->update_path),
+        UPDATE_TASK_RESOURCES_NEW_MANIFEST_NAME,
+        new_manifest_path);
+
+    if(tar_archive_unpack_file(
+           archive,
+           UPDATE_TASK_RESOURCES_MANIFEST_NAME,
+           furi_string_get_cstr(new_manifest_path))) {
+        diff = resource_manifest_diff_alloc(
+            update_task->storage,
+            EXT_PATH(UPDATE_TASK_RESOURCES_MANIFEST_NAME),
+            furi_string_get_cstr(new_manifest_path),
+            STORAGE_EXT_PATH_PREFIX);
+    }
+    storage_simply_remove(update_task->storage, furi_string_get_cstr(new_manifest_path));
+
+    if(diff) {
+        FURI_LOG_I(
+            TAG, "%u resource files unchanged", resource_manifest_diff_get_unchanged_count(diff));
+    } else {
+        FURI_LOG_W(TAG, "Can't compare manifests, full resources install");
+    }
+
+    furi_string_free(new_manifest_path);
+    return diff;
+}
+
+static void update_task_cleanup_resources(UpdateTask* update_task, ResourceManifestDiff* diff) {
     ResourceManifestReader* manifest_reader = resource_manifest_reader_alloc(update_task->storage);
     do {
         FURI_LOG_D(TAG, "Cleaning up old manifest");
-        if(!resource_manifest_reader_open(manifest_reader, EXT_PATH("Manifest"))) {
+        if(!resource_manifest_reader_open(
+               manifest_reader, EXT_PATH(UPDATE_TASK_RESOURCES_MANIFEST_NAME))) {
             FURI_LOG_W(TAG, "No existing manifest");
             break;
         }
 
-        const uint32_t n_approx_file_entries =
-            n_tar_entries * UPDATE_TASK_RESOURCES_FILE_TO_TOTAL_PERCENT / 100 + 1;
         uint32_t n_dir_entries = 1;
 
         ResourceManifestEntry* entry_ptr = NULL;
-        uint32_t n_processed_entries = 0;
         while((entry_ptr = resource_manifest_reader_next(manifest_reader))) {
             if(entry_ptr->type == ResourceManifestEntryTypeFile) {
                 update_task_set_progress(
                     update_task,
                     UpdateTaskStageProgress,
                     /* For this stage, first pass = old manifest's file cleanup */
-                    (n_processed_entries++ * UpdateTaskResourcesWeightsFileCleanup) /
-                        n_approx_file_entries);
+                    resource_manifest_reader_get_progress(manifest_reader) *
+                        UpdateTaskResourcesWeightsFileCleanup / 100);
+
+                if(diff && !resource_manifest_diff_is_removed(diff, entry_ptr)) {
+                    continue;
+                }
 
                 FuriString* file_path = furi_string_alloc();
                 path_concat(
@@ -108,7 +147,7 @@ static void update_task_cleanup_resources(UpdateTask* update_task, const uint32_
             }
         }
 
-        n_processed_entries = 0;
+        uint32_t n_processed_entries = 0;
         while((entry_ptr = resource_manifest_reader_previous(manifest_reader))) {
             if(entry_ptr->type == ResourceManifestEntryTypeDirectory) {
                 update_task_set_progress(
@@ -119,6 +158,10 @@ static void update_task_cleanup_resources(UpdateTask* update_task, const uint32_
                         (n_processed_entries++ * UpdateTaskResourcesWeightsDirCleanup) /
                             n_dir_entries);
 
+                if(diff && !resource_manifest_diff_is_removed(diff, entry_ptr)) {
+                    continue;
+                }
+
                 FuriString* folder_path = furi_string_alloc();
 
                 do {
@@ -144,6 +187,9 @@ static void update_task_cleanup_resources(UpdateTask* update_task, const uint32_
         }
     } while(false);
     resource_manifest_reader_free(manifest_reader);
+
+    /* Until the new one is unpacked, installed files don't match any manifest */
+    storage_simply_remove(update_task->storage, EXT_PATH(UPDATE_TASK_RESOURCES_MANIFEST_NAME));
 }
 
 static bool update_task_post_update(UpdateTask* update_task) {
@@ -166,8 +212,8 @@ static bool update_task_post_update(UpdateTask* update_task) {
         if(update_task->state.groups & UpdateTaskStageGroupResources) {
             TarUnpackProgress progress = {
                 .update_task = update_task,
-                .total_files = 0,
-                .processed_files = 0,
+                .archive = archive,
+                .diff = NULL,
             };
             update_task_set_progress(update_task, UpdateTaskStageResourcesUpdate, 0);
 
@@ -180,12 +226,14 @@ static bool update_task_post_update(UpdateTask* update_task) {
             CHECK_RESULT(
                 tar_archive_open(archive, furi_string_get_cstr(file_path), TAR_OPEN_MODE_READ));
 
-            progress.total_files = tar_archive_get_entries_count(archive);
-            if(progress.total_files > 0) {
-                update_task_cleanup_resources(update_task, progress.total_files);
+            progress.diff = update_task_diff_resources(update_task, archive);
+            update_task_cleanup_resources(update_task, progress.diff);
 
-                CHECK_RESULT(tar_archive_unpack_to(archive, STORAGE_EXT_PATH_PREFIX, NULL));
+            bool unpacked = tar_archive_unpack_to(archive, STORAGE_EXT_PATH_PREFIX, NULL);
+            if(progress.diff) {
+                resource_manifest_diff_free(progress.diff);
             }
+            CHECK_RESULT(unpacked);
         }
 
         if(update_task->state.groups & UpdateTaskStageGroupSplashscreen) {
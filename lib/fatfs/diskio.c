@@ -13,6 +13,8 @@
 /* Includes ------------------------------------------------------------------*/
 #include "diskio.h"
 #include "ff_gen_drv.h"
+#include "diskio_cache.h"
+#include <string.h>
 
 #if defined ( __GNUC__ )
 #ifndef __weak
@@ -22,11 +24,68 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+/* Sector cache geometry, DISKIO_CACHE_LINES set to 0 disables the cache */
+#ifndef DISKIO_CACHE_LINES
+#define DISKIO_CACHE_LINES 4
+#endif
+#ifndef DISKIO_CACHE_LINE_SECTORS
+#define DISKIO_CACHE_LINE_SECTORS 2
+#endif
+#ifndef DISKIO_CACHE_READAHEAD_LINES
+#define DISKIO_CACHE_READAHEAD_LINES 2
+#endif
+
 /* Private variables ---------------------------------------------------------*/
 extern Disk_drvTypeDef  disk;
 
+#if DISKIO_CACHE_LINES > 0 && _USE_WRITE == 1
+static DiskioCache* disk_cache[_VOLUMES];
+#endif
+
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
+#if DISKIO_CACHE_LINES > 0 && _USE_WRITE == 1
+static DRESULT disk_cache_read(void* context, BYTE* buff, DWORD sector, UINT count)
+{
+  BYTE pdrv = (BYTE)(uintptr_t)context;
+  return disk.drv[pdrv]->disk_read(disk.lun[pdrv], buff, sector, count);
+}
+
+static DRESULT disk_cache_write(void* context, const BYTE* buff, DWORD sector, UINT count)
+{
+  BYTE pdrv = (BYTE)(uintptr_t)context;
+  return disk.drv[pdrv]->disk_write(disk.lun[pdrv], buff, sector, count);
+}
+
+/* Called on every mount: the medium may have changed since the last one */
+static void disk_cache_init(BYTE pdrv)
+{
+  if(disk_cache[pdrv] == NULL)
+  {
+    disk_cache[pdrv] = diskio_cache_alloc(
+      DISKIO_CACHE_LINES,
+      DISKIO_CACHE_LINE_SECTORS,
+      DISKIO_CACHE_READAHEAD_LINES,
+      _MAX_SS,
+      disk_cache_read,
+      disk_cache_write,
+      (void*)(uintptr_t)pdrv);
+  }
+  else
+  {
+    diskio_cache_invalidate(disk_cache[pdrv]);
+  }
+
+#if _USE_IOCTL == 1
+  DWORD sector_count = 0;
+  if(disk.drv[pdrv]->disk_ioctl(disk.lun[pdrv], GET_SECTOR_COUNT, &sector_count) != RES_OK)
+  {
+    sector_count = 0;
+  }
+  diskio_cache_set_sector_count(disk_cache[pdrv], sector_count);
+#endif /* _USE_IOCTL == 1 */
+}
+#endif
 
 /**
   * @brief  Gets Disk Status
@@ -59,6 +118,12 @@ DSTATUS disk_initialize (
     disk.is_initialized[pdrv] = 1;
     stat = disk.drv[pdrv]->disk_initialize(disk.lun[pdrv]);
   }
+#if DISKIO_CACHE_LINES > 0 && _USE_WRITE == 1
+  if(!(stat & STA_NOINIT))
+  {
+    disk_cache_init(pdrv);
+  }
+#endif
   return stat;
 }
 
@@ -79,7 +144,16 @@ DRESULT disk_read (
 {
   DRESULT res;
 
-  res = disk.drv[pdrv]->disk_read(disk.lun[pdrv], buff, sector, count);
+#if DISKIO_CACHE_LINES > 0 && _USE_WRITE == 1
+  if(disk_cache[pdrv] != NULL)
+  {
+    res = diskio_cache_read(disk_cache[pdrv], buff, sector, count);
+  }
+  else
+#endif
+  {
+    res = disk.drv[pdrv]->disk_read(disk.lun[pdrv], buff, sector, count);
+  }
   return res;
 }
 
@@ -101,7 +175,16 @@ DRESULT disk_write (
 {
   DRESULT res;
 
-  res = disk.drv[pdrv]->disk_write(disk.lun[pdrv], buff, sector, count);
+#if DISKIO_CACHE_LINES > 0
+  if(disk_cache[pdrv] != NULL)
+  {
+    res = diskio_cache_write(disk_cache[pdrv], buff, sector, count);
+  }
+  else
+#endif
+  {
+    res = disk.drv[pdrv]->disk_write(disk.lun[pdrv], buff, sector, count);
+  }
   return res;
 }
 #endif /* _USE_WRITE == 1 */
@@ -122,11 +205,45 @@ DRESULT disk_ioctl (
 {
   DRESULT res;
 
+#if DISKIO_CACHE_LINES > 0 && _USE_WRITE == 1
+  /* FatFs syncs on f_sync, f_close and after every metadata update */
+  if(cmd == CTRL_SYNC && disk_cache[pdrv] != NULL)
+  {
+    res = diskio_cache_sync(disk_cache[pdrv]);
+    if(res != RES_OK)
+    {
+      return res;
+    }
+  }
+#endif
   res = disk.drv[pdrv]->disk_ioctl(disk.lun[pdrv], cmd, buff);
   return res;
 }
 #endif /* _USE_IOCTL == 1 */
 
+/**
+  * @brief  Gets sector cache counters
+  * @param  pdrv: Physical drive number (0..)
+  * @param  stats: Counters
+  * @retval DRESULT: RES_NOTRDY if the drive has no cache
+  */
+DRESULT disk_cache_get_stats (
+	BYTE pdrv,
+	DiskioCacheStats* stats
+)
+{
+#if DISKIO_CACHE_LINES > 0 && _USE_WRITE == 1
+  if(pdrv < _VOLUMES && disk_cache[pdrv] != NULL)
+  {
+    diskio_cache_get_stats(disk_cache[pdrv], stats);
+    return RES_OK;
+  }
+#endif
+  (void)pdrv;
+  memset(stats, 0, sizeof(DiskioCacheStats));
+  return RES_NOTRDY;
+}
+
 /**
   * @brief  Gets Time from RTC
   * @param  None
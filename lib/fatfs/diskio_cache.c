@@ -0,0 +1,413 @@
+#include "diskio_cache.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define DISKIO_CACHE_BLOCK_NONE (0xFFFFFFFFUL)
+#define DISKIO_CACHE_LINE_NONE SIZE_MAX
+
+typedef struct {
+    DWORD block;
+    uint32_t valid;
+    uint32_t dirty;
+    uint32_t last_used;
+} DiskioCacheLine;
+
+struct DiskioCache {
+    DiskioCacheLine* lines;
+    BYTE* data;
+    size_t lines_count;
+    size_t line_sectors;
+    size_t readahead_lines;
+    size_t sector_size;
+
+    DiskioCacheReadCallback read;
+    DiskioCacheWriteCallback write;
+    void* context;
+
+    DWORD sector_count;
+    DWORD next_sector;
+    uint32_t clock;
+    DiskioCacheStats stats;
+};
+
+static inline uint32_t diskio_cache_run_mask(size_t start, size_t end) {
+    const size_t length = end - start;
+    const uint32_t mask = (length >= 32) ? UINT32_MAX : ((1UL << length) - 1);
+    return mask << start;
+}
+
+static inline BYTE* diskio_cache_line_data(DiskioCache* cache, size_t index, size_t offset) {
+    return cache->data + (index * cache->line_sectors + offset) * cache->sector_size;
+}
+
+static size_t diskio_cache_line_limit(DiskioCache* cache, DWORD block) {
+    const DWORD first = block * cache->line_sectors;
+    if(cache->sector_count == 0) {
+        return cache->line_sectors;
+    } else if(first >= cache->sector_count) {
+        return 0;
+    } else {
+        const DWORD left = cache->sector_count - first;
+        return (left < cache->line_sectors) ? left : cache->line_sectors;
+    }
+}
+
+static size_t diskio_cache_find(DiskioCache* cache, DWORD block) {
+    for(size_t i = 0; i < cache->lines_count; i++) {
+        if(cache->lines[i].block == block) {
+            return i;
+        }
+    }
+    return DISKIO_CACHE_LINE_NONE;
+}
+
+static DRESULT diskio_cache_device_read(DiskioCache* cache, BYTE* buff, DWORD sector, UINT count) {
+    cache->stats.device_reads++;
+    return cache->read(cache->context, buff, sector, count);
+}
+
+static DRESULT
+    diskio_cache_device_write(DiskioCache* cache, const BYTE* buff, DWORD sector, UINT count) {
+    cache->stats.device_writes++;
+    return cache->write(cache->context, buff, sector, count);
+}
+
+static DRESULT diskio_cache_flush_line(DiskioCache* cache, size_t index) {
+    DiskioCacheLine* line = &cache->lines[index];
+    size_t start = 0;
+
+    while(line->dirty && start < cache->line_sectors) {
+        if(!(line->dirty & (1UL << start))) {
+            start++;
+            continue;
+        }
+
+        size_t end = start;
+        while(end < cache->line_sectors && (line->dirty & (1UL << end))) {
+            end++;
+        }
+
+        DRESULT res = diskio_cache_device_write(
+            cache,
+            diskio_cache_line_data(cache, index, start),
+            line->block * cache->line_sectors + start,
+            end - start);
+        if(res != RES_OK) {
+            return res;
+        }
+
+        cache->stats.write_flushed += end - start;
+        line->dirty &= ~diskio_cache_run_mask(start, end);
+        start = end;
+    }
+
+    return RES_OK;
+}
+
+static DRESULT diskio_cache_evict(DiskioCache* cache, size_t index) {
+    DRESULT res = diskio_cache_flush_line(cache, index);
+    if(res == RES_OK) {
+        DiskioCacheLine* line = &cache->lines[index];
+        line->block = DISKIO_CACHE_BLOCK_NONE;
+        line->valid = 0;
+        line->last_used = 0;
+    }
+    return res;
+}
+
+static DRESULT diskio_cache_allocate(DiskioCache* cache, DWORD block, size_t* index) {
+    size_t victim = 0;
+    for(size_t i = 0; i < cache->lines_count; i++) {
+        if(cache->lines[i].last_used < cache->lines[victim].last_used) {
+            victim = i;
+        }
+    }
+
+    DRESULT res = diskio_cache_evict(cache, victim);
+    if(res == RES_OK) {
+        cache->lines[victim].block = block;
+        cache->lines[victim].last_used = ++cache->clock;
+        *index = victim;
+    }
+    return res;
+}
+
+/* Read all sectors of the line that are not cached yet, one command per run */
+static DRESULT diskio_cache_fill(DiskioCache* cache, size_t index) {
+    DiskioCacheLine* line = &cache->lines[index];
+    const size_t limit = diskio_cache_line_limit(cache, line->block);
+    size_t start = 0;
+
+    while(start < limit) {
+        if(line->valid & (1UL << start)) {
+            start++;
+            continue;
+        }
+
+        size_t end = start;
+        while(end < limit && !(line->valid & (1UL << end))) {
+            end++;
+        }
+
+        DRESULT res = diskio_cache_device_read(
+            cache,
+            diskio_cache_line_data(cache, index, start),
+            line->block * cache->line_sectors + start,
+            end - start);
+        if(res != RES_OK) {
+            return res;
+        }
+
+        line->valid |= diskio_cache_run_mask(start, end);
+        start = end;
+    }
+
+    return RES_OK;
+}
+
+/* Fill a run of lines that are adjacent in memory with one command */
+static DRESULT diskio_cache_readahead(DiskioCache* cache, DWORD block, size_t* index) {
+    size_t count = 1;
+    while(count < cache->readahead_lines &&
+          diskio_cache_find(cache, block + count) == DISKIO_CACHE_LINE_NONE &&
+          diskio_cache_line_limit(cache, block + count) == cache->line_sectors) {
+        count++;
+    }
+
+    // Slots with the oldest most recent use
+    size_t first = 0;
+    uint32_t first_age = UINT32_MAX;
+    for(size_t i = 0; i + count <= cache->lines_count; i++) {
+        uint32_t age = 0;
+        for(size_t j = i; j < i + count; j++) {
+            if(cache->lines[j].last_used > age) {
+                age = cache->lines[j].last_used;
+            }
+        }
+        if(age < first_age) {
+            first_age = age;
+            first = i;
+        }
+    }
+
+    for(size_t i = first; i < first + count; i++) {
+        DRESULT res = diskio_cache_evict(cache, i);
+        if(res != RES_OK) {
+            return res;
+        }
+    }
+
+    const size_t limit = diskio_cache_line_limit(cache, block);
+    const size_t sectors = (count - 1) * cache->line_sectors + limit;
+    DRESULT res = diskio_cache_device_read(
+        cache, diskio_cache_line_data(cache, first, 0), block * cache->line_sectors, sectors);
+    if(res != RES_OK) {
+        return res;
+    }
+
+    for(size_t i = 0; i < count; i++) {
+        DiskioCacheLine* line = &cache->lines[first + i];
+        line->block = block + i;
+        line->valid = diskio_cache_run_mask(0, (i == 0) ? limit : cache->line_sectors);
+        line->last_used = ++cache->clock;
+    }
+    cache->stats.prefetched += sectors - limit;
+
+    *index = first;
+    return RES_OK;
+}
+
+DiskioCache* diskio_cache_alloc(
+    size_t lines,
+    size_t line_sectors,
+    size_t readahead_lines,
+    size_t sector_size,
+    DiskioCacheReadCallback read,
+    DiskioCacheWriteCallback write,
+    void* context) {
+    if(lines == 0 || line_sectors == 0 || line_sectors > DISKIO_CACHE_LINE_SECTORS_MAX ||
+       sector_size == 0) {
+        return NULL;
+    }
+
+    DiskioCache* cache = malloc(sizeof(DiskioCache));
+    memset(cache, 0, sizeof(DiskioCache));
+
+    cache->lines_count = lines;
+    cache->line_sectors = line_sectors;
+    cache->readahead_lines =
+        (readahead_lines == 0) ? 1 : ((readahead_lines > lines) ? lines : readahead_lines);
+    cache->sector_size = sector_size;
+    cache->read = read;
+    cache->write = write;
+    cache->context = context;
+
+    cache->lines = malloc(sizeof(DiskioCacheLine) * lines);
+    cache->data = malloc(lines * line_sectors * sector_size);
+    diskio_cache_invalidate(cache);
+
+    return cache;
+}
+
+void diskio_cache_free(DiskioCache* cache) {
+    free(cache->data);
+    free(cache->lines);
+    free(cache);
+}
+
+void diskio_cache_set_sector_count(DiskioCache* cache, DWORD sector_count) {
+    cache->sector_count = sector_count;
+}
+
+DRESULT diskio_cache_read(DiskioCache* cache, BYTE* buff, DWORD sector, UINT count) {
+    const bool sequential = (sector == cache->next_sector);
+    cache->next_sector = sector + count;
+
+    if(count > cache->line_sectors) {
+        DRESULT res = diskio_cache_device_read(cache, buff, sector, count);
+        if(res != RES_OK) {
+            return res;
+        }
+        cache->stats.read_bypass += count;
+
+        // Held back writes are newer than the device
+        for(size_t i = 0; i < cache->lines_count; i++) {
+            const DiskioCacheLine* line = &cache->lines[i];
+            for(size_t j = 0; line->dirty && j < cache->line_sectors; j++) {
+                const DWORD dirty_sector = line->block * cache->line_sectors + j;
+                if((line->dirty & (1UL << j)) && dirty_sector >= sector &&
+                   dirty_sector - sector < count) {
+                    memcpy(
+                        buff + (dirty_sector - sector) * cache->sector_size,
+                        diskio_cache_line_data(cache, i, j),
+                        cache->sector_size);
+                }
+            }
+        }
+
+        return RES_OK;
+    }
+
+    for(UINT n = 0; n < count; n++) {
+        const DWORD block = (sector + n) / cache->line_sectors;
+        const size_t offset = (sector + n) % cache->line_sectors;
+        size_t index = diskio_cache_find(cache, block);
+
+        if(index != DISKIO_CACHE_LINE_NONE && (cache->lines[index].valid & (1UL << offset))) {
+            cache->stats.read_hits++;
+        } else {
+            cache->stats.read_misses++;
+
+            DRESULT res;
+            if(index != DISKIO_CACHE_LINE_NONE) {
+                res = diskio_cache_fill(cache, index);
+            } else if(sequential && cache->readahead_lines > 1) {
+                res = diskio_cache_readahead(cache, block, &index);
+            } else {
+                res = diskio_cache_allocate(cache, block, &index);
+                if(res == RES_OK) {
+                    res = diskio_cache_fill(cache, index);
+                }
+            }
+
+            if(res != RES_OK) {
+                return res;
+            } else if(!(cache->lines[index].valid & (1UL << offset))) {
+                // Past the end of the device
+                return RES_PARERR;
+            }
+        }
+
+        memcpy(
+            buff + n * cache->sector_size,
+            diskio_cache_line_data(cache, index, offset),
+            cache->sector_size);
+        cache->lines[index].last_used = ++cache->clock;
+    }
+
+    return RES_OK;
+}
+
+DRESULT diskio_cache_write(DiskioCache* cache, const BYTE* buff, DWORD sector, UINT count) {
+    if(count > cache->line_sectors) {
+        DRESULT res = diskio_cache_device_write(cache, buff, sector, count);
+        if(res != RES_OK) {
+            return res;
+        }
+        cache->stats.write_bypass += count;
+
+        // Keep cached copies in sync, the device has the newest data now
+        for(size_t i = 0; i < cache->lines_count; i++) {
+            DiskioCacheLine* line = &cache->lines[i];
+            for(size_t j = 0; line->valid && j < cache->line_sectors; j++) {
+                const DWORD cached_sector = line->block * cache->line_sectors + j;
+                if((line->valid & (1UL << j)) && cached_sector >= sector &&
+                   cached_sector - sector < count) {
+                    memcpy(
+                        diskio_cache_line_data(cache, i, j),
+                        buff + (cached_sector - sector) * cache->sector_size,
+                        cache->sector_size);
+                    line->dirty &= ~(1UL << j);
+                }
+            }
+        }
+
+        return RES_OK;
+    }
+
+    for(UINT n = 0; n < count; n++) {
+        const DWORD block = (sector + n) / cache->line_sectors;
+        const size_t offset = (sector + n) % cache->line_sectors;
+        size_t index = diskio_cache_find(cache, block);
+
+        if(index == DISKIO_CACHE_LINE_NONE) {
+            DRESULT res = diskio_cache_allocate(cache, block, &index);
+            if(res != RES_OK) {
+                return res;
+            }
+        }
+
+        DiskioCacheLine* line = &cache->lines[index];
+        memcpy(
+            diskio_cache_line_data(cache, index, offset),
+            buff + n * cache->sector_size,
+            cache->sector_size);
+        line->valid |= 1UL << offset;
+        line->dirty |= 1UL << offset;
+        line->last_used = ++cache->clock;
+        cache->stats.write_absorbed++;
+    }
+
+    return RES_OK;
+}
+
+DRESULT diskio_cache_sync(DiskioCache* cache) {
+    for(size_t i = 0; i < cache->lines_count; i++) {
+        DRESULT res = diskio_cache_flush_line(cache, i);
+        if(res != RES_OK) {
+            return res;
+        }
+    }
+
+    return RES_OK;
+}
+
+void diskio_cache_invalidate(DiskioCache* cache) {
+    for(size_t i = 0; i < cache->lines_count; i++) {
+        cache->lines[i].block = DISKIO_CACHE_BLOCK_NONE;
+        cache->lines[i].valid = 0;
+        cache->lines[i].dirty = 0;
+        cache->lines[i].last_used = 0;
+    }
+    cache->next_sector = DISKIO_CACHE_BLOCK_NONE;
+    cache->clock = 0;
+}
+
+void diskio_cache_get_stats(DiskioCache* cache, DiskioCacheStats* stats) {
+    *stats = cache->stats;
+}
+
+void diskio_cache_reset_stats(DiskioCache* cache) {
+    memset(&cache->stats, 0, sizeof(DiskioCacheStats));
+}
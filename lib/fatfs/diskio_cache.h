@@ -0,0 +1,138 @@
+/**
+ * @file diskio_cache.h
+ * Sector cache between FatFs and a block device
+ *
+ * Sectors are cached in lines of consecutive, line-aligned sectors with LRU
+ * replacement. A read miss fills the whole line with one multi-sector command.
+ * A miss that continues a sequential read fills a run of lines that are
+ * adjacent in memory, so it reads ahead with one command as well.
+ * Writes are held back and coalesced into runs that are written out on
+ * diskio_cache_sync, when a dirty line is evicted, or when a large write
+ * goes straight to the device.
+ * Transfers that are larger than a line bypass the cache, but still see
+ * the cached dirty data.
+ */
+#pragma once
+
+#include "integer.h"
+#include "diskio.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DISKIO_CACHE_LINE_SECTORS_MAX (32U)
+
+typedef struct DiskioCache DiskioCache;
+
+typedef DRESULT (*DiskioCacheReadCallback)(void* context, BYTE* buff, DWORD sector, UINT count);
+
+typedef DRESULT (
+    *DiskioCacheWriteCallback)(void* context, const BYTE* buff, DWORD sector, UINT count);
+
+typedef struct {
+    uint32_t read_hits; /**< requested sectors served from the cache */
+    uint32_t read_misses; /**< requested sectors that had to be fetched */
+    uint32_t read_bypass; /**< requested sectors read past the cache */
+    uint32_t prefetched; /**< sectors fetched ahead of a sequential reader */
+    uint32_t write_absorbed; /**< sector writes held back in the cache */
+    uint32_t write_bypass; /**< sectors written past the cache */
+    uint32_t write_flushed; /**< held back sectors written out */
+    uint32_t device_reads; /**< read commands issued to the device */
+    uint32_t device_writes; /**< write commands issued to the device */
+} DiskioCacheStats;
+
+/**
+ * Allocate a cache
+ * @param lines number of cache lines
+ * @param line_sectors sectors per line, 1..DISKIO_CACHE_LINE_SECTORS_MAX
+ * @param readahead_lines lines filled by a sequential miss, 1 disables readahead
+ * @param sector_size sector size in bytes
+ * @param read device read callback
+ * @param write device write callback
+ * @param context callbacks context
+ * @return DiskioCache*
+ */
+DiskioCache* diskio_cache_alloc(
+    size_t lines,
+    size_t line_sectors,
+    size_t readahead_lines,
+    size_t sector_size,
+    DiskioCacheReadCallback read,
+    DiskioCacheWriteCallback write,
+    void* context);
+
+/**
+ * Free the cache. Dirty sectors are dropped, sync first.
+ * @param cache
+ */
+void diskio_cache_free(DiskioCache* cache);
+
+/**
+ * Set the device size, fills and readahead never go past it
+ * @param cache
+ * @param sector_count sector count, 0 if unknown
+ */
+void diskio_cache_set_sector_count(DiskioCache* cache, DWORD sector_count);
+
+/**
+ * Read sectors through the cache
+ * @param cache
+ * @param buff
+ * @param sector
+ * @param count
+ * @return DRESULT
+ */
+DRESULT diskio_cache_read(DiskioCache* cache, BYTE* buff, DWORD sector, UINT count);
+
+/**
+ * Write sectors through the cache
+ * @param cache
+ * @param buff
+ * @param sector
+ * @param count
+ * @return DRESULT
+ */
+DRESULT diskio_cache_write(DiskioCache* cache, const BYTE* buff, DWORD sector, UINT count);
+
+/**
+ * Write all held back sectors to the device
+ * @param cache
+ * @return DRESULT
+ */
+DRESULT diskio_cache_sync(DiskioCache* cache);
+
+/**
+ * Drop all cached sectors, including the dirty ones. Use when the medium changes.
+ * @param cache
+ */
+void diskio_cache_invalidate(DiskioCache* cache);
+
+/**
+ * Get the cache counters
+ * @param cache
+ * @param stats
+ */
+void diskio_cache_get_stats(DiskioCache* cache, DiskioCacheStats* stats);
+
+/**
+ * Reset the cache counters
+ * @param cache
+ */
+void diskio_cache_reset_stats(DiskioCache* cache);
+
+/**
+ * Get the counters of the cache that diskio keeps for a drive
+ * @param pdrv physical drive number
+ * @param stats
+ * @return DRESULT RES_NOTRDY if the drive is not cached
+ */
+DRESULT disk_cache_get_stats(BYTE pdrv, DiskioCacheStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,558 @@
+#include "application_meta_cache.h"
+#include "flipper_application.h"
+
+#include <toolbox/crc32_calc.h>
+#include <toolbox/dir_walk.h>
+#include <toolbox/path.h>
+#include <toolbox/stream/buffered_file_stream.h>
+#include <loader/firmware_api/firmware_api.h>
+
+#include <m-dict.h>
+#include <m-array.h>
+
+#define TAG "FapMetaCache"
+
+#define META_CACHE_MAGIC 0x434D4146 // "FAMC"
+#define META_CACHE_VERSION 1
+#define META_CACHE_PAYLOAD_SIZE_MAX (64 * 1024)
+#define META_CACHE_APP_EXTENSION ".fap"
+#define META_CACHE_PATH_SIZE_MAX 256
+#define META_CACHE_PATH_CHUNK_SIZE 64
+#define META_CACHE_WORKER_STACK_SIZE (3 * 1024)
+// Entries are saved and dropped from memory after this long without lookups
+#define META_CACHE_IDLE_TIMEOUT_MS 10000
+
+typedef enum {
+    MetaCacheEvtStop = (1 << 0),
+    MetaCacheEvtRefresh = (1 << 1),
+    MetaCacheEvtTouch = (1 << 2),
+    MetaCacheEvtCardMount = (1 << 3),
+    MetaCacheEvtCardUnmount = (1 << 4),
+} MetaCacheEvtFlags;
+
+#define META_CACHE_EVT_ALL                                                              \
+    (MetaCacheEvtStop | MetaCacheEvtRefresh | MetaCacheEvtTouch | MetaCacheEvtCardMount | \
+     MetaCacheEvtCardUnmount)
+
+#pragma pack(push, 1)
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;
+    uint32_t record_count;
+    uint32_t payload_size;
+    uint32_t payload_crc;
+    uint32_t header_crc;
+} MetaCacheHeader;
+
+/** Cache file record, followed by path_size bytes of path without terminator */
+typedef struct {
+    uint32_t source_size;
+    uint32_t source_timestamp;
+    uint8_t has_manifest;
+    uint16_t path_size;
+    FlipperApplicationManifest manifest;
+} MetaCacheRecord;
+
+#pragma pack(pop)
+
+typedef struct {
+    uint32_t source_size;
+    uint32_t source_timestamp;
+    bool has_manifest;
+    bool seen;
+    FlipperApplicationManifest manifest;
+} MetaCacheEntry;
+
+DICT_DEF2(MetaCacheDict, FuriString*, FURI_STRING_OPLIST, MetaCacheEntry, M_POD_OPLIST)
+ARRAY_DEF(MetaCachePathArray, FuriString*, FURI_STRING_OPLIST)
+
+struct FlipperApplicationMetaCache {
+    Storage* storage;
+    FuriString* cache_path;
+    FuriString* apps_path;
+
+    FuriThread* thread;
+    FuriPubSubSubscription* storage_subscription;
+
+    FuriMutex* mutex;
+    MetaCacheDict_t entries;
+    bool loaded;
+    bool dirty;
+};
+
+static uint32_t meta_cache_header_crc(const MetaCacheHeader* header) {
+    return crc32_calc_buffer(0, header, offsetof(MetaCacheHeader, header_crc));
+}
+
+static bool meta_cache_get_source(Storage* storage, const char* path, MetaCacheEntry* entry) {
+    FileInfo file_info;
+    if(storage_common_stat(storage, path, &file_info) != FSE_OK) return false;
+    if(file_info_is_dir(&file_info)) return false;
+    if(storage_common_timestamp(storage, path, &entry->source_timestamp) != FSE_OK) {
+        return false;
+    }
+    entry->source_size = file_info.size;
+    return true;
+}
+
+static bool meta_cache_read_record(
+    Stream* stream,
+    uint32_t* crc,
+    MetaCacheRecord* record,
+    FuriString* path) {
+    if(stream_read(stream, (uint8_t*)record, sizeof(MetaCacheRecord)) != sizeof(MetaCacheRecord)) {
+        return false;
+    }
+    *crc = crc32_calc_buffer(*crc, record, sizeof(MetaCacheRecord));
+    if(record->path_size > META_CACHE_PATH_SIZE_MAX) return false;
+
+    furi_string_reset(path);
+    furi_string_reserve(path, record->path_size + 1);
+    char buffer[META_CACHE_PATH_CHUNK_SIZE];
+    size_t left = record->path_size;
+    while(left) {
+        const size_t chunk = MIN(left, sizeof(buffer));
+        if(stream_read(stream, (uint8_t*)buffer, chunk) != chunk) return false;
+        *crc = crc32_calc_buffer(*crc, buffer, chunk);
+        for(size_t i = 0; i < chunk; i++) {
+            furi_string_push_back(path, buffer[i]);
+        }
+        left -= chunk;
+    }
+
+    return true;
+}
+
+/* Must be called with mutex acquired */
+static void meta_cache_load(FlipperApplicationMetaCache* cache) {
+    if(cache->loaded) return;
+
+    // Missing or broken file is the same as an empty cache
+    cache->loaded = true;
+    cache->dirty = false;
+
+    MetaCacheHeader header;
+    Stream* stream = buffered_file_stream_alloc(cache->storage);
+    FuriString* path = furi_string_alloc();
+
+    do {
+        if(!buffered_file_stream_open(
+               stream, furi_string_get_cstr(cache->cache_path), FSAM_READ, FSOM_OPEN_EXISTING)) {
+            break;
+        }
+        if(stream_read(stream, (uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+           header.header_crc != meta_cache_header_crc(&header) ||
+           header.magic != META_CACHE_MAGIC || header.version != META_CACHE_VERSION ||
+           header.record_size != sizeof(MetaCacheRecord) ||
+           header.payload_size > META_CACHE_PAYLOAD_SIZE_MAX) {
+            FURI_LOG_W(TAG, "Header mismatch");
+            break;
+        }
+
+        // Records are read one by one, payload checksum is known only after the last one
+        uint32_t crc = 0;
+        bool valid = true;
+        for(uint32_t i = 0; valid && (i < header.record_count); i++) {
+            MetaCacheRecord record;
+            valid = meta_cache_read_record(stream, &crc, &record, path);
+            if(valid) {
+                MetaCacheEntry entry = {
+                    .source_size = record.source_size,
+                    .source_timestamp = record.source_timestamp,
+                    .has_manifest = record.has_manifest,
+                    .seen = false,
+                    .manifest = record.manifest,
+                };
+                MetaCacheDict_set_at(cache->entries, path, entry);
+            }
+        }
+
+        if(!valid || stream_tell(stream) != sizeof(header) + header.payload_size ||
+           crc != header.payload_crc) {
+            FURI_LOG_W(TAG, "Payload corrupted");
+            MetaCacheDict_reset(cache->entries);
+            break;
+        }
+
+        FURI_LOG_D(TAG, "Loaded %zu entries", MetaCacheDict_size(cache->entries));
+    } while(false);
+
+    furi_string_free(path);
+    buffered_file_stream_close(stream);
+    stream_free(stream);
+}
+
+static void meta_cache_record_from_entry(
+    MetaCacheRecord* record,
+    const FuriString* path,
+    const MetaCacheEntry* entry) {
+    record->source_size = entry->source_size;
+    record->source_timestamp = entry->source_timestamp;
+    record->has_manifest = entry->has_manifest;
+    record->path_size = furi_string_size(path);
+    record->manifest = entry->manifest;
+}
+
+/* Must be called with mutex acquired */
+static void meta_cache_save(FlipperApplicationMetaCache* cache) {
+    if(!cache->loaded || !cache->dirty) return;
+
+    MetaCacheHeader header = {
+        .magic = META_CACHE_MAGIC,
+        .version = META_CACHE_VERSION,
+        .record_size = sizeof(MetaCacheRecord),
+        .record_count = 0,
+        .payload_size = 0,
+        .payload_crc = 0,
+    };
+
+    // First pass sizes the payload and checksums it, so that records are written as they go
+    MetaCacheRecord record;
+    MetaCacheDict_it_t it;
+    for(MetaCacheDict_it(it, cache->entries); !MetaCacheDict_end_p(it); MetaCacheDict_next(it)) {
+        const MetaCacheDict_itref_t* itref = MetaCacheDict_cref(it);
+        meta_cache_record_from_entry(&record, itref->key, &itref->value);
+        header.payload_crc = crc32_calc_buffer(header.payload_crc, &record, sizeof(record));
+        header.payload_crc = crc32_calc_buffer(
+            header.payload_crc, furi_string_get_cstr(itref->key), record.path_size);
+        header.payload_size += sizeof(record) + record.path_size;
+        header.record_count++;
+    }
+
+    if(header.payload_size > META_CACHE_PAYLOAD_SIZE_MAX) {
+        FURI_LOG_W(TAG, "Too many entries, not saved");
+        cache->dirty = false;
+        return;
+    }
+    header.header_crc = meta_cache_header_crc(&header);
+
+    // Cache usually lives in apps_data, which may not exist yet either
+    FuriString* folder = furi_string_alloc();
+    FuriString* parent = furi_string_alloc();
+    path_extract_dirname(furi_string_get_cstr(cache->cache_path), folder);
+    path_extract_dirname(furi_string_get_cstr(folder), parent);
+    storage_simply_mkdir(cache->storage, furi_string_get_cstr(parent));
+    storage_simply_mkdir(cache->storage, furi_string_get_cstr(folder));
+    furi_string_free(parent);
+    furi_string_free(folder);
+
+    Stream* stream = buffered_file_stream_alloc(cache->storage);
+    bool result = buffered_file_stream_open(
+                      stream,
+                      furi_string_get_cstr(cache->cache_path),
+                      FSAM_WRITE,
+                      FSOM_CREATE_ALWAYS) &&
+                  stream_write(stream, (const uint8_t*)&header, sizeof(header)) == sizeof(header);
+
+    for(MetaCacheDict_it(it, cache->entries); result && !MetaCacheDict_end_p(it);
+        MetaCacheDict_next(it)) {
+        const MetaCacheDict_itref_t* itref = MetaCacheDict_cref(it);
+        meta_cache_record_from_entry(&record, itref->key, &itref->value);
+        result = stream_write(stream, (const uint8_t*)&record, sizeof(record)) ==
+                     sizeof(record) &&
+                 stream_write(
+                     stream,
+                     (const uint8_t*)furi_string_get_cstr(itref->key),
+                     record.path_size) == record.path_size;
+    }
+    // Close flushes the cache, so it has to succeed too
+    result = buffered_file_stream_close(stream) && result;
+    stream_free(stream);
+
+    if(result) {
+        FURI_LOG_D(TAG, "Saved %lu entries", header.record_count);
+        cache->dirty = false;
+    } else {
+        FURI_LOG_E(TAG, "Save failed");
+    }
+}
+
+/* Must be called with mutex acquired */
+static void meta_cache_unload(FlipperApplicationMetaCache* cache) {
+    MetaCacheDict_reset(cache->entries);
+    cache->loaded = false;
+    cache->dirty = false;
+}
+
+static void meta_cache_parse(Storage* storage, const char* path, MetaCacheEntry* entry) {
+    FlipperApplication* app = flipper_application_alloc(storage, firmware_api_interface);
+    FlipperApplicationPreloadStatus status = flipper_application_preload_manifest(app, path);
+
+    // API and target checks are redone on every lookup, firmware may be updated meanwhile
+    entry->has_manifest = (status == FlipperApplicationPreloadStatusSuccess) ||
+                          (status == FlipperApplicationPreloadStatusApiTooOld) ||
+                          (status == FlipperApplicationPreloadStatusApiTooNew) ||
+                          (status == FlipperApplicationPreloadStatusTargetMismatch);
+    if(entry->has_manifest) {
+        memcpy(&entry->manifest, flipper_application_get_manifest(app), sizeof(entry->manifest));
+    } else {
+        FURI_LOG_E(TAG, "Failed to preload %s", path);
+        memset(&entry->manifest, 0, sizeof(entry->manifest));
+    }
+
+    flipper_application_free(app);
+}
+
+static bool meta_cache_lookup(
+    FlipperApplicationMetaCache* cache,
+    FuriString* path,
+    MetaCacheEntry* entry) {
+    MetaCacheEntry source;
+    if(!meta_cache_get_source(cache->storage, furi_string_get_cstr(path), &source)) {
+        return false;
+    }
+
+    bool hit = false;
+    furi_check(furi_mutex_acquire(cache->mutex, FuriWaitForever) == FuriStatusOk);
+    meta_cache_load(cache);
+    MetaCacheEntry* cached = MetaCacheDict_get(cache->entries, path);
+    if(cached && cached->source_size == source.source_size &&
+       cached->source_timestamp == source.source_timestamp) {
+        cached->seen = true;
+        *entry = *cached;
+        hit = true;
+    }
+    furi_mutex_release(cache->mutex);
+
+    // Parse without holding the mutex, other lookups may be served meanwhile
+    if(!hit) {
+        *entry = source;
+        entry->seen = true;
+        meta_cache_parse(cache->storage, furi_string_get_cstr(path), entry);
+    }
+
+    // Load rejects longer paths, one such record would invalidate the whole file
+    if(!hit && furi_string_size(path) <= META_CACHE_PATH_SIZE_MAX) {
+        furi_check(furi_mutex_acquire(cache->mutex, FuriWaitForever) == FuriStatusOk);
+        meta_cache_load(cache);
+        MetaCacheDict_set_at(cache->entries, path, *entry);
+        cache->dirty = true;
+        furi_mutex_release(cache->mutex);
+    }
+
+    furi_thread_flags_set(furi_thread_get_id(cache->thread), MetaCacheEvtTouch);
+    return true;
+}
+
+static bool meta_cache_filter_cb(const char* name, FileInfo* fileinfo, void* ctx) {
+    UNUSED(ctx);
+    if(file_info_is_dir(fileinfo)) return false;
+
+    const size_t name_len = strlen(name);
+    const size_t ext_len = strlen(META_CACHE_APP_EXTENSION);
+    return (name_len > ext_len) &&
+           (strcasecmp(name + name_len - ext_len, META_CACHE_APP_EXTENSION) == 0);
+}
+
+static void meta_cache_scan(FlipperApplicationMetaCache* cache) {
+    if(storage_sd_status(cache->storage) != FSE_OK) {
+        FURI_LOG_D(TAG, "SD card not ready, scan skipped");
+        return;
+    }
+
+    const uint32_t start = furi_get_tick();
+    const char* apps_path = furi_string_get_cstr(cache->apps_path);
+
+    furi_check(furi_mutex_acquire(cache->mutex, FuriWaitForever) == FuriStatusOk);
+    meta_cache_load(cache);
+    MetaCacheDict_it_t it;
+    for(MetaCacheDict_it(it, cache->entries); !MetaCacheDict_end_p(it); MetaCacheDict_next(it)) {
+        MetaCacheDict_ref(it)->value.seen = false;
+    }
+    furi_mutex_release(cache->mutex);
+
+    bool completed = true;
+    size_t count = 0;
+    FuriString* path = furi_string_alloc();
+    DirWalk* dir_walk = dir_walk_alloc(cache->storage);
+    dir_walk_set_filter_cb(dir_walk, meta_cache_filter_cb, NULL);
+
+    if(dir_walk_open(dir_walk, apps_path)) {
+        // One file at a time, lookups from the UI get the mutex between files
+        MetaCacheEntry entry;
+        DirWalkResult result;
+        while((result = dir_walk_read(dir_walk, path, NULL)) == DirWalkOK) {
+            if(furi_thread_flags_get() & (MetaCacheEvtStop | MetaCacheEvtCardUnmount)) {
+                completed = false;
+                break;
+            }
+            meta_cache_lookup(cache, path, &entry);
+            count++;
+        }
+        if(result == DirWalkError) {
+            completed = false;
+        }
+    } else {
+        completed = false;
+    }
+
+    dir_walk_free(dir_walk);
+    furi_string_free(path);
+
+    if(!completed) {
+        FURI_LOG_W(TAG, "Scan interrupted");
+        return;
+    }
+
+    // Drop entries of applications that are gone
+    MetaCachePathArray_t removed;
+    MetaCachePathArray_init(removed);
+
+    furi_check(furi_mutex_acquire(cache->mutex, FuriWaitForever) == FuriStatusOk);
+    for(MetaCacheDict_it(it, cache->entries); !MetaCacheDict_end_p(it); MetaCacheDict_next(it)) {
+        const MetaCacheDict_itref_t* itref = MetaCacheDict_cref(it);
+        if(!itref->value.seen && furi_string_start_with_str(itref->key, apps_path)) {
+            MetaCachePathArray_push_back(removed, itref->key);
+        }
+    }
+    MetaCachePathArray_it_t removed_it;
+    for(MetaCachePathArray_it(removed_it, removed); !MetaCachePathArray_end_p(removed_it);
+        MetaCachePathArray_next(removed_it)) {
+        MetaCacheDict_erase(cache->entries, *MetaCachePathArray_cref(removed_it));
+        cache->dirty = true;
+    }
+    meta_cache_save(cache);
+    furi_mutex_release(cache->mutex);
+
+    FURI_LOG_I(
+        TAG,
+        "Scanned %zu apps, %zu removed in %lu ms",
+        count,
+        MetaCachePathArray_size(removed),
+        furi_get_tick() - start);
+    MetaCachePathArray_clear(removed);
+}
+
+static void meta_cache_storage_callback(const void* message, void* context) {
+    const StorageEvent* event = message;
+    FlipperApplicationMetaCache* cache = context;
+
+    // Called from the storage thread, so the worker does the job
+    if(event->type == StorageEventTypeCardMount) {
+        furi_thread_flags_set(furi_thread_get_id(cache->thread), MetaCacheEvtCardMount);
+    } else if(event->type == StorageEventTypeCardUnmount) {
+        furi_thread_flags_set(furi_thread_get_id(cache->thread), MetaCacheEvtCardUnmount);
+    }
+}
+
+static int32_t meta_cache_worker(void* context) {
+    FlipperApplicationMetaCache* cache = context;
+
+    while(true) {
+        furi_check(furi_mutex_acquire(cache->mutex, FuriWaitForever) == FuriStatusOk);
+        const uint32_t timeout = cache->loaded ? META_CACHE_IDLE_TIMEOUT_MS : FuriWaitForever;
+        furi_mutex_release(cache->mutex);
+
+        uint32_t flags = furi_thread_flags_wait(META_CACHE_EVT_ALL, FuriFlagWaitAny, timeout);
+
+        if(flags == (unsigned)FuriFlagErrorTimeout) {
+            furi_check(furi_mutex_acquire(cache->mutex, FuriWaitForever) == FuriStatusOk);
+            meta_cache_save(cache);
+            meta_cache_unload(cache);
+            furi_mutex_release(cache->mutex);
+            continue;
+        }
+        furi_check((flags & FuriFlagError) == 0);
+
+        if(flags & MetaCacheEvtStop) {
+            break;
+        }
+
+        // Entries of the old card are useless and can't be saved anymore
+        if(flags & (MetaCacheEvtCardUnmount | MetaCacheEvtCardMount)) {
+            furi_check(furi_mutex_acquire(cache->mutex, FuriWaitForever) == FuriStatusOk);
+            meta_cache_unload(cache);
+            furi_mutex_release(cache->mutex);
+        }
+
+        if(flags & (MetaCacheEvtRefresh | MetaCacheEvtCardMount)) {
+            meta_cache_scan(cache);
+        }
+    }
+
+    furi_check(furi_mutex_acquire(cache->mutex, FuriWaitForever) == FuriStatusOk);
+    meta_cache_save(cache);
+    furi_mutex_release(cache->mutex);
+
+    return 0;
+}
+
+FlipperApplicationMetaCache* flipper_application_meta_cache_alloc(
+    Storage* storage,
+    const char* cache_path,
+    const char* apps_path) {
+    furi_check(storage);
+    furi_check(cache_path);
+    furi_check(apps_path);
+
+    FlipperApplicationMetaCache* cache = malloc(sizeof(FlipperApplicationMetaCache));
+    cache->storage = storage;
+    cache->cache_path = furi_string_alloc_set(cache_path);
+    cache->apps_path = furi_string_alloc_set(apps_path);
+    cache->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    MetaCacheDict_init(cache->entries);
+
+    cache->thread =
+        furi_thread_alloc_ex(TAG, META_CACHE_WORKER_STACK_SIZE, meta_cache_worker, cache);
+    furi_thread_set_priority(cache->thread, FuriThreadPriorityLow);
+    furi_thread_start(cache->thread);
+
+    cache->storage_subscription =
+        furi_pubsub_subscribe(storage_get_pubsub(storage), meta_cache_storage_callback, cache);
+
+    return cache;
+}
+
+void flipper_application_meta_cache_free(FlipperApplicationMetaCache* cache) {
+    furi_check(cache);
+
+    furi_pubsub_unsubscribe(storage_get_pubsub(cache->storage), cache->storage_subscription);
+
+    furi_thread_flags_set(furi_thread_get_id(cache->thread), MetaCacheEvtStop);
+    furi_thread_join(cache->thread);
+    furi_thread_free(cache->thread);
+
+    MetaCacheDict_clear(cache->entries);
+    furi_mutex_free(cache->mutex);
+    furi_string_free(cache->apps_path);
+    furi_string_free(cache->cache_path);
+    free(cache);
+}
+
+void flipper_application_meta_cache_refresh(FlipperApplicationMetaCache* cache) {
+    furi_check(cache);
+    furi_thread_flags_set(furi_thread_get_id(cache->thread), MetaCacheEvtRefresh);
+}
+
+bool flipper_application_meta_cache_load_name_and_icon(
+    FlipperApplicationMetaCache* cache,
+    FuriString* path,
+    uint8_t** icon_ptr,
+    FuriString* item_name) {
+    furi_check(cache);
+    furi_check(path);
+
+    MetaCacheEntry entry;
+    if(!meta_cache_lookup(cache, path, &entry) || !entry.has_manifest) {
+        return false;
+    }
+
+    if(flipper_application_manifest_validate(&entry.manifest, firmware_api_interface) !=
+       FlipperApplicationPreloadStatusSuccess) {
+        return false;
+    }
+
+    if(entry.manifest.has_icon) {
+        memcpy(*icon_ptr, entry.manifest.icon, FAP_MANIFEST_MAX_ICON_SIZE);
+    }
+    // Name is not terminated when it takes the whole field
+    const char* name_end = memchr(entry.manifest.name, '\0', FAP_MANIFEST_MAX_APP_NAME_LENGTH);
+    furi_string_set_strn(
+        item_name,
+        entry.manifest.name,
+        name_end ? (size_t)(name_end - entry.manifest.name) : FAP_MANIFEST_MAX_APP_NAME_LENGTH);
+
+    return true;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file application_meta_cache.h
+ * Persistent cache of application names and icons
+ *
+ * Keeps the manifest of every looked up .fap in a cache file, keyed by path,
+ * size and modification time. Entries are validated on lookup, the file is
+ * parsed again only when it was changed. A low priority worker scans the
+ * applications folder in the background and keeps the cache file up to date.
+ */
+#pragma once
+
+#include <furi.h>
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct FlipperApplicationMetaCache FlipperApplicationMetaCache;
+
+/**
+ * @brief Allocate cache and start its worker
+ * @param storage Storage instance
+ * @param cache_path Path to the cache file
+ * @param apps_path Folder to scan in the background
+ * @return Cache instance
+ */
+FlipperApplicationMetaCache* flipper_application_meta_cache_alloc(
+    Storage* storage,
+    const char* cache_path,
+    const char* apps_path);
+
+/**
+ * @brief Stop worker, save pending changes and free cache
+ * @param cache Cache instance
+ */
+void flipper_application_meta_cache_free(FlipperApplicationMetaCache* cache);
+
+/**
+ * @brief Request background scan of the applications folder
+ *
+ * New and changed files are parsed, entries of removed files are dropped.
+ * Does nothing if SD card is not mounted.
+ *
+ * @param cache Cache instance
+ */
+void flipper_application_meta_cache_refresh(FlipperApplicationMetaCache* cache);
+
+/**
+ * @brief Load name and icon of FAP file through the cache.
+ *
+ * Same contract as flipper_application_load_name_and_icon(), thread safe.
+ *
+ * @param cache Cache instance
+ * @param path Path to FAP file.
+ * @param icon_ptr Icon pointer.
+ * @param item_name Application name.
+ * @return true if icon and name were loaded successfully.
+ */
+bool flipper_application_meta_cache_load_name_and_icon(
+    FlipperApplicationMetaCache* cache,
+    FuriString* path,
+    uint8_t** icon_ptr,
+    FuriString* item_name);
+
+#ifdef __cplusplus
+}
+#endif
@@ -11,7 +11,8 @@
 #define ELF_NAME_BUFFER_LEN 32
 #define SECTION_OFFSET(e, n) ((e)->section_table + (n) * sizeof(Elf32_Shdr))
 #define IS_FLAGS_SET(v, m) (((v) & (m)) == (m))
-#define RESOLVER_THREAD_YIELD_STEP 30
+#define RELOCATION_BUFFER_SIZE 4096
+#define RELOCATION_ARENA_HEAP_RESERVE (8 * 1024)
 #define FAST_RELOCATION_VERSION 1
 
 // #define ELF_DEBUG_LOG 1
@@ -177,6 +178,50 @@ static ELFSection* elf_section_of(ELFFile* elf, int index) {
     return NULL;
 }
 
+static const char* elf_section_name_of(ELFFile* elf, int index) {
+    ELFSectionDict_it_t it;
+    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+        const ELFSectionDict_itref_t* itref = ELFSectionDict_cref(it);
+        if(itref->value.sec_idx == index) {
+            return itref->key;
+        }
+    }
+
+    return NULL;
+}
+
+static bool elf_get_symbol(ELFFile* elf, int n, Elf32_Sym* sym, FuriString* name) {
+    const ELFRelocationArena* arena = &elf->arena;
+
+    // Symbol tables didn't fit in memory, go to the file
+    if(!arena->symbols) {
+        return elf_read_symbol(elf, n, sym, name);
+    }
+
+    if((size_t)n >= elf->symbol_count) {
+        return false;
+    }
+
+    *sym = arena->symbols[n];
+    if(sym->st_name) {
+        if(sym->st_name >= arena->strings_size) {
+            return false;
+        }
+        furi_string_set(name, arena->strings + sym->st_name);
+        return true;
+    }
+
+    // Section symbol, loaded sections already know their names
+    const char* section_name = elf_section_name_of(elf, sym->st_shndx);
+    if(section_name) {
+        furi_string_set(name, section_name);
+        return true;
+    }
+
+    Elf32_Shdr shdr;
+    return elf_read_section(elf, sym->st_shndx, &shdr, name);
+}
+
 static Elf32_Addr elf_address_of(ELFFile* elf, Elf32_Sym* sym, const char* sName) {
     if(sym->st_shndx == SHN_UNDEF) {
         Elf32_Addr addr = 0;
@@ -353,72 +398,78 @@ static bool elf_relocate_symbol(ELFFile* elf, Elf32_Addr relAddr, int type, Elf3
 
 static bool elf_relocate(ELFFile* elf, ELFSection* s) {
     if(s->data) {
-        Elf32_Rel rel;
-        size_t relEntries = s->rel_count;
-        size_t relCount;
-        (void)storage_file_seek(elf->fd, s->rel_offset, true);
+        ELFRelocationArena* arena = &elf->arena;
+        furi_check(arena->relocations);
         FURI_LOG_D(TAG, " Offset   Info     Type             Name");
 
-        int relocate_result = true;
+        bool relocate_result = true;
+        bool read_result = true;
         FuriString* symbol_name;
         symbol_name = furi_string_alloc();
 
-        for(relCount = 0; relCount < relEntries; relCount++) {
-            if(relCount % RESOLVER_THREAD_YIELD_STEP == 0) {
-                FURI_LOG_D(TAG, "  reloc YIELD");
-                furi_delay_tick(1);
-            }
+        for(size_t rel_done = 0; read_result && rel_done < s->rel_count;) {
+            const size_t rel_chunk = MIN(s->rel_count - rel_done, arena->relocations_count);
+            const size_t rel_chunk_size = rel_chunk * sizeof(Elf32_Rel);
 
-            if(storage_file_read(elf->fd, &rel, sizeof(Elf32_Rel)) != sizeof(Elf32_Rel)) {
+            if(!storage_file_seek(elf->fd, s->rel_offset + rel_done * sizeof(Elf32_Rel), true) ||
+               storage_file_read(elf->fd, arena->relocations, rel_chunk_size) != rel_chunk_size) {
                 FURI_LOG_E(TAG, "  reloc read fail");
-                furi_string_free(symbol_name);
-                return false;
+                read_result = false;
+                break;
             }
 
-            Elf32_Addr symAddr;
-
-            int symEntry = ELF32_R_SYM(rel.r_info);
-            int relType = ELF32_R_TYPE(rel.r_info);
-            Elf32_Addr relAddr = ((Elf32_Addr)s->data) + rel.r_offset;
-
-            if(!address_cache_get(elf->relocation_cache, symEntry, &symAddr)) {
-                Elf32_Sym sym;
-                furi_string_reset(symbol_name);
-                if(!elf_read_symbol(elf, symEntry, &sym, symbol_name)) {
-                    FURI_LOG_E(TAG, "  symbol read fail");
-                    furi_string_free(symbol_name);
-                    return false;
+            for(size_t rel_idx = 0; rel_idx < rel_chunk; rel_idx++) {
+                const Elf32_Rel* rel = &arena->relocations[rel_idx];
+                Elf32_Addr symAddr;
+
+                int symEntry = ELF32_R_SYM(rel->r_info);
+                int relType = ELF32_R_TYPE(rel->r_info);
+                Elf32_Addr relAddr = ((Elf32_Addr)s->data) + rel->r_offset;
+
+                if(!address_cache_get(elf->relocation_cache, symEntry, &symAddr)) {
+                    Elf32_Sym sym;
+                    furi_string_reset(symbol_name);
+                    if(!elf_get_symbol(elf, symEntry, &sym, symbol_name)) {
+                        FURI_LOG_E(TAG, "  symbol read fail");
+                        read_result = false;
+                        break;
+                    }
+
+                    FURI_LOG_D(
+                        TAG,
+                        " %08X %08X %-16s %s",
+                        (unsigned int)rel->r_offset,
+                        (unsigned int)rel->r_info,
+                        elf_reloc_type_to_str(relType),
+                        furi_string_get_cstr(symbol_name));
+
+                    symAddr = elf_address_of(elf, &sym, furi_string_get_cstr(symbol_name));
+                    address_cache_put(elf->relocation_cache, symEntry, symAddr);
                 }
 
-                FURI_LOG_D(
-                    TAG,
-                    " %08X %08X %-16s %s",
-                    (unsigned int)rel.r_offset,
-                    (unsigned int)rel.r_info,
-                    elf_reloc_type_to_str(relType),
-                    furi_string_get_cstr(symbol_name));
-
-                symAddr = elf_address_of(elf, &sym, furi_string_get_cstr(symbol_name));
-                address_cache_put(elf->relocation_cache, symEntry, symAddr);
-            }
-
-            if(symAddr != ELF_INVALID_ADDRESS) {
-                FURI_LOG_D(
-                    TAG,
-                    "  symAddr=%08X relAddr=%08X",
-                    (unsigned int)symAddr,
-                    (unsigned int)relAddr);
-                if(!elf_relocate_symbol(elf, relAddr, relType, symAddr)) {
+                if(symAddr != ELF_INVALID_ADDRESS) {
+                    FURI_LOG_D(
+                        TAG,
+                        "  symAddr=%08X relAddr=%08X",
+                        (unsigned int)symAddr,
+                        (unsigned int)relAddr);
+                    if(!elf_relocate_symbol(elf, relAddr, relType, symAddr)) {
+                        relocate_result = false;
+                    }
+                } else {
+                    FURI_LOG_E(
+                        TAG, "  No symbol address of %s", furi_string_get_cstr(symbol_name));
                     relocate_result = false;
                 }
-            } else {
-                FURI_LOG_E(TAG, "  No symbol address of %s", furi_string_get_cstr(symbol_name));
-                relocate_result = false;
             }
+
+            rel_done += rel_chunk;
+            // Give the other threads of our priority a chance between chunks
+            furi_thread_yield();
         }
         furi_string_free(symbol_name);
 
-        return relocate_result;
+        return relocate_result && read_result;
     } else {
         FURI_LOG_D(TAG, "Section not loaded");
     }
@@ -590,6 +641,7 @@ static SectionType elf_preload_section(
     if(strcmp(name, ".strtab") == 0) {
         FURI_LOG_D(TAG, "Found .strtab section");
         elf->symbol_table_strings = section_header->sh_offset;
+        elf->symbol_table_strings_size = section_header->sh_size;
         return SectionTypeStrTab;
     }
 
@@ -621,7 +673,7 @@ static bool elf_file_find_string_by_hash(ELFFile* elf, uint32_t hash, FuriString
     Elf32_Sym sym;
     for(size_t i = 0; i < elf->symbol_count; i++) {
         furi_string_reset(symbol_name);
-        if(elf_read_symbol(elf, i, &sym, symbol_name)) {
+        if(elf_get_symbol(elf, i, &sym, symbol_name)) {
             if(elf_symbolname_hash(furi_string_get_cstr(symbol_name)) == hash) {
                 furi_string_set(out, symbol_name);
                 result = true;
@@ -733,6 +785,94 @@ static bool elf_relocate_section(ELFFile* elf, ELFSection* section) {
     return true;
 }
 
+static void elf_relocation_arena_load_tables(ELFFile* elf) {
+    ELFRelocationArena* arena = &elf->arena;
+    const size_t symbols_size = elf->symbol_count * sizeof(Elf32_Sym);
+    const size_t tables_size = symbols_size + elf->symbol_table_strings_size + 1;
+
+    if(memmgr_heap_get_max_free_block() < tables_size + RELOCATION_ARENA_HEAP_RESERVE) {
+        FURI_LOG_W(TAG, "No memory for symbol tables (%zu bytes), using file", tables_size);
+        return;
+    }
+
+    uint8_t* tables = malloc(tables_size);
+    if(!storage_file_seek(elf->fd, elf->symbol_table, true) ||
+       storage_file_read(elf->fd, tables, symbols_size) != symbols_size ||
+       !storage_file_seek(elf->fd, elf->symbol_table_strings, true) ||
+       storage_file_read(elf->fd, tables + symbols_size, elf->symbol_table_strings_size) !=
+           elf->symbol_table_strings_size) {
+        FURI_LOG_W(TAG, "Symbol tables read fail, using file");
+        free(tables);
+        return;
+    }
+    // Keep the last name terminated even if the table is damaged
+    tables[tables_size - 1] = '\0';
+
+    arena->tables = tables;
+    arena->symbols = (const Elf32_Sym*)tables;
+    arena->strings = (const char*)tables + symbols_size;
+    arena->strings_size = elf->symbol_table_strings_size;
+}
+
+static void elf_relocation_arena_resolve_imports(ELFFile* elf) {
+    const ELFRelocationArena* arena = &elf->arena;
+    size_t resolved = 0;
+
+    for(size_t i = 0; i < elf->symbol_count; i++) {
+        const Elf32_Sym* sym = &arena->symbols[i];
+        if(sym->st_shndx != SHN_UNDEF || !sym->st_name || sym->st_name >= arena->strings_size) {
+            continue;
+        }
+
+        uint32_t hash = elf_symbolname_hash(arena->strings + sym->st_name);
+        Elf32_Addr addr = elf_address_of_by_hash(elf, hash);
+        // Misses are left to the relocation pass, it knows how to report them
+        if(addr != ELF_INVALID_ADDRESS) {
+            address_cache_put(elf->relocation_cache, i, addr);
+            resolved++;
+        }
+    }
+
+    FURI_LOG_D(TAG, "Resolved %zu imports", resolved);
+}
+
+static void elf_relocation_arena_alloc(ELFFile* elf) {
+    ELFRelocationArena* arena = &elf->arena;
+    size_t rel_count_max = 0;
+
+    ELFSectionDict_it_t it;
+    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+        const ELFSectionDict_itref_t* itref = ELFSectionDict_cref(it);
+        if(!itref->value.fast_rel) {
+            rel_count_max = MAX(rel_count_max, itref->value.rel_count);
+        }
+    }
+
+    // Fast relocations don't need any of this
+    if(rel_count_max == 0) {
+        return;
+    }
+
+    arena->relocations_count = MIN(rel_count_max, RELOCATION_BUFFER_SIZE / sizeof(Elf32_Rel));
+    arena->relocations = malloc(arena->relocations_count * sizeof(Elf32_Rel));
+
+    elf_relocation_arena_load_tables(elf);
+    if(arena->symbols) {
+        elf_relocation_arena_resolve_imports(elf);
+    }
+}
+
+static void elf_relocation_arena_free(ELFFile* elf) {
+    ELFRelocationArena* arena = &elf->arena;
+    if(arena->relocations) {
+        free(arena->relocations);
+    }
+    if(arena->tables) {
+        free(arena->tables);
+    }
+    memset(arena, 0, sizeof(ELFRelocationArena));
+}
+
 static void elf_file_call_section_list(ELFSection* section, bool reverse_order) {
     if(section && section->size) {
         const uint32_t* start = section->data;
@@ -904,6 +1044,7 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
     ELFSectionDict_it_t it;
 
     AddressCache_init(elf->relocation_cache);
+    elf_relocation_arena_alloc(elf);
 
     for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
         ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
@@ -929,6 +1070,7 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
     FURI_LOG_D(TAG, "Relocation cache size: %u", AddressCache_size(elf->relocation_cache));
     FURI_LOG_D(TAG, "Trampoline cache size: %u", AddressCache_size(elf->trampoline_cache));
     AddressCache_clear(elf->relocation_cache);
+    elf_relocation_arena_free(elf);
 
     {
         size_t total_size = 0;
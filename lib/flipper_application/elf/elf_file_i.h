@@ -28,6 +28,19 @@ struct ELFSection {
 
 DICT_DEF2(ELFSectionDict, const char*, M_CSTR_OPLIST, ELFSection, M_POD_OPLIST)
 
+/**
+ * Temporary buffers used while relocating, released before the app starts
+ */
+typedef struct {
+    Elf32_Rel* relocations;
+    size_t relocations_count;
+
+    void* tables;
+    const Elf32_Sym* symbols;
+    const char* strings;
+    size_t strings_size;
+} ELFRelocationArena;
+
 struct ELFFile {
     size_t sections_count;
     off_t section_table;
@@ -36,11 +49,13 @@ struct ELFFile {
     size_t symbol_count;
     off_t symbol_table;
     off_t symbol_table_strings;
+    size_t symbol_table_strings_size;
     off_t entry;
     ELFSectionDict_t sections;
 
     AddressCache_t relocation_cache;
     AddressCache_t trampoline_cache;
+    ELFRelocationArena arena;
 
     File* fd;
     const ElfApiInterface* api_interface;
@@ -91,23 +91,22 @@ void flipper_application_free(FlipperApplication* app) {
     free(app);
 }
 
-static FlipperApplicationPreloadStatus
-    flipper_application_validate_manifest(FlipperApplication* app) {
-    if(!flipper_application_manifest_is_valid(&app->manifest)) {
+FlipperApplicationPreloadStatus flipper_application_manifest_validate(
+    const FlipperApplicationManifest* manifest,
+    const ElfApiInterface* api_interface) {
+    if(!flipper_application_manifest_is_valid(manifest)) {
         return FlipperApplicationPreloadStatusInvalidManifest;
     }
 
-    if(!flipper_application_manifest_is_target_compatible(&app->manifest)) {
+    if(!flipper_application_manifest_is_target_compatible(manifest)) {
         return FlipperApplicationPreloadStatusTargetMismatch;
     }
 
-    if(!flipper_application_manifest_is_too_old(
-           &app->manifest, elf_file_get_api_interface(app->elf))) {
+    if(!flipper_application_manifest_is_too_old(manifest, api_interface)) {
         return FlipperApplicationPreloadStatusApiTooOld;
     }
 
-    if(!flipper_application_manifest_is_too_new(
-           &app->manifest, elf_file_get_api_interface(app->elf))) {
+    if(!flipper_application_manifest_is_too_new(manifest, api_interface)) {
         return FlipperApplicationPreloadStatusApiTooNew;
     }
 
@@ -178,7 +177,8 @@ static FlipperApplicationPreloadStatus
         return FlipperApplicationPreloadStatusInvalidFile;
     }
 
-    return flipper_application_validate_manifest(app);
+    return flipper_application_manifest_validate(
+        &app->manifest, elf_file_get_api_interface(app->elf));
 }
 
 /* Parse headers, load manifest */
@@ -99,6 +99,16 @@ FlipperApplicationPreloadStatus
  */
 const FlipperApplicationManifest* flipper_application_get_manifest(FlipperApplication* app);
 
+/**
+ * @brief Check application manifest against API interface and hardware target
+ * @param manifest Application manifest
+ * @param api_interface ELF API interface to check against
+ * @return Preload result code
+ */
+FlipperApplicationPreloadStatus flipper_application_manifest_validate(
+    const FlipperApplicationManifest* manifest,
+    const ElfApiInterface* api_interface);
+
 /**
  * @brief Load sections and process relocations for already pre-loaded application
  * @param app Application pointer
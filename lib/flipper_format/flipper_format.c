@@ -7,26 +7,90 @@
 #include "flipper_format_i.h"
 #include "flipper_format_stream.h"
 #include "flipper_format_stream_i.h"
+#include "flipper_format_key_index.h"
 
 /********************************** Private **********************************/
 struct FlipperFormat {
     Stream* stream;
     bool strict_mode;
+    FlipperFormatKeyIndex* key_index;
 };
 
 static const char* const flipper_format_filetype_key = "Filetype";
 static const char* const flipper_format_version_key = "Version";
 
+static inline void flipper_format_key_index_invalidate(FlipperFormat* flipper_format) {
+    if(flipper_format->key_index) {
+        flipper_format_key_index_reset(flipper_format->key_index);
+    }
+}
+
 Stream* flipper_format_get_raw_stream(FlipperFormat* flipper_format) {
+    // the caller may modify the stream behind our back
+    flipper_format_key_index_invalidate(flipper_format);
     return flipper_format->stream;
 }
 
+static bool flipper_format_key_index_ready(FlipperFormat* flipper_format) {
+    if(!flipper_format->key_index) return false;
+    if(flipper_format_key_index_is_valid(flipper_format->key_index)) return true;
+    return flipper_format_key_index_build(flipper_format->key_index, flipper_format->stream);
+}
+
+static bool flipper_format_seek_to_key(FlipperFormat* flipper_format, const char* key) {
+    if(!flipper_format_key_index_ready(flipper_format)) {
+        return flipper_format_stream_seek_to_key(
+            flipper_format->stream, key, flipper_format->strict_mode);
+    }
+
+    FlipperFormatKeyIndexEntry entry;
+    if(!flipper_format_key_index_find(
+           flipper_format->key_index,
+           key,
+           stream_tell(flipper_format->stream),
+           flipper_format->strict_mode,
+           &entry)) {
+        // mimic the scanning behavior: a missing key leaves the stream at the end
+        if(!flipper_format->strict_mode) {
+            stream_seek(flipper_format->stream, 0, StreamOffsetFromEnd);
+        }
+        return false;
+    }
+
+    return stream_seek(flipper_format->stream, entry.value_offset, StreamOffsetFromStart);
+}
+
+static bool flipper_format_read_value_line(
+    FlipperFormat* flipper_format,
+    const char* key,
+    FlipperStreamValue type,
+    void* data,
+    size_t data_size) {
+    if(!flipper_format_seek_to_key(flipper_format, key)) return false;
+    return flipper_format_stream_read_current_value(flipper_format->stream, type, data, data_size);
+}
+
+static bool
+    flipper_format_write_value_line(FlipperFormat* flipper_format, FlipperStreamWriteData* data) {
+    flipper_format_key_index_invalidate(flipper_format);
+    return flipper_format_stream_write_value_line(flipper_format->stream, data);
+}
+
+static bool flipper_format_delete_key_and_write(
+    FlipperFormat* flipper_format,
+    FlipperStreamWriteData* data) {
+    flipper_format_key_index_invalidate(flipper_format);
+    return flipper_format_stream_delete_key_and_write(
+        flipper_format->stream, data, flipper_format->strict_mode);
+}
+
 /********************************** Public **********************************/
 
 FlipperFormat* flipper_format_string_alloc() {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
     flipper_format->stream = string_stream_alloc();
     flipper_format->strict_mode = false;
+    flipper_format->key_index = NULL;
     return flipper_format;
 }
 
@@ -34,6 +98,7 @@ FlipperFormat* flipper_format_file_alloc(Storage* storage) {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
     flipper_format->stream = file_stream_alloc(storage);
     flipper_format->strict_mode = false;
+    flipper_format->key_index = NULL;
     return flipper_format;
 }
 
@@ -41,22 +106,26 @@ FlipperFormat* flipper_format_buffered_file_alloc(Storage* storage) {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
     flipper_format->stream = buffered_file_stream_alloc(storage);
     flipper_format->strict_mode = false;
+    flipper_format->key_index = NULL;
     return flipper_format;
 }
 
 bool flipper_format_file_open_existing(FlipperFormat* flipper_format, const char* path) {
     furi_assert(flipper_format);
+    flipper_format_key_index_invalidate(flipper_format);
     return file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING);
 }
 
 bool flipper_format_buffered_file_open_existing(FlipperFormat* flipper_format, const char* path) {
     furi_assert(flipper_format);
+    flipper_format_key_index_invalidate(flipper_format);
     return buffered_file_stream_open(
         flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING);
 }
 
 bool flipper_format_file_open_append(FlipperFormat* flipper_format, const char* path) {
     furi_assert(flipper_format);
+    flipper_format_key_index_invalidate(flipper_format);
 
     bool result =
         file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_APPEND);
@@ -88,33 +157,41 @@ bool flipper_format_file_open_append(FlipperFormat* flipper_format, const char*
 
 bool flipper_format_file_open_always(FlipperFormat* flipper_format, const char* path) {
     furi_assert(flipper_format);
+    flipper_format_key_index_invalidate(flipper_format);
     return file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS);
 }
 
 bool flipper_format_buffered_file_open_always(FlipperFormat* flipper_format, const char* path) {
     furi_assert(flipper_format);
+    flipper_format_key_index_invalidate(flipper_format);
     return buffered_file_stream_open(
         flipper_format->stream, path, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS);
 }
 
 bool flipper_format_file_open_new(FlipperFormat* flipper_format, const char* path) {
     furi_assert(flipper_format);
+    flipper_format_key_index_invalidate(flipper_format);
     return file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_CREATE_NEW);
 }
 
 bool flipper_format_file_close(FlipperFormat* flipper_format) {
     furi_assert(flipper_format);
+    flipper_format_key_index_invalidate(flipper_format);
     return file_stream_close(flipper_format->stream);
 }
 
 bool flipper_format_buffered_file_close(FlipperFormat* flipper_format) {
     furi_assert(flipper_format);
+    flipper_format_key_index_invalidate(flipper_format);
     return buffered_file_stream_close(flipper_format->stream);
 }
 
 void flipper_format_free(FlipperFormat* flipper_format) {
     furi_assert(flipper_format);
     stream_free(flipper_format->stream);
+    if(flipper_format->key_index) {
+        flipper_format_key_index_free(flipper_format->key_index);
+    }
     free(flipper_format);
 }
 
@@ -122,6 +199,16 @@ void flipper_format_set_strict_mode(FlipperFormat* flipper_format, bool strict_m
     flipper_format->strict_mode = strict_mode;
 }
 
+void flipper_format_set_key_index(FlipperFormat* flipper_format, bool enable) {
+    furi_assert(flipper_format);
+    if(enable && !flipper_format->key_index) {
+        flipper_format->key_index = flipper_format_key_index_alloc();
+    } else if(!enable && flipper_format->key_index) {
+        flipper_format_key_index_free(flipper_format->key_index);
+        flipper_format->key_index = NULL;
+    }
+}
+
 bool flipper_format_rewind(FlipperFormat* flipper_format) {
     furi_assert(flipper_format);
     return stream_rewind(flipper_format->stream);
@@ -132,7 +219,35 @@ bool flipper_format_seek_to_end(FlipperFormat* flipper_format) {
     return stream_seek(flipper_format->stream, 0, StreamOffsetFromEnd);
 }
 
+bool flipper_format_seek_to_nth_key(FlipperFormat* flipper_format, const char* key, size_t nth) {
+    furi_assert(flipper_format);
+
+    if(flipper_format_key_index_ready(flipper_format)) {
+        FlipperFormatKeyIndexEntry entry;
+        if(!flipper_format_key_index_find_nth(flipper_format->key_index, key, nth, &entry)) {
+            return false;
+        }
+        return stream_seek(flipper_format->stream, entry.line_offset, StreamOffsetFromStart);
+    }
+
+    if(!stream_rewind(flipper_format->stream)) return false;
+    for(size_t i = 0; i <= nth; i++) {
+        if(!flipper_format_stream_seek_to_key(flipper_format->stream, key, false)) return false;
+    }
+
+    // step back over the key, its delimiter and the space
+    size_t key_size = strlen(key) + 2;
+    size_t position = stream_tell(flipper_format->stream);
+    if(position < key_size) return false;
+    return stream_seek(flipper_format->stream, position - key_size, StreamOffsetFromStart);
+}
+
 bool flipper_format_key_exist(FlipperFormat* flipper_format, const char* key) {
+    if(flipper_format_key_index_ready(flipper_format)) {
+        FlipperFormatKeyIndexEntry entry;
+        return flipper_format_key_index_find(flipper_format->key_index, key, 0, false, &entry);
+    }
+
     size_t pos = stream_tell(flipper_format->stream);
     stream_seek(flipper_format->stream, 0, StreamOffsetFromStart);
     bool result = flipper_format_stream_seek_to_key(flipper_format->stream, key, false);
@@ -174,14 +289,25 @@ bool flipper_format_get_value_count(
     const char* key,
     uint32_t* count) {
     furi_assert(flipper_format);
-    return flipper_format_stream_get_value_count(
-        flipper_format->stream, key, count, flipper_format->strict_mode);
+
+    if(!flipper_format_key_index_ready(flipper_format)) {
+        return flipper_format_stream_get_value_count(
+            flipper_format->stream, key, count, flipper_format->strict_mode);
+    }
+
+    size_t position = stream_tell(flipper_format->stream);
+    bool result = flipper_format_seek_to_key(flipper_format, key) &&
+                  flipper_format_stream_count_current_values(flipper_format->stream, count);
+    if(!stream_seek(flipper_format->stream, position, StreamOffsetFromStart)) {
+        result = false;
+    }
+
+    return result;
 }
 
 bool flipper_format_read_string(FlipperFormat* flipper_format, const char* key, FuriString* data) {
     furi_assert(flipper_format);
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream, key, FlipperStreamValueStr, data, 1, flipper_format->strict_mode);
+    return flipper_format_read_value_line(flipper_format, key, FlipperStreamValueStr, data, 1);
 }
 
 bool flipper_format_write_string(FlipperFormat* flipper_format, const char* key, FuriString* data) {
@@ -192,7 +318,7 @@ bool flipper_format_write_string(FlipperFormat* flipper_format, const char* key,
         .data = furi_string_get_cstr(data),
         .data_size = 1,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -207,7 +333,7 @@ bool flipper_format_write_string_cstr(
         .data = data,
         .data_size = 1,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -217,13 +343,8 @@ bool flipper_format_read_hex_uint64(
     uint64_t* data,
     const uint16_t data_size) {
     furi_assert(flipper_format);
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueHexUint64,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueHexUint64, data, data_size);
 }
 
 bool flipper_format_write_hex_uint64(
@@ -238,7 +359,7 @@ bool flipper_format_write_hex_uint64(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -248,13 +369,8 @@ bool flipper_format_read_uint32(
     uint32_t* data,
     const uint16_t data_size) {
     furi_assert(flipper_format);
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueUint32,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueUint32, data, data_size);
 }
 
 bool flipper_format_write_uint32(
@@ -269,7 +385,7 @@ bool flipper_format_write_uint32(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -278,13 +394,8 @@ bool flipper_format_read_int32(
     const char* key,
     int32_t* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueInt32,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueInt32, data, data_size);
 }
 
 bool flipper_format_write_int32(
@@ -299,7 +410,7 @@ bool flipper_format_write_int32(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -308,13 +419,8 @@ bool flipper_format_read_bool(
     const char* key,
     bool* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueBool,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueBool, data, data_size);
 }
 
 bool flipper_format_write_bool(
@@ -329,7 +435,7 @@ bool flipper_format_write_bool(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -338,13 +444,8 @@ bool flipper_format_read_float(
     const char* key,
     float* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueFloat,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueFloat, data, data_size);
 }
 
 bool flipper_format_write_float(
@@ -359,7 +460,7 @@ bool flipper_format_write_float(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -368,13 +469,8 @@ bool flipper_format_read_hex(
     const char* key,
     uint8_t* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
-        key,
-        FlipperStreamValueHex,
-        data,
-        data_size,
-        flipper_format->strict_mode);
+    return flipper_format_read_value_line(
+        flipper_format, key, FlipperStreamValueHex, data, data_size);
 }
 
 bool flipper_format_write_hex(
@@ -389,7 +485,7 @@ bool flipper_format_write_hex(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -400,6 +496,7 @@ bool flipper_format_write_comment(FlipperFormat* flipper_format, FuriString* dat
 
 bool flipper_format_write_comment_cstr(FlipperFormat* flipper_format, const char* data) {
     furi_assert(flipper_format);
+    flipper_format_key_index_invalidate(flipper_format);
     return flipper_format_stream_write_comment_cstr(flipper_format->stream, data);
 }
 
@@ -411,8 +508,7 @@ bool flipper_format_delete_key(FlipperFormat* flipper_format, const char* key) {
         .data = NULL,
         .data_size = 0,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -424,8 +520,7 @@ bool flipper_format_update_string(FlipperFormat* flipper_format, const char* key
         .data = furi_string_get_cstr(data),
         .data_size = 1,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -440,8 +535,7 @@ bool flipper_format_update_string_cstr(
         .data = data,
         .data_size = 1,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -457,8 +551,7 @@ bool flipper_format_update_uint32(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -473,8 +566,7 @@ bool flipper_format_update_int32(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -489,8 +581,7 @@ bool flipper_format_update_bool(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -505,8 +596,7 @@ bool flipper_format_update_float(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -521,8 +611,7 @@ bool flipper_format_update_hex(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -203,6 +203,17 @@ void flipper_format_free(FlipperFormat* flipper_format);
  */
 void flipper_format_set_strict_mode(FlipperFormat* flipper_format, bool strict_mode);
 
+/**
+ * Enable or disable the key index.
+ * With the index enabled, the first keyed read scans the file once and remembers the offset
+ * of every key, so subsequent reads seek directly instead of rescanning the file.
+ * Any write drops the index and it is rebuilt on the next read.
+ * Useful for read-mostly files that are read out of order. Disabled by default.
+ * @param flipper_format Pointer to a FlipperFormat instance
+ * @param enable True to enable the key index
+ */
+void flipper_format_set_key_index(FlipperFormat* flipper_format, bool enable);
+
 /**
  * Rewind the RW pointer.
  * @param flipper_format Pointer to a FlipperFormat instance
@@ -226,6 +237,16 @@ bool flipper_format_seek_to_end(FlipperFormat* flipper_format);
  */
 bool flipper_format_key_exist(FlipperFormat* flipper_format, const char* key);
 
+/**
+ * Move the RW pointer to the beginning of the line holding the n-th occurrence of the key.
+ * The next read of that key returns its value.
+ * @param flipper_format Pointer to a FlipperFormat instance
+ * @param key Key
+ * @param nth Occurrence number, starting from 0
+ * @return True on success
+ */
+bool flipper_format_seek_to_nth_key(FlipperFormat* flipper_format, const char* key, size_t nth);
+
 /**
  * Read the header (file type and version).
  * @param flipper_format Pointer to a FlipperFormat instance
@@ -0,0 +1,184 @@
+#include <furi.h>
+#include <m-array.h>
+#include <m-dict.h>
+#include "flipper_format_key_index.h"
+#include "flipper_format_stream.h"
+#include "flipper_format_stream_i.h"
+
+ARRAY_DEF(FlipperFormatKeyIndexEntryArray, FlipperFormatKeyIndexEntry, M_POD_OPLIST)
+
+DICT_DEF2(
+    FlipperFormatKeyIndexDict,
+    FuriString*,
+    FURI_STRING_OPLIST,
+    FlipperFormatKeyIndexEntryArray_t,
+    ARRAY_OPLIST(FlipperFormatKeyIndexEntryArray, M_POD_OPLIST))
+
+ARRAY_DEF(FlipperFormatKeyIndexLineArray, uint32_t, M_POD_OPLIST)
+
+struct FlipperFormatKeyIndex {
+    // key -> occurrences, in file order
+    FlipperFormatKeyIndexDict_t keys;
+    // line offsets of all keys, in file order
+    FlipperFormatKeyIndexLineArray_t lines;
+    FuriString* lookup_key;
+    bool valid;
+};
+
+FlipperFormatKeyIndex* flipper_format_key_index_alloc() {
+    FlipperFormatKeyIndex* index = malloc(sizeof(FlipperFormatKeyIndex));
+    FlipperFormatKeyIndexDict_init(index->keys);
+    FlipperFormatKeyIndexLineArray_init(index->lines);
+    index->lookup_key = furi_string_alloc();
+    index->valid = false;
+    return index;
+}
+
+void flipper_format_key_index_free(FlipperFormatKeyIndex* index) {
+    furi_assert(index);
+    FlipperFormatKeyIndexDict_clear(index->keys);
+    FlipperFormatKeyIndexLineArray_clear(index->lines);
+    furi_string_free(index->lookup_key);
+    free(index);
+}
+
+void flipper_format_key_index_reset(FlipperFormatKeyIndex* index) {
+    furi_assert(index);
+    FlipperFormatKeyIndexDict_reset(index->keys);
+    FlipperFormatKeyIndexLineArray_reset(index->lines);
+    index->valid = false;
+}
+
+bool flipper_format_key_index_is_valid(FlipperFormatKeyIndex* index) {
+    furi_assert(index);
+    return index->valid;
+}
+
+static void flipper_format_key_index_add(
+    const char* key,
+    size_t line_offset,
+    size_t value_offset,
+    void* context) {
+    FlipperFormatKeyIndex* index = context;
+
+    furi_string_set(index->lookup_key, key);
+    FlipperFormatKeyIndexEntryArray_t* entries =
+        FlipperFormatKeyIndexDict_safe_get(index->keys, index->lookup_key);
+
+    FlipperFormatKeyIndexEntry entry = {
+        .line_offset = line_offset,
+        .value_offset = value_offset,
+    };
+    FlipperFormatKeyIndexEntryArray_push_back(*entries, entry);
+    FlipperFormatKeyIndexLineArray_push_back(index->lines, line_offset);
+}
+
+bool flipper_format_key_index_build(FlipperFormatKeyIndex* index, Stream* stream) {
+    furi_assert(index);
+    furi_assert(stream);
+
+    flipper_format_key_index_reset(index);
+
+    size_t position = stream_tell(stream);
+    bool result = false;
+
+    do {
+        if(!stream_rewind(stream)) break;
+        if(!flipper_format_stream_scan_keys(stream, flipper_format_key_index_add, index)) break;
+        result = true;
+    } while(false);
+
+    if(!stream_seek(stream, position, StreamOffsetFromStart)) {
+        result = false;
+    }
+
+    if(result) {
+        index->valid = true;
+    } else {
+        flipper_format_key_index_reset(index);
+    }
+
+    return result;
+}
+
+static size_t flipper_format_key_index_lower_bound_entry(
+    const FlipperFormatKeyIndexEntryArray_t entries,
+    size_t position) {
+    size_t low = 0;
+    size_t high = FlipperFormatKeyIndexEntryArray_size(entries);
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+        if(FlipperFormatKeyIndexEntryArray_cget(entries, middle)->line_offset < position) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+static size_t flipper_format_key_index_lower_bound_line(
+    const FlipperFormatKeyIndexLineArray_t lines,
+    size_t position) {
+    size_t low = 0;
+    size_t high = FlipperFormatKeyIndexLineArray_size(lines);
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+        if(*FlipperFormatKeyIndexLineArray_cget(lines, middle) < position) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+bool flipper_format_key_index_find(
+    FlipperFormatKeyIndex* index,
+    const char* key,
+    size_t position,
+    bool strict_mode,
+    FlipperFormatKeyIndexEntry* entry) {
+    furi_assert(index);
+    furi_assert(index->valid);
+    furi_assert(key);
+    furi_assert(entry);
+
+    furi_string_set(index->lookup_key, key);
+    const FlipperFormatKeyIndexEntryArray_t* entries =
+        FlipperFormatKeyIndexDict_cget(index->keys, index->lookup_key);
+    if(!entries) return false;
+
+    size_t found = flipper_format_key_index_lower_bound_entry(*entries, position);
+    if(found >= FlipperFormatKeyIndexEntryArray_size(*entries)) return false;
+    *entry = *FlipperFormatKeyIndexEntryArray_cget(*entries, found);
+
+    if(strict_mode) {
+        // any other key in between means the key is not the next one
+        size_t next = flipper_format_key_index_lower_bound_line(index->lines, position);
+        if(*FlipperFormatKeyIndexLineArray_cget(index->lines, next) != entry->line_offset) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool flipper_format_key_index_find_nth(
+    FlipperFormatKeyIndex* index,
+    const char* key,
+    size_t nth,
+    FlipperFormatKeyIndexEntry* entry) {
+    furi_assert(index);
+    furi_assert(index->valid);
+    furi_assert(key);
+    furi_assert(entry);
+
+    furi_string_set(index->lookup_key, key);
+    const FlipperFormatKeyIndexEntryArray_t* entries =
+        FlipperFormatKeyIndexDict_cget(index->keys, index->lookup_key);
+    if(!entries || nth >= FlipperFormatKeyIndexEntryArray_size(*entries)) return false;
+
+    *entry = *FlipperFormatKeyIndexEntryArray_cget(*entries, nth);
+    return true;
+}
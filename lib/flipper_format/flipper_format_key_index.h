@@ -0,0 +1,85 @@
+#pragma once
+#include <toolbox/stream/stream.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct FlipperFormatKeyIndex FlipperFormatKeyIndex;
+
+typedef struct {
+    uint32_t line_offset;
+    uint32_t value_offset;
+} FlipperFormatKeyIndexEntry;
+
+/**
+ * Allocate key index. Index is empty and invalid until built.
+ * @return FlipperFormatKeyIndex* 
+ */
+FlipperFormatKeyIndex* flipper_format_key_index_alloc();
+
+/**
+ * Free key index
+ * @param index 
+ */
+void flipper_format_key_index_free(FlipperFormatKeyIndex* index);
+
+/**
+ * Drop all entries and mark index as invalid
+ * @param index 
+ */
+void flipper_format_key_index_reset(FlipperFormatKeyIndex* index);
+
+/**
+ * Check if index matches the stream it was built from
+ * @param index 
+ * @return true 
+ * @return false 
+ */
+bool flipper_format_key_index_is_valid(FlipperFormatKeyIndex* index);
+
+/**
+ * Scan the whole stream and record every key. Stream position is preserved.
+ * @param index 
+ * @param stream 
+ * @return true 
+ * @return false 
+ */
+bool flipper_format_key_index_build(FlipperFormatKeyIndex* index, Stream* stream);
+
+/**
+ * Find the first occurrence of the key whose line starts at or after the position.
+ * In strict mode the key must also be the first key after the position.
+ * @param index 
+ * @param key 
+ * @param position 
+ * @param strict_mode 
+ * @param entry 
+ * @return true 
+ * @return false 
+ */
+bool flipper_format_key_index_find(
+    FlipperFormatKeyIndex* index,
+    const char* key,
+    size_t position,
+    bool strict_mode,
+    FlipperFormatKeyIndexEntry* entry);
+
+/**
+ * Find the n-th occurrence of the key, counting from zero
+ * @param index 
+ * @param key 
+ * @param nth 
+ * @param entry 
+ * @return true 
+ * @return false 
+ */
+bool flipper_format_key_index_find_nth(
+    FlipperFormatKeyIndex* index,
+    const char* key,
+    size_t nth,
+    FlipperFormatKeyIndexEntry* entry);
+
+#ifdef __cplusplus
+}
+#endif
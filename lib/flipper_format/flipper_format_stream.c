@@ -1,12 +1,8 @@
 #include <inttypes.h>
-#include <toolbox/hex.h>
 #include <core/check.h>
 #include "flipper_format_stream.h"
 #include "flipper_format_stream_i.h"
-
-static inline bool flipper_format_stream_is_space(char c) {
-    return c == ' ' || c == '\t' || c == flipper_format_eolr;
-}
+#include "flipper_format_tokenizer.h"
 
 static bool flipper_format_stream_write(Stream* stream, const void* data, size_t data_size) {
     size_t bytes_written = stream_write(stream, data, data_size);
@@ -30,237 +26,16 @@ bool flipper_format_stream_write_eol(Stream* stream) {
     return flipper_format_stream_write(stream, &flipper_format_eoln, 1);
 }
 
-static bool flipper_format_stream_read_valid_key(Stream* stream, FuriString* key) {
-    furi_string_reset(key);
-    const size_t buffer_size = 32;
-    uint8_t buffer[buffer_size];
-
-    bool found = false;
-    bool error = false;
-    bool accumulate = true;
-    bool new_line = true;
-
-    while(true) {
-        size_t was_read = stream_read(stream, buffer, buffer_size);
-        if(was_read == 0) break;
-
-        for(size_t i = 0; i < was_read; i++) {
-            uint8_t data = buffer[i];
-            if(data == flipper_format_eoln) {
-                // EOL found, clean data, start accumulating data and set the new_line flag
-                furi_string_reset(key);
-                accumulate = true;
-                new_line = true;
-            } else if(data == flipper_format_eolr) {
-                // ignore
-            } else if(data == flipper_format_comment && new_line) {
-                // if there is a comment character and we are at the beginning of a new line
-                // do not accumulate comment data and reset the new_line flag
-                accumulate = false;
-                new_line = false;
-            } else if(data == flipper_format_delimiter) {
-                if(new_line) {
-                    // we are on a "new line" and found the delimiter
-                    // this can only be if we have previously found some kind of key, so
-                    // clear the data, set the flag that we no longer want to accumulate data
-                    // and reset the new_line flag
-                    furi_string_reset(key);
-                    accumulate = false;
-                    new_line = false;
-                } else {
-                    // parse the delimiter only if we are accumulating data
-                    if(accumulate) {
-                        // we found the delimiter, move the rw pointer to the delimiter location
-                        // and signal that we have found something
-                        if(!stream_seek(stream, i - was_read, StreamOffsetFromCurrent)) {
-                            error = true;
-                            break;
-                        }
-
-                        found = true;
-                        break;
-                    }
-                }
-            } else {
-                // just new symbol, reset the new_line flag
-                new_line = false;
-                if(accumulate) {
-                    // and accumulate data if we want
-                    furi_string_push_back(key, data);
-                }
-            }
-        }
-
-        if(found || error) break;
-    }
-
-    return found;
-}
-
 bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool strict_mode) {
-    bool found = false;
-    FuriString* read_key;
-
-    read_key = furi_string_alloc();
+    FlipperFormatTokenizer tokenizer;
+    flipper_format_tokenizer_init(&tokenizer, stream);
 
-    while(!stream_eof(stream)) {
-        if(flipper_format_stream_read_valid_key(stream, read_key)) {
-            if(furi_string_cmp_str(read_key, key) == 0) {
-                if(!stream_seek(stream, 2, StreamOffsetFromCurrent)) break;
-
-                found = true;
-                break;
-            } else if(strict_mode) {
-                found = false;
-                break;
-            }
-        }
-    }
-    furi_string_free(read_key);
+    bool found = flipper_format_tokenizer_seek_to_key(&tokenizer, key, strict_mode);
+    if(!flipper_format_tokenizer_release(&tokenizer)) found = false;
 
     return found;
 }
 
-static bool flipper_format_stream_read_value(Stream* stream, FuriString* value, bool* last) {
-    enum { LeadingSpace, ReadValue, TrailingSpace } state = LeadingSpace;
-    const size_t buffer_size = 32;
-    uint8_t buffer[buffer_size];
-    bool result = false;
-    bool error = false;
-
-    furi_string_reset(value);
-
-    while(true) {
-        size_t was_read = stream_read(stream, buffer, buffer_size);
-
-        if(was_read == 0) {
-            if(state != LeadingSpace && stream_eof(stream)) {
-                result = true;
-                *last = true;
-            } else {
-                error = true;
-            }
-        }
-
-        for(uint16_t i = 0; i < was_read; i++) {
-            const uint8_t data = buffer[i];
-
-            if(state == LeadingSpace) {
-                if(flipper_format_stream_is_space(data)) {
-                    continue;
-                } else if(data == flipper_format_eoln) {
-                    stream_seek(stream, i - was_read, StreamOffsetFromCurrent);
-                    error = true;
-                    break;
-                } else {
-                    state = ReadValue;
-                    furi_string_push_back(value, data);
-                }
-            } else if(state == ReadValue) {
-                if(flipper_format_stream_is_space(data)) {
-                    state = TrailingSpace;
-                } else if(data == flipper_format_eoln) {
-                    if(!stream_seek(stream, i - was_read, StreamOffsetFromCurrent)) {
-                        error = true;
-                    } else {
-                        result = true;
-                        *last = true;
-                    }
-                    break;
-                } else {
-                    furi_string_push_back(value, data);
-                }
-            } else if(state == TrailingSpace) {
-                if(flipper_format_stream_is_space(data)) {
-                    continue;
-                } else if(!stream_seek(stream, i - was_read, StreamOffsetFromCurrent)) {
-                    error = true;
-                } else {
-                    *last = (data == flipper_format_eoln);
-                    result = true;
-                }
-                break;
-            }
-        }
-
-        if(error || result) break;
-    }
-
-    return result;
-}
-
-static bool flipper_format_stream_read_line(Stream* stream, FuriString* str_result) {
-    furi_string_reset(str_result);
-    const size_t buffer_size = 32;
-    uint8_t buffer[buffer_size];
-
-    do {
-        size_t was_read = stream_read(stream, buffer, buffer_size);
-        if(was_read == 0) break;
-
-        bool result = false;
-        bool error = false;
-
-        for(size_t i = 0; i < was_read; i++) {
-            uint8_t data = buffer[i];
-            if(data == flipper_format_eoln) {
-                if(!stream_seek(stream, i - was_read, StreamOffsetFromCurrent)) {
-                    error = true;
-                    break;
-                }
-
-                result = true;
-                break;
-            } else if(data == flipper_format_eolr) {
-                // Ignore
-            } else {
-                furi_string_push_back(str_result, data);
-            }
-        }
-
-        if(result || error) {
-            break;
-        }
-    } while(true);
-
-    return furi_string_size(str_result) != 0;
-}
-
-static bool flipper_format_stream_seek_to_next_line(Stream* stream) {
-    const size_t buffer_size = 32;
-    uint8_t buffer[buffer_size];
-    bool result = false;
-    bool error = false;
-
-    do {
-        size_t was_read = stream_read(stream, buffer, buffer_size);
-        if(was_read == 0) {
-            if(stream_eof(stream)) {
-                result = true;
-                break;
-            }
-        }
-
-        for(size_t i = 0; i < was_read; i++) {
-            if(buffer[i] == flipper_format_eoln) {
-                if(!stream_seek(stream, i - was_read, StreamOffsetFromCurrent)) {
-                    error = true;
-                    break;
-                }
-
-                result = true;
-                break;
-            }
-        }
-
-        if(result || error) {
-            break;
-        }
-    } while(true);
-
-    return result;
-}
-
 bool flipper_format_stream_write_value_line(Stream* stream, FlipperStreamWriteData* write_data) {
     bool result = false;
 
@@ -335,6 +110,35 @@ bool flipper_format_stream_write_value_line(Stream* stream, FlipperStreamWriteDa
     return result;
 }
 
+bool flipper_format_stream_scan_keys(
+    Stream* stream,
+    FlipperStreamScanKeyCallback callback,
+    void* context) {
+    FlipperFormatTokenizer tokenizer;
+    flipper_format_tokenizer_init(&tokenizer, stream);
+
+    const size_t start = stream_tell(stream);
+    FuriString* key = furi_string_alloc();
+    FlipperFormatSpan span;
+    size_t key_offset;
+
+    while(flipper_format_tokenizer_read_key(&tokenizer, &span, &key_offset)) {
+        // the value starts after the delimiter and a single space
+        const size_t value_offset = start + flipper_format_tokenizer_consumed(&tokenizer) + 2;
+        furi_string_printf(key, "%.*s", (int)span.size, span.data);
+        callback(furi_string_get_cstr(key), start + key_offset, value_offset, context);
+
+        // the rest of the line can not hold a key
+        if(!flipper_format_tokenizer_seek_to_eol(&tokenizer)) break;
+    }
+
+    bool result = !tokenizer.error;
+    if(!flipper_format_tokenizer_release(&tokenizer)) result = false;
+    furi_string_free(key);
+
+    return result;
+}
+
 bool flipper_format_stream_read_value_line(
     Stream* stream,
     const char* key,
@@ -342,97 +146,73 @@ bool flipper_format_stream_read_value_line(
     void* _data,
     size_t data_size,
     bool strict_mode) {
+    if(!flipper_format_stream_seek_to_key(stream, key, strict_mode)) return false;
+    return flipper_format_stream_read_current_value(stream, type, _data, data_size);
+}
+
+static bool flipper_format_stream_parse_value(
+    const FlipperFormatSpan* value,
+    FlipperStreamValue type,
+    void* _data,
+    size_t index) {
+    switch(type) {
+    case FlipperStreamValueHex:
+        return flipper_format_span_to_hex(value, &((uint8_t*)_data)[index]);
+#ifndef FLIPPER_STREAM_LITE
+    case FlipperStreamValueFloat:
+        return flipper_format_span_to_float(value, &((float*)_data)[index]);
+#endif
+    case FlipperStreamValueInt32:
+        return flipper_format_span_to_int32(value, &((int32_t*)_data)[index]);
+    case FlipperStreamValueUint32:
+        return flipper_format_span_to_uint32(value, &((uint32_t*)_data)[index]);
+    case FlipperStreamValueHexUint64:
+        return flipper_format_span_to_hex_uint64(value, &((uint64_t*)_data)[index]);
+    case FlipperStreamValueBool:
+        return flipper_format_span_to_bool(value, &((bool*)_data)[index]);
+    default:
+        furi_crash("Unknown FF type");
+    }
+}
+
+bool flipper_format_stream_read_current_value(
+    Stream* stream,
+    FlipperStreamValue type,
+    void* _data,
+    size_t data_size) {
+    FlipperFormatTokenizer tokenizer;
+    flipper_format_tokenizer_init(&tokenizer, stream);
+
+    FlipperFormatSpan value;
     bool result = false;
 
-    do {
-        if(!flipper_format_stream_seek_to_key(stream, key, strict_mode)) break;
+    if(type == FlipperStreamValueStr) {
+        FuriString* data = (FuriString*)_data;
+        result = flipper_format_tokenizer_read_line(&tokenizer, &value);
+        if(result) {
+            furi_string_printf(data, "%.*s", (int)value.size, value.data);
+        } else {
+            furi_string_reset(data);
+        }
+    } else {
+        result = true;
 
-        if(type == FlipperStreamValueStr) {
-            FuriString* data = (FuriString*)_data;
-            if(flipper_format_stream_read_line(stream, data)) {
-                result = true;
+        for(size_t i = 0; i < data_size; i++) {
+            bool last = false;
+            if(!flipper_format_tokenizer_read_value(&tokenizer, &value, &last) ||
+               !flipper_format_stream_parse_value(&value, type, _data, i)) {
+                result = false;
                 break;
             }
-        } else {
-            result = true;
-            FuriString* value;
-            value = furi_string_alloc();
-
-            for(size_t i = 0; i < data_size; i++) {
-                bool last = false;
-                result = flipper_format_stream_read_value(stream, value, &last);
-                if(result) {
-                    int scan_values = 0;
-
-                    switch(type) {
-                    case FlipperStreamValueHex: {
-                        uint8_t* data = _data;
-                        if(furi_string_size(value) >= 2) {
-                            // sscanf "%02X" does not work here
-                            if(hex_char_to_uint8(
-                                   furi_string_get_char(value, 0),
-                                   furi_string_get_char(value, 1),
-                                   &data[i])) {
-                                scan_values = 1;
-                            }
-                        }
-                    }; break;
-#ifndef FLIPPER_STREAM_LITE
-                    case FlipperStreamValueFloat: {
-                        float* data = _data;
-                        // newlib-nano does not have sscanf for floats
-                        // scan_values = sscanf(furi_string_get_cstr(value), "%f", &data[i]);
-                        char* end_char;
-                        data[i] = strtof(furi_string_get_cstr(value), &end_char);
-                        if(*end_char == 0) {
-                            // most likely ok
-                            scan_values = 1;
-                        }
-                    }; break;
-#endif
-                    case FlipperStreamValueInt32: {
-                        int32_t* data = _data;
-                        scan_values = sscanf(furi_string_get_cstr(value), "%" PRIi32, &data[i]);
-                    }; break;
-                    case FlipperStreamValueUint32: {
-                        uint32_t* data = _data;
-                        scan_values = sscanf(furi_string_get_cstr(value), "%" PRIu32, &data[i]);
-                    }; break;
-                    case FlipperStreamValueHexUint64: {
-                        uint64_t* data = _data;
-                        if(furi_string_size(value) >= 16) {
-                            if(hex_chars_to_uint64(furi_string_get_cstr(value), &data[i])) {
-                                scan_values = 1;
-                            }
-                        }
-                    }; break;
-                    case FlipperStreamValueBool: {
-                        bool* data = _data;
-                        data[i] = !furi_string_cmpi(value, "true");
-                        scan_values = 1;
-                    }; break;
-                    default:
-                        furi_crash("Unknown FF type");
-                    }
-
-                    if(scan_values != 1) {
-                        result = false;
-                        break;
-                    }
-                } else {
-                    break;
-                }
 
-                if(last && ((i + 1) != data_size)) {
-                    result = false;
-                    break;
-                }
+            if(last && ((i + 1) != data_size)) {
+                result = false;
+                break;
             }
-
-            furi_string_free(value);
         }
-    } while(false);
+    }
 
+    if(!flipper_format_tokenizer_release(&tokenizer)) result = false;
     return result;
 }
 
@@ -442,34 +222,39 @@ bool flipper_format_stream_get_value_count(
     uint32_t* count,
     bool strict_mode) {
     bool result = false;
-    bool last = false;
-
-    FuriString* value;
-    value = furi_string_alloc();
 
     uint32_t position = stream_tell(stream);
-    do {
-        if(!flipper_format_stream_seek_to_key(stream, key, strict_mode)) break;
-        *count = 0;
+    if(flipper_format_stream_seek_to_key(stream, key, strict_mode)) {
+        result = flipper_format_stream_count_current_values(stream, count);
+    }
 
-        result = true;
-        while(true) {
-            if(!flipper_format_stream_read_value(stream, value, &last)) {
-                result = false;
-                break;
-            }
+    if(!stream_seek(stream, position, StreamOffsetFromStart)) {
+        result = false;
+    }
 
-            *count = *count + 1;
-            if(last) break;
-        }
+    return result;
+}
 
-    } while(false);
+bool flipper_format_stream_count_current_values(Stream* stream, uint32_t* count) {
+    FlipperFormatTokenizer tokenizer;
+    flipper_format_tokenizer_init(&tokenizer, stream);
 
-    if(!stream_seek(stream, position, StreamOffsetFromStart)) {
-        result = false;
+    FlipperFormatSpan value;
+    bool result = true;
+    bool last = false;
+
+    *count = 0;
+    while(true) {
+        if(!flipper_format_tokenizer_read_value(&tokenizer, &value, &last)) {
+            result = false;
+            break;
+        }
+
+        *count = *count + 1;
+        if(last) break;
     }
 
-    furi_string_free(value);
+    if(!flipper_format_tokenizer_release(&tokenizer)) result = false;
     return result;
 }
 
@@ -498,7 +283,10 @@ bool flipper_format_stream_delete_key_and_write(
         }
 
         // get value end position
-        if(!flipper_format_stream_seek_to_next_line(stream)) break;
+        FlipperFormatTokenizer tokenizer;
+        flipper_format_tokenizer_init(&tokenizer, stream);
+        bool eol_found = flipper_format_tokenizer_seek_to_eol(&tokenizer);
+        if(!flipper_format_tokenizer_release(&tokenizer) || !eol_found) break;
         size_t end_position = stream_tell(stream);
         // newline symbol
         if(end_position < size) {
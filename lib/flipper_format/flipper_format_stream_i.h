@@ -29,6 +29,58 @@ bool flipper_format_stream_write_eol(Stream* stream);
  */
 bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool strict_mode);
 
+/**
+ * Reads the value at the current position of the stream, which must point at the beginning of the value.
+ * @param stream 
+ * @param type 
+ * @param _data 
+ * @param data_size 
+ * @return true 
+ * @return false 
+ */
+bool flipper_format_stream_read_current_value(
+    Stream* stream,
+    FlipperStreamValue type,
+    void* _data,
+    size_t data_size);
+
+/**
+ * Counts the values from the current position of the stream to the end of the line.
+ * The stream position is not restored.
+ * @param stream 
+ * @param count 
+ * @return true 
+ * @return false 
+ */
+bool flipper_format_stream_count_current_values(Stream* stream, uint32_t* count);
+
+/**
+ * Key scan callback
+ * @param key key name
+ * @param line_offset offset of the line that holds the key
+ * @param value_offset offset of the value, as flipper_format_stream_seek_to_key would leave it
+ * @param context 
+ */
+typedef void (*FlipperStreamScanKeyCallback)(
+    const char* key,
+    size_t line_offset,
+    size_t value_offset,
+    void* context);
+
+/**
+ * Reports every key from the current position of the stream to the end of the stream.
+ * Keys are recognized exactly as flipper_format_stream_seek_to_key recognizes them.
+ * @param stream 
+ * @param callback 
+ * @param context 
+ * @return true the whole stream was scanned
+ * @return false read error
+ */
+bool flipper_format_stream_scan_keys(
+    Stream* stream,
+    FlipperStreamScanKeyCallback callback,
+    void* context);
+
 #ifdef __cplusplus
 }
 #endif
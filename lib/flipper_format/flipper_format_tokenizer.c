@@ -0,0 +1,478 @@
+#include <string.h>
+#include <toolbox/hex.h>
+#include <core/check.h>
+#include <core/common_defines.h>
+#include "flipper_format_tokenizer.h"
+#include "flipper_format_stream_i.h"
+
+static inline bool flipper_format_tokenizer_is_space(char c) {
+    return c == ' ' || c == '\t' || c == flipper_format_eolr;
+}
+
+void flipper_format_tokenizer_init(FlipperFormatTokenizer* tokenizer, Stream* stream) {
+    furi_assert(tokenizer);
+    furi_assert(stream);
+    memset(tokenizer, 0, sizeof(FlipperFormatTokenizer));
+    tokenizer->stream = stream;
+}
+
+// Give the consumed part of the window to the stream and forget the window
+static bool flipper_format_tokenizer_commit(FlipperFormatTokenizer* tokenizer) {
+    bool success = true;
+
+    if(tokenizer->direct) {
+        if(tokenizer->position > 0) {
+            success = stream_seek(
+                tokenizer->stream, (int32_t)tokenizer->position, StreamOffsetFromCurrent);
+        }
+    } else if(tokenizer->position < tokenizer->window_size) {
+        success = stream_seek(
+            tokenizer->stream,
+            -(int32_t)(tokenizer->window_size - tokenizer->position),
+            StreamOffsetFromCurrent);
+    }
+
+    tokenizer->consumed += tokenizer->position;
+    tokenizer->window = NULL;
+    tokenizer->window_size = 0;
+    tokenizer->position = 0;
+    tokenizer->direct = false;
+
+    if(!success) tokenizer->error = true;
+    return success;
+}
+
+bool flipper_format_tokenizer_release(FlipperFormatTokenizer* tokenizer) {
+    furi_assert(tokenizer);
+    bool success = flipper_format_tokenizer_commit(tokenizer) && !tokenizer->error;
+
+    free(tokenizer->scratch);
+    tokenizer->scratch = NULL;
+    tokenizer->scratch_size = 0;
+    tokenizer->scratch_capacity = 0;
+
+    return success;
+}
+
+size_t flipper_format_tokenizer_consumed(FlipperFormatTokenizer* tokenizer) {
+    furi_assert(tokenizer);
+    return tokenizer->consumed + tokenizer->position;
+}
+
+static void flipper_format_tokenizer_token_begin(FlipperFormatTokenizer* tokenizer) {
+    tokenizer->token = tokenizer->window + tokenizer->position;
+    tokenizer->token_spilled = false;
+    tokenizer->scratch_size = 0;
+}
+
+// Move the pending part of the token, up to the current position, to the scratch buffer
+static void flipper_format_tokenizer_token_spill(FlipperFormatTokenizer* tokenizer) {
+    const uint8_t* end = tokenizer->window + tokenizer->position;
+    if(tokenizer->token && end > tokenizer->token) {
+        size_t size = end - tokenizer->token;
+        if(tokenizer->scratch_size + size > tokenizer->scratch_capacity) {
+            tokenizer->scratch_capacity = MAX(
+                tokenizer->scratch_size + size, tokenizer->scratch_capacity * 2 + 32);
+            tokenizer->scratch = realloc(tokenizer->scratch, tokenizer->scratch_capacity); //-V701
+        }
+        memcpy(tokenizer->scratch + tokenizer->scratch_size, tokenizer->token, size);
+        tokenizer->scratch_size += size;
+    }
+    tokenizer->token = NULL;
+    tokenizer->token_spilled = true;
+}
+
+// Continue the token from the current position
+static inline void flipper_format_tokenizer_token_resume(FlipperFormatTokenizer* tokenizer) {
+    tokenizer->token = tokenizer->window + tokenizer->position;
+}
+
+static void flipper_format_tokenizer_token_end(
+    FlipperFormatTokenizer* tokenizer,
+    FlipperFormatSpan* span) {
+    if(tokenizer->token_spilled) {
+        flipper_format_tokenizer_token_spill(tokenizer);
+        span->data = tokenizer->scratch;
+        span->size = tokenizer->scratch_size;
+    } else {
+        span->data = (const char*)tokenizer->token;
+        span->size = tokenizer->window + tokenizer->position - tokenizer->token;
+    }
+    tokenizer->token = NULL;
+}
+
+/**
+ * Make sure there is unconsumed data in the window
+ * @return false at the end of the stream or on error
+ */
+static bool flipper_format_tokenizer_ensure(FlipperFormatTokenizer* tokenizer, bool in_token) {
+    if(tokenizer->position < tokenizer->window_size) return true;
+    if(tokenizer->error) return false;
+
+    if(in_token) flipper_format_tokenizer_token_spill(tokenizer);
+    if(!flipper_format_tokenizer_commit(tokenizer)) return false;
+
+    if(stream_peek(tokenizer->stream, &tokenizer->window, &tokenizer->window_size)) {
+        tokenizer->direct = true;
+    } else {
+        tokenizer->window = tokenizer->buffer;
+        tokenizer->window_size = stream_read(
+            tokenizer->stream, tokenizer->buffer, FLIPPER_FORMAT_TOKENIZER_BUFFER_SIZE);
+        tokenizer->direct = false;
+    }
+
+    if(in_token) flipper_format_tokenizer_token_resume(tokenizer);
+    return tokenizer->window_size > 0;
+}
+
+static inline bool flipper_format_tokenizer_at_eof(FlipperFormatTokenizer* tokenizer) {
+    return !tokenizer->error && stream_eof(tokenizer->stream);
+}
+
+// Skip to the next EOL character without consuming it
+static bool flipper_format_tokenizer_skip_to_eol(FlipperFormatTokenizer* tokenizer) {
+    while(flipper_format_tokenizer_ensure(tokenizer, false)) {
+        const uint8_t* data = tokenizer->window + tokenizer->position;
+        const size_t size = tokenizer->window_size - tokenizer->position;
+        const uint8_t* eol = memchr(data, flipper_format_eoln, size);
+        if(eol) {
+            tokenizer->position += eol - data;
+            return true;
+        }
+        tokenizer->position += size;
+    }
+    return false;
+}
+
+bool flipper_format_tokenizer_read_key(
+    FlipperFormatTokenizer* tokenizer,
+    FlipperFormatSpan* key,
+    size_t* key_offset) {
+    furi_assert(tokenizer);
+    furi_assert(key);
+
+    bool accumulate = true;
+    bool new_line = true;
+
+    if(!flipper_format_tokenizer_ensure(tokenizer, false)) return false;
+    flipper_format_tokenizer_token_begin(tokenizer);
+    size_t offset = flipper_format_tokenizer_consumed(tokenizer);
+
+    while(flipper_format_tokenizer_ensure(tokenizer, accumulate)) {
+        if(!accumulate) {
+            // nothing interesting until the end of the line
+            if(!flipper_format_tokenizer_skip_to_eol(tokenizer)) break;
+        }
+
+        const uint8_t data = tokenizer->window[tokenizer->position];
+        if(data == flipper_format_eoln) {
+            tokenizer->position++;
+            accumulate = true;
+            new_line = true;
+            flipper_format_tokenizer_ensure(tokenizer, false);
+            flipper_format_tokenizer_token_begin(tokenizer);
+            offset = flipper_format_tokenizer_consumed(tokenizer);
+        } else if(data == flipper_format_eolr) {
+            // skipped, the key does not include it
+            flipper_format_tokenizer_token_spill(tokenizer);
+            tokenizer->position++;
+            flipper_format_tokenizer_token_resume(tokenizer);
+        } else if(data == flipper_format_comment && new_line) {
+            accumulate = false;
+            new_line = false;
+        } else if(data == flipper_format_delimiter) {
+            if(new_line) {
+                // delimiter without a key
+                accumulate = false;
+                new_line = false;
+            } else {
+                // stop at the delimiter
+                flipper_format_tokenizer_token_end(tokenizer, key);
+                if(key_offset) *key_offset = offset;
+                return true;
+            }
+        } else {
+            new_line = false;
+            tokenizer->position++;
+        }
+    }
+
+    tokenizer->token = NULL;
+    return false;
+}
+
+bool flipper_format_tokenizer_seek_to_key(
+    FlipperFormatTokenizer* tokenizer,
+    const char* key,
+    bool strict_mode) {
+    furi_assert(tokenizer);
+    furi_assert(key);
+
+    const size_t key_size = strlen(key);
+    FlipperFormatSpan read_key;
+
+    while(flipper_format_tokenizer_read_key(tokenizer, &read_key, NULL)) {
+        if(read_key.size == key_size && memcmp(read_key.data, key, key_size) == 0) {
+            // skip the delimiter and the space
+            for(size_t i = 0; i < 2; i++) {
+                if(!flipper_format_tokenizer_ensure(tokenizer, false)) return false;
+                tokenizer->position++;
+            }
+            return true;
+        } else if(strict_mode) {
+            break;
+        }
+        // skip the delimiter, the rest of the line is not a key
+        tokenizer->position++;
+        if(!flipper_format_tokenizer_skip_to_eol(tokenizer)) break;
+    }
+
+    return false;
+}
+
+// Copy the span to the scratch buffer, unless it is already there
+static void
+    flipper_format_tokenizer_keep(FlipperFormatTokenizer* tokenizer, FlipperFormatSpan* span) {
+    if(span->data == tokenizer->scratch) return;
+
+    if(span->size > tokenizer->scratch_capacity) {
+        tokenizer->scratch_capacity = span->size;
+        free(tokenizer->scratch);
+        tokenizer->scratch = malloc(tokenizer->scratch_capacity);
+    }
+    memcpy(tokenizer->scratch, span->data, span->size);
+    tokenizer->scratch_size = span->size;
+    span->data = tokenizer->scratch;
+}
+
+bool flipper_format_tokenizer_read_value(
+    FlipperFormatTokenizer* tokenizer,
+    FlipperFormatSpan* value,
+    bool* last) {
+    furi_assert(tokenizer);
+    furi_assert(value);
+    furi_assert(last);
+
+    enum { LeadingSpace, ReadValue, TrailingSpace } state = LeadingSpace;
+    bool result = false;
+
+    while(true) {
+        if(state == TrailingSpace && tokenizer->position == tokenizer->window_size) {
+            // the window is about to change, move the value out of it
+            flipper_format_tokenizer_keep(tokenizer, value);
+        }
+
+        if(!flipper_format_tokenizer_ensure(tokenizer, state == ReadValue)) {
+            if(state != LeadingSpace && flipper_format_tokenizer_at_eof(tokenizer)) {
+                if(state == ReadValue) flipper_format_tokenizer_token_end(tokenizer, value);
+                result = true;
+                *last = true;
+            }
+            break;
+        }
+
+        const uint8_t data = tokenizer->window[tokenizer->position];
+
+        if(state == LeadingSpace) {
+            if(flipper_format_tokenizer_is_space(data)) {
+                tokenizer->position++;
+            } else if(data == flipper_format_eoln) {
+                break;
+            } else {
+                state = ReadValue;
+                flipper_format_tokenizer_token_begin(tokenizer);
+                tokenizer->position++;
+            }
+        } else if(state == ReadValue) {
+            if(flipper_format_tokenizer_is_space(data)) {
+                flipper_format_tokenizer_token_end(tokenizer, value);
+                state = TrailingSpace;
+                tokenizer->position++;
+            } else if(data == flipper_format_eoln) {
+                flipper_format_tokenizer_token_end(tokenizer, value);
+                result = true;
+                *last = true;
+                break;
+            } else {
+                tokenizer->position++;
+            }
+        } else {
+            if(flipper_format_tokenizer_is_space(data)) {
+                tokenizer->position++;
+            } else {
+                *last = (data == flipper_format_eoln);
+                result = true;
+                break;
+            }
+        }
+    }
+
+    tokenizer->token = NULL;
+    return result;
+}
+
+bool flipper_format_tokenizer_read_line(
+    FlipperFormatTokenizer* tokenizer,
+    FlipperFormatSpan* line) {
+    furi_assert(tokenizer);
+    furi_assert(line);
+
+    line->data = NULL;
+    line->size = 0;
+
+    if(!flipper_format_tokenizer_ensure(tokenizer, false)) return false;
+    flipper_format_tokenizer_token_begin(tokenizer);
+
+    while(flipper_format_tokenizer_ensure(tokenizer, true)) {
+        const uint8_t* data = tokenizer->window + tokenizer->position;
+        const size_t size = tokenizer->window_size - tokenizer->position;
+
+        size_t i = 0;
+        while(i < size && data[i] != flipper_format_eoln && data[i] != flipper_format_eolr) i++;
+        tokenizer->position += i;
+
+        if(i == size) continue;
+
+        if(data[i] == flipper_format_eolr) {
+            flipper_format_tokenizer_token_spill(tokenizer);
+            tokenizer->position++;
+            flipper_format_tokenizer_token_resume(tokenizer);
+        } else {
+            break;
+        }
+    }
+
+    flipper_format_tokenizer_token_end(tokenizer, line);
+    return line->size != 0;
+}
+
+bool flipper_format_tokenizer_seek_to_eol(FlipperFormatTokenizer* tokenizer) {
+    furi_assert(tokenizer);
+    return flipper_format_tokenizer_skip_to_eol(tokenizer) ||
+           flipper_format_tokenizer_at_eof(tokenizer);
+}
+
+static inline bool flipper_format_span_digit(char c, uint8_t base, uint8_t* digit) {
+    uint8_t value;
+    if(c >= '0' && c <= '9') {
+        value = c - '0';
+    } else if(c >= 'a' && c <= 'z') {
+        value = c - 'a' + 10;
+    } else if(c >= 'A' && c <= 'Z') {
+        value = c - 'A' + 10;
+    } else {
+        return false;
+    }
+    if(value >= base) return false;
+    *digit = value;
+    return true;
+}
+
+/**
+ * strtoul-like parser for a span prefix
+ * @param base 0 to detect 0x and 0 prefixes
+ * @param magnitude saturated at UINT32_MAX + 1
+ * @return true at least one digit was parsed
+ */
+static bool flipper_format_span_parse_integer(
+    const FlipperFormatSpan* span,
+    uint8_t base,
+    bool* negative,
+    uint64_t* magnitude) {
+    const char* data = span->data;
+    size_t size = span->size;
+    size_t i = 0;
+
+    *negative = false;
+    *magnitude = 0;
+
+    if(i < size && (data[i] == '+' || data[i] == '-')) {
+        *negative = (data[i] == '-');
+        i++;
+    }
+
+    uint8_t digit;
+    if(base == 0) {
+        if(i + 2 < size && data[i] == '0' && (data[i + 1] == 'x' || data[i + 1] == 'X') &&
+           flipper_format_span_digit(data[i + 2], 16, &digit)) {
+            base = 16;
+            i += 2;
+        } else if(i < size && data[i] == '0') {
+            base = 8;
+        } else {
+            base = 10;
+        }
+    }
+
+    const uint64_t limit = (uint64_t)UINT32_MAX + 1;
+    size_t digits = 0;
+    while(i < size && flipper_format_span_digit(data[i], base, &digit)) {
+        if(*magnitude < limit) {
+            *magnitude = *magnitude * base + digit;
+            if(*magnitude > limit) *magnitude = limit;
+        }
+        digits++;
+        i++;
+    }
+
+    return digits > 0;
+}
+
+bool flipper_format_span_to_uint32(const FlipperFormatSpan* span, uint32_t* value) {
+    bool negative;
+    uint64_t magnitude;
+    if(!flipper_format_span_parse_integer(span, 10, &negative, &magnitude)) return false;
+
+    if(magnitude > UINT32_MAX) {
+        *value = UINT32_MAX;
+    } else {
+        *value = negative ? (uint32_t)(0U - (uint32_t)magnitude) : (uint32_t)magnitude;
+    }
+    return true;
+}
+
+bool flipper_format_span_to_int32(const FlipperFormatSpan* span, int32_t* value) {
+    bool negative;
+    uint64_t magnitude;
+    if(!flipper_format_span_parse_integer(span, 0, &negative, &magnitude)) return false;
+
+    if(negative) {
+        *value = (magnitude > (uint64_t)INT32_MAX + 1) ? INT32_MIN :
+                                                         (int32_t)(-(int64_t)magnitude);
+    } else {
+        *value = (magnitude > INT32_MAX) ? INT32_MAX : (int32_t)magnitude;
+    }
+    return true;
+}
+
+bool flipper_format_span_to_float(const FlipperFormatSpan* span, float* value) {
+    // strtof needs a terminated string, values are short enough for the stack
+    char buffer[32];
+    char* string = buffer;
+    if(span->size >= sizeof(buffer)) {
+        string = malloc(span->size + 1);
+    }
+    memcpy(string, span->data, span->size);
+    string[span->size] = '\0';
+
+    char* end_char;
+    *value = strtof(string, &end_char);
+    // most likely ok
+    bool result = (*end_char == '\0');
+
+    if(string != buffer) free(string);
+    return result;
+}
+
+bool flipper_format_span_to_hex(const FlipperFormatSpan* span, uint8_t* value) {
+    return span->size >= 2 && hex_char_to_uint8(span->data[0], span->data[1], value);
+}
+
+bool flipper_format_span_to_hex_uint64(const FlipperFormatSpan* span, uint64_t* value) {
+    return span->size >= 16 && hex_chars_to_uint64(span->data, value);
+}
+
+bool flipper_format_span_to_bool(const FlipperFormatSpan* span, bool* value) {
+    *value = (span->size == 4) && (strncasecmp(span->data, "true", 4) == 0);
+    return true;
+}
@@ -0,0 +1,179 @@
+#pragma once
+#include <toolbox/stream/stream.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FLIPPER_FORMAT_TOKENIZER_BUFFER_SIZE (64U)
+
+/** A (pointer, length) view of a token, not NUL-terminated */
+typedef struct {
+    const char* data;
+    size_t size;
+} FlipperFormatSpan;
+
+/**
+ * Tokenizer that works directly on the stream data window.
+ * Streams that implement stream_peek are parsed in place, others are read
+ * through a small internal buffer. Tokens are handed out as spans that point
+ * into the window, only tokens that cross a window boundary or contain
+ * skipped characters are assembled in a scratch buffer.
+ * Spans are valid until the next tokenizer call.
+ * Lives on the stack, nothing but the stream may be used between
+ * flipper_format_tokenizer_init and flipper_format_tokenizer_release.
+ */
+typedef struct {
+    Stream* stream;
+    const uint8_t* window;
+    size_t window_size;
+    size_t position;
+    size_t consumed;
+    bool direct;
+    bool error;
+
+    const uint8_t* token;
+    bool token_spilled;
+    char* scratch;
+    size_t scratch_size;
+    size_t scratch_capacity;
+
+    uint8_t buffer[FLIPPER_FORMAT_TOKENIZER_BUFFER_SIZE];
+} FlipperFormatTokenizer;
+
+/**
+ * Start tokenizing from the current position of the stream
+ * @param tokenizer
+ * @param stream
+ */
+void flipper_format_tokenizer_init(FlipperFormatTokenizer* tokenizer, Stream* stream);
+
+/**
+ * Stop tokenizing. The stream is left right after the last consumed byte.
+ * @param tokenizer
+ * @return true
+ * @return false
+ */
+bool flipper_format_tokenizer_release(FlipperFormatTokenizer* tokenizer);
+
+/**
+ * Number of bytes consumed since flipper_format_tokenizer_init
+ * @param tokenizer
+ * @return size_t
+ */
+size_t flipper_format_tokenizer_consumed(FlipperFormatTokenizer* tokenizer);
+
+/**
+ * Find the next valid key. The tokenizer stops at the delimiter.
+ * @param tokenizer
+ * @param key key span
+ * @param key_offset optional, consumed() value at the beginning of the key
+ * @return true key found
+ * @return false end of stream or error
+ */
+bool flipper_format_tokenizer_read_key(
+    FlipperFormatTokenizer* tokenizer,
+    FlipperFormatSpan* key,
+    size_t* key_offset);
+
+/**
+ * Find the key and move to the beginning of its value
+ * @param tokenizer
+ * @param key
+ * @param strict_mode the key must be the next one
+ * @return true
+ * @return false
+ */
+bool flipper_format_tokenizer_seek_to_key(
+    FlipperFormatTokenizer* tokenizer,
+    const char* key,
+    bool strict_mode);
+
+/**
+ * Read the next space separated value of the current line
+ * @param tokenizer
+ * @param value value span
+ * @param last set if this is the last value of the line
+ * @return true
+ * @return false
+ */
+bool flipper_format_tokenizer_read_value(
+    FlipperFormatTokenizer* tokenizer,
+    FlipperFormatSpan* value,
+    bool* last);
+
+/**
+ * Read the rest of the current line, without EOL characters
+ * @param tokenizer
+ * @param line line span
+ * @return true line is not empty
+ * @return false
+ */
+bool flipper_format_tokenizer_read_line(
+    FlipperFormatTokenizer* tokenizer,
+    FlipperFormatSpan* line);
+
+/**
+ * Move to the EOL character of the current line, or to the end of the stream
+ * @param tokenizer
+ * @return true
+ * @return false
+ */
+bool flipper_format_tokenizer_seek_to_eol(FlipperFormatTokenizer* tokenizer);
+
+/**
+ * Parse a decimal uint32, same rules as sscanf "%lu"
+ * @param span
+ * @param value
+ * @return true
+ * @return false
+ */
+bool flipper_format_span_to_uint32(const FlipperFormatSpan* span, uint32_t* value);
+
+/**
+ * Parse a decimal int32, same rules as sscanf "%li"
+ * @param span
+ * @param value
+ * @return true
+ * @return false
+ */
+bool flipper_format_span_to_int32(const FlipperFormatSpan* span, int32_t* value);
+
+/**
+ * Parse a float, the whole span must be consumed
+ * @param span
+ * @param value
+ * @return true
+ * @return false
+ */
+bool flipper_format_span_to_float(const FlipperFormatSpan* span, float* value);
+
+/**
+ * Parse a hex byte from the first two characters
+ * @param span
+ * @param value
+ * @return true
+ * @return false
+ */
+bool flipper_format_span_to_hex(const FlipperFormatSpan* span, uint8_t* value);
+
+/**
+ * Parse a hex uint64 from the first sixteen characters
+ * @param span
+ * @param value
+ * @return true
+ * @return false
+ */
+bool flipper_format_span_to_hex_uint64(const FlipperFormatSpan* span, uint64_t* value);
+
+/**
+ * Parse a bool, "true" in any case is true, anything else is false
+ * @param span
+ * @param value
+ * @return true
+ */
+bool flipper_format_span_to_bool(const FlipperFormatSpan* span, bool* value);
+
+#ifdef __cplusplus
+}
+#endif
@@ -25,3 +25,15 @@ uint8_t subghz_protocol_blocks_get_hash_data(SubGhzBlockDecoder* decoder, size_t
     }
     return hash;
 }
+
+uint64_t subghz_protocol_blocks_get_hash_data_long(SubGhzBlockDecoder* decoder, size_t len) {
+    // FNV-1a
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    const uint8_t* p = (const uint8_t*)&decoder->decode_data;
+    if(len > sizeof(decoder->decode_data)) len = sizeof(decoder->decode_data);
+    for(size_t i = 0; i < len; i++) {
+        hash = (hash ^ p[i]) * 0x100000001B3ULL;
+    }
+    hash = (hash ^ decoder->decode_count_bit) * 0x100000001B3ULL;
+    return hash;
+}
@@ -42,6 +42,15 @@ void subghz_protocol_blocks_add_to_128_bit(
  */
 uint8_t subghz_protocol_blocks_get_hash_data(SubGhzBlockDecoder* decoder, size_t len);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * Unlike subghz_protocol_blocks_get_hash_data() bit count is part of the fingerprint.
+ * @param decoder Pointer to a SubGhzBlockDecoder instance
+ * @param len Number of data bytes to hash
+ * @return hash 64-bit hash sum
+ */
+uint64_t subghz_protocol_blocks_get_hash_data_long(SubGhzBlockDecoder* decoder, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -56,3 +56,144 @@ size_t subghz_protocol_blocks_get_upload_from_bit_array(
         subghz_protocol_blocks_get_bit_array(data_array, index_bit - 1), duration);
     return size_upload;
 }
+
+void subghz_protocol_blocks_generator_reset(SubGhzProtocolBlockGenerator* generator) {
+    furi_assert(generator);
+    size_t repeat = generator->repeat;
+    memset(generator, 0, sizeof(SubGhzProtocolBlockGenerator));
+    generator->repeat = repeat;
+}
+
+void subghz_protocol_blocks_generator_set_data(
+    SubGhzProtocolBlockGenerator* generator,
+    uint64_t data,
+    uint8_t data_count_bit) {
+    furi_assert(generator);
+    furi_assert(data_count_bit <= 64);
+    generator->data = data;
+    generator->data_count_bit = data_count_bit;
+}
+
+void subghz_protocol_blocks_generator_set_bit(
+    SubGhzProtocolBlockGenerator* generator,
+    bool bit_value,
+    LevelDuration first,
+    LevelDuration second) {
+    furi_assert(generator);
+    generator->bit[bit_value][0] = first;
+    generator->bit[bit_value][1] = second;
+}
+
+bool subghz_protocol_blocks_generator_add_header(
+    SubGhzProtocolBlockGenerator* generator,
+    LevelDuration level_duration) {
+    furi_assert(generator);
+    if(generator->header_count == SUBGHZ_BLOCK_GENERATOR_FRAME_PULSE_MAX) {
+        FURI_LOG_E(TAG, "Generator header is full");
+        return false;
+    }
+    generator->header[generator->header_count++] = level_duration;
+    return true;
+}
+
+bool subghz_protocol_blocks_generator_add_trailer(
+    SubGhzProtocolBlockGenerator* generator,
+    LevelDuration level_duration) {
+    furi_assert(generator);
+    if(generator->trailer_count == SUBGHZ_BLOCK_GENERATOR_FRAME_PULSE_MAX) {
+        FURI_LOG_E(TAG, "Generator trailer is full");
+        return false;
+    }
+    generator->trailer[generator->trailer_count++] = level_duration;
+    return true;
+}
+
+bool subghz_protocol_blocks_generator_start(SubGhzProtocolBlockGenerator* generator) {
+    furi_assert(generator);
+    generator->step = SubGhzProtocolBlockGeneratorStepHeader;
+    generator->index = 0;
+    generator->half = 0;
+    generator->is_pending = false;
+    generator->is_running =
+        (generator->header_count + generator->data_count_bit + generator->trailer_count) > 0;
+    return generator->is_running;
+}
+
+/**
+ * Get the next pulse of the frame sequence, without merging.
+ * @param generator Pointer to a SubGhzProtocolBlockGenerator instance
+ * @param level_duration Output pulse
+ * @return false When all repeats are sent
+ */
+static bool subghz_protocol_blocks_generator_next(
+    SubGhzProtocolBlockGenerator* generator,
+    LevelDuration* level_duration) {
+    while(generator->repeat) {
+        switch(generator->step) {
+        case SubGhzProtocolBlockGeneratorStepHeader:
+            if(generator->index < generator->header_count) {
+                *level_duration = generator->header[generator->index++];
+                return true;
+            }
+            generator->step = SubGhzProtocolBlockGeneratorStepData;
+            generator->index = 0;
+            generator->half = 0;
+            break;
+        case SubGhzProtocolBlockGeneratorStepData:
+            if(generator->index < generator->data_count_bit) {
+                bool bit = bit_read(
+                    generator->data, generator->data_count_bit - 1 - generator->index);
+                *level_duration = generator->bit[bit][generator->half];
+                if(++generator->half == 2) {
+                    generator->half = 0;
+                    generator->index++;
+                }
+                return true;
+            }
+            generator->step = SubGhzProtocolBlockGeneratorStepTrailer;
+            generator->index = 0;
+            break;
+        case SubGhzProtocolBlockGeneratorStepTrailer:
+            if(generator->index < generator->trailer_count) {
+                *level_duration = generator->trailer[generator->index++];
+                return true;
+            }
+            generator->step = SubGhzProtocolBlockGeneratorStepHeader;
+            generator->index = 0;
+            generator->repeat--;
+            break;
+        }
+    }
+    return false;
+}
+
+LevelDuration subghz_protocol_blocks_generator_yield(SubGhzProtocolBlockGenerator* generator) {
+    furi_assert(generator);
+    if(!generator->is_running) {
+        return level_duration_reset();
+    }
+
+    LevelDuration ret;
+    if(generator->is_pending) {
+        ret = generator->pending;
+        generator->is_pending = false;
+    } else if(!subghz_protocol_blocks_generator_next(generator, &ret)) {
+        generator->is_running = false;
+        return level_duration_reset();
+    }
+
+    // Merge following pulses of the same level, keep the first different one for later
+    LevelDuration next;
+    while(subghz_protocol_blocks_generator_next(generator, &next)) {
+        if(level_duration_get_level(next) != level_duration_get_level(ret)) {
+            generator->pending = next;
+            generator->is_pending = true;
+            break;
+        }
+        ret = level_duration_make(
+            level_duration_get_level(ret),
+            level_duration_get_duration(ret) + level_duration_get_duration(next));
+    }
+
+    return ret;
+}
@@ -19,6 +19,38 @@ typedef struct {
 
 } SubGhzProtocolBlockEncoder;
 
+#define SUBGHZ_BLOCK_GENERATOR_FRAME_PULSE_MAX 4
+
+typedef enum {
+    SubGhzProtocolBlockGeneratorStepHeader,
+    SubGhzProtocolBlockGeneratorStepData,
+    SubGhzProtocolBlockGeneratorStepTrailer,
+} SubGhzProtocolBlockGeneratorStep;
+
+/**
+ * Streaming encoder: a frame is header pulses, data bits MSB first (two pulses per bit)
+ * and trailer pulses. LevelDurations are computed on demand in yield, so no upload
+ * buffer is needed and the number of repeats is not limited.
+ */
+typedef struct {
+    bool is_running;
+    size_t repeat;
+
+    uint64_t data;
+    uint8_t data_count_bit;
+    LevelDuration bit[2][2];
+    LevelDuration header[SUBGHZ_BLOCK_GENERATOR_FRAME_PULSE_MAX];
+    uint8_t header_count;
+    LevelDuration trailer[SUBGHZ_BLOCK_GENERATOR_FRAME_PULSE_MAX];
+    uint8_t trailer_count;
+
+    SubGhzProtocolBlockGeneratorStep step;
+    uint8_t index;
+    uint8_t half;
+    bool is_pending;
+    LevelDuration pending;
+} SubGhzProtocolBlockGenerator;
+
 typedef enum {
     SubGhzProtocolBlockAlignBitLeft,
     SubGhzProtocolBlockAlignBitRight,
@@ -62,6 +94,70 @@ size_t subghz_protocol_blocks_get_upload_from_bit_array(
     uint32_t duration_bit,
     SubGhzProtocolBlockAlignBit align_bit);
 
+/**
+ * Reset generator frame description, repeat counter is kept.
+ * @param generator Pointer to a SubGhzProtocolBlockGenerator instance
+ */
+void subghz_protocol_blocks_generator_reset(SubGhzProtocolBlockGenerator* generator);
+
+/**
+ * Set generator data bits, sent MSB first.
+ * @param generator Pointer to a SubGhzProtocolBlockGenerator instance
+ * @param data Data to send
+ * @param data_count_bit Number of bits to send, up to 64
+ */
+void subghz_protocol_blocks_generator_set_data(
+    SubGhzProtocolBlockGenerator* generator,
+    uint64_t data,
+    uint8_t data_count_bit);
+
+/**
+ * Set the pulse pair used to send a data bit.
+ * @param generator Pointer to a SubGhzProtocolBlockGenerator instance
+ * @param bit_value The bit value being described
+ * @param first First LevelDuration of the bit
+ * @param second Second LevelDuration of the bit
+ */
+void subghz_protocol_blocks_generator_set_bit(
+    SubGhzProtocolBlockGenerator* generator,
+    bool bit_value,
+    LevelDuration first,
+    LevelDuration second);
+
+/**
+ * Append a pulse sent before data bits in every frame.
+ * @param generator Pointer to a SubGhzProtocolBlockGenerator instance
+ * @param level_duration Pulse to add
+ * @return true On success
+ */
+bool subghz_protocol_blocks_generator_add_header(
+    SubGhzProtocolBlockGenerator* generator,
+    LevelDuration level_duration);
+
+/**
+ * Append a pulse sent after data bits in every frame.
+ * @param generator Pointer to a SubGhzProtocolBlockGenerator instance
+ * @param level_duration Pulse to add
+ * @return true On success
+ */
+bool subghz_protocol_blocks_generator_add_trailer(
+    SubGhzProtocolBlockGenerator* generator,
+    LevelDuration level_duration);
+
+/**
+ * Rewind generator to the first frame and start it.
+ * @param generator Pointer to a SubGhzProtocolBlockGenerator instance
+ * @return true On success, false if the frame is empty
+ */
+bool subghz_protocol_blocks_generator_start(SubGhzProtocolBlockGenerator* generator);
+
+/**
+ * Get the next LevelDuration, adjacent pulses with the same level are merged.
+ * @param generator Pointer to a SubGhzProtocolBlockGenerator instance
+ * @return LevelDuration, level_duration_reset() when all repeats are sent
+ */
+LevelDuration subghz_protocol_blocks_generator_yield(SubGhzProtocolBlockGenerator* generator);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -27,6 +27,7 @@ struct SubGhzProtocolDecoderAlutech_at_4n {
     uint16_t header_count;
 
     const char* alutech_at_4n_rainbow_table_file_name;
+    SubGhzKeystoreRawReader* alutech_at_4n_rainbow_table;
 };
 
 struct SubGhzProtocolEncoderAlutech_at_4n {
@@ -76,20 +77,20 @@ const SubGhzProtocol subghz_protocol_alutech_at_4n = {
 
 /**
  * Read bytes from rainbow table
- * @param file_name Full path to rainbow table the file
+ * @param rainbow_table Pointer to a SubGhzKeystoreRawReader instance
  * @param number_alutech_at_4n_magic_data number in the array
  * @return alutech_at_4n_magic_data
  */
 static uint32_t subghz_protocol_alutech_at_4n_get_magic_data_in_file(
-    const char* file_name,
+    SubGhzKeystoreRawReader* rainbow_table,
     uint8_t number_alutech_at_4n_magic_data) {
-    if(!strcmp(file_name, "")) return SUBGHZ_NO_ALUTECH_AT_4N_RAINBOW_TABLE;
+    if(!rainbow_table) return SUBGHZ_NO_ALUTECH_AT_4N_RAINBOW_TABLE;
 
     uint8_t buffer[sizeof(uint32_t)] = {0};
     uint32_t address = number_alutech_at_4n_magic_data * sizeof(uint32_t);
     uint32_t alutech_at_4n_magic_data = 0;
 
-    if(subghz_keystore_raw_get_data(file_name, address, buffer, sizeof(uint32_t))) {
+    if(subghz_keystore_raw_reader_get_data(rainbow_table, address, buffer, sizeof(uint32_t))) {
         for(size_t i = 0; i < sizeof(uint32_t); i++) {
             alutech_at_4n_magic_data = (alutech_at_4n_magic_data << 8) | buffer[i];
         }
@@ -129,18 +130,20 @@ static uint8_t subghz_protocol_alutech_at_4n_decrypt_data_crc(uint8_t data) {
     return ~crc;
 }
 
-static uint64_t subghz_protocol_alutech_at_4n_decrypt(uint64_t data, const char* file_name) {
+static uint64_t subghz_protocol_alutech_at_4n_decrypt(
+    uint64_t data,
+    SubGhzKeystoreRawReader* rainbow_table) {
     uint8_t* p = (uint8_t*)&data;
     uint32_t data1 = p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
     uint32_t data2 = p[4] << 24 | p[5] << 16 | p[6] << 8 | p[7];
     uint32_t data3 = 0;
     uint32_t magic_data[] = {
-        subghz_protocol_alutech_at_4n_get_magic_data_in_file(file_name, 0),
-        subghz_protocol_alutech_at_4n_get_magic_data_in_file(file_name, 1),
-        subghz_protocol_alutech_at_4n_get_magic_data_in_file(file_name, 2),
-        subghz_protocol_alutech_at_4n_get_magic_data_in_file(file_name, 3),
-        subghz_protocol_alutech_at_4n_get_magic_data_in_file(file_name, 4),
-        subghz_protocol_alutech_at_4n_get_magic_data_in_file(file_name, 5)};
+        subghz_protocol_alutech_at_4n_get_magic_data_in_file(rainbow_table, 0),
+        subghz_protocol_alutech_at_4n_get_magic_data_in_file(rainbow_table, 1),
+        subghz_protocol_alutech_at_4n_get_magic_data_in_file(rainbow_table, 2),
+        subghz_protocol_alutech_at_4n_get_magic_data_in_file(rainbow_table, 3),
+        subghz_protocol_alutech_at_4n_get_magic_data_in_file(rainbow_table, 4),
+        subghz_protocol_alutech_at_4n_get_magic_data_in_file(rainbow_table, 5)};
 
     uint32_t i = magic_data[0];
     do {
@@ -206,6 +209,8 @@ void* subghz_protocol_decoder_alutech_at_4n_alloc(SubGhzEnvironment* environment
     if(instance->alutech_at_4n_rainbow_table_file_name) {
         FURI_LOG_I(
             TAG, "Loading rainbow table from %s", instance->alutech_at_4n_rainbow_table_file_name);
+        instance->alutech_at_4n_rainbow_table =
+            subghz_keystore_raw_reader_alloc(instance->alutech_at_4n_rainbow_table_file_name);
     }
     return instance;
 }
@@ -214,6 +219,9 @@ void subghz_protocol_decoder_alutech_at_4n_free(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderAlutech_at_4n* instance = context;
     instance->alutech_at_4n_rainbow_table_file_name = NULL;
+    if(instance->alutech_at_4n_rainbow_table) {
+        subghz_keystore_raw_reader_free(instance->alutech_at_4n_rainbow_table);
+    }
     free(instance);
 }
 
@@ -334,12 +342,12 @@ void subghz_protocol_decoder_alutech_at_4n_feed(void* context, bool level, uint3
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
- * @param file_name Full path to rainbow table the file
+ * @param rainbow_table Pointer to a SubGhzKeystoreRawReader instance
  */
 static void subghz_protocol_alutech_at_4n_remote_controller(
     SubGhzBlockGeneric* instance,
     uint8_t crc,
-    const char* file_name) {
+    SubGhzKeystoreRawReader* rainbow_table) {
     /**
  *  Message format 72bit LSB first
  *           data        crc
@@ -361,7 +369,7 @@ static void subghz_protocol_alutech_at_4n_remote_controller(
     crc = subghz_protocol_blocks_reverse_key(crc, 8);
 
     if(crc == subghz_protocol_alutech_at_4n_crc(data)) {
-        data = subghz_protocol_alutech_at_4n_decrypt(data, file_name);
+        data = subghz_protocol_alutech_at_4n_decrypt(data, rainbow_table);
         status = true;
     }
 
@@ -433,7 +441,7 @@ void subghz_protocol_decoder_alutech_at_4n_get_string(void* context, FuriString*
     furi_assert(context);
     SubGhzProtocolDecoderAlutech_at_4n* instance = context;
     subghz_protocol_alutech_at_4n_remote_controller(
-        &instance->generic, instance->crc, instance->alutech_at_4n_rainbow_table_file_name);
+        &instance->generic, instance->crc, instance->alutech_at_4n_rainbow_table);
     uint32_t code_found_hi = instance->generic.data >> 32;
     uint32_t code_found_lo = instance->generic.data & 0x00000000ffffffff;
 
@@ -21,6 +21,14 @@ static const SubGhzBlockConst subghz_protocol_ansonic_const = {
     .min_count_bit_for_found = 12,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_ansonic_wakeup = {
+    .level = false,
+    .te = &subghz_protocol_ansonic_const.te_short,
+    .te_count = 35,
+    .te_delta = &subghz_protocol_ansonic_const.te_delta,
+    .te_delta_count = 35,
+};
+
 struct SubGhzProtocolDecoderAnsonic {
     SubGhzProtocolDecoderBase base;
 
@@ -53,6 +61,10 @@ const SubGhzProtocolDecoder subghz_protocol_ansonic_decoder = {
     .serialize = subghz_protocol_decoder_ansonic_serialize,
     .deserialize = subghz_protocol_decoder_ansonic_deserialize,
     .get_string = subghz_protocol_decoder_ansonic_get_string,
+
+    .wakeup = &subghz_protocol_ansonic_wakeup,
+    .is_idle = subghz_protocol_decoder_ansonic_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_ansonic_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_ansonic_encoder = {
@@ -207,6 +219,12 @@ void subghz_protocol_decoder_ansonic_reset(void* context) {
     instance->decoder.parser_step = AnsonicDecoderStepReset;
 }
 
+bool subghz_protocol_decoder_ansonic_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderAnsonic* instance = context;
+    return instance->decoder.parser_step == AnsonicDecoderStepReset;
+}
+
 void subghz_protocol_decoder_ansonic_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderAnsonic* instance = context;
@@ -302,6 +320,13 @@ uint8_t subghz_protocol_decoder_ansonic_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_ansonic_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderAnsonic* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_ansonic_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -60,3 +60,18 @@ uint8_t subghz_protocol_decoder_base_get_hash_data(SubGhzProtocolDecoderBase* de
 
     return hash;
 }
+
+uint64_t
+    subghz_protocol_decoder_base_get_hash_data_long(SubGhzProtocolDecoderBase* decoder_base) {
+    uint64_t hash = 0;
+
+    if(decoder_base->protocol && decoder_base->protocol->decoder) {
+        if(decoder_base->protocol->decoder->get_hash_data_long) {
+            hash = decoder_base->protocol->decoder->get_hash_data_long(decoder_base);
+        } else if(decoder_base->protocol->decoder->get_hash_data) {
+            hash = decoder_base->protocol->decoder->get_hash_data(decoder_base);
+        }
+    }
+
+    return hash;
+}
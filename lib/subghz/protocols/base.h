@@ -73,6 +73,15 @@ SubGhzProtocolStatus subghz_protocol_decoder_base_deserialize(
  */
 uint8_t subghz_protocol_decoder_base_get_hash_data(SubGhzProtocolDecoderBase* decoder_base);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * Falls back to the 8-bit hash sum if the protocol has no fingerprint.
+ * @param decoder_base Pointer to a SubGhzProtocolDecoderBase instance
+ * @return hash 64-bit hash sum
+ */
+uint64_t
+    subghz_protocol_decoder_base_get_hash_data_long(SubGhzProtocolDecoderBase* decoder_base);
+
 // Encoder Base
 typedef struct SubGhzProtocolEncoderBase SubGhzProtocolEncoderBase;
 
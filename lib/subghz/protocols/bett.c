@@ -32,6 +32,14 @@ static const SubGhzBlockConst subghz_protocol_bett_const = {
     .min_count_bit_for_found = 18,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_bett_wakeup = {
+    .level = false,
+    .te = &subghz_protocol_bett_const.te_short,
+    .te_count = 44,
+    .te_delta = &subghz_protocol_bett_const.te_delta,
+    .te_delta_count = 15,
+};
+
 struct SubGhzProtocolDecoderBETT {
     SubGhzProtocolDecoderBase base;
 
@@ -63,6 +71,10 @@ const SubGhzProtocolDecoder subghz_protocol_bett_decoder = {
     .serialize = subghz_protocol_decoder_bett_serialize,
     .deserialize = subghz_protocol_decoder_bett_deserialize,
     .get_string = subghz_protocol_decoder_bett_get_string,
+
+    .wakeup = &subghz_protocol_bett_wakeup,
+    .is_idle = subghz_protocol_decoder_bett_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_bett_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_bett_encoder = {
@@ -226,6 +238,12 @@ void subghz_protocol_decoder_bett_reset(void* context) {
     instance->decoder.parser_step = BETTDecoderStepReset;
 }
 
+bool subghz_protocol_decoder_bett_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderBETT* instance = context;
+    return instance->decoder.parser_step == BETTDecoderStepReset;
+}
+
 void subghz_protocol_decoder_bett_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderBETT* instance = context;
@@ -296,6 +314,13 @@ uint8_t subghz_protocol_decoder_bett_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_bett_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderBETT* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_bett_serialize(
     void* context,
     FlipperFormat* flipper_format,
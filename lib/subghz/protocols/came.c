@@ -27,6 +27,14 @@ static const SubGhzBlockConst subghz_protocol_came_const = {
     .min_count_bit_for_found = 12,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_came_wakeup = {
+    .level = false,
+    .te = &subghz_protocol_came_const.te_short,
+    .te_count = 56,
+    .te_delta = &subghz_protocol_came_const.te_delta,
+    .te_delta_count = 47,
+};
+
 struct SubGhzProtocolDecoderCame {
     SubGhzProtocolDecoderBase base;
 
@@ -37,7 +45,7 @@ struct SubGhzProtocolDecoderCame {
 struct SubGhzProtocolEncoderCame {
     SubGhzProtocolEncoderBase base;
 
-    SubGhzProtocolBlockEncoder encoder;
+    SubGhzProtocolBlockGenerator generator;
     SubGhzBlockGeneric generic;
 };
 
@@ -59,6 +67,10 @@ const SubGhzProtocolDecoder subghz_protocol_came_decoder = {
     .serialize = subghz_protocol_decoder_came_serialize,
     .deserialize = subghz_protocol_decoder_came_deserialize,
     .get_string = subghz_protocol_decoder_came_get_string,
+
+    .wakeup = &subghz_protocol_came_wakeup,
+    .is_idle = subghz_protocol_decoder_came_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_came_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_encoder = {
@@ -88,17 +100,14 @@ void* subghz_protocol_encoder_came_alloc(SubGhzEnvironment* environment) {
     instance->base.protocol = &subghz_protocol_came;
     instance->generic.protocol_name = instance->base.protocol->name;
 
-    instance->encoder.repeat = 10;
-    instance->encoder.size_upload = 128;
-    instance->encoder.upload = malloc(instance->encoder.size_upload * sizeof(LevelDuration));
-    instance->encoder.is_running = false;
+    instance->generator.repeat = 10;
+    instance->generator.is_running = false;
     return instance;
 }
 
 void subghz_protocol_encoder_came_free(void* context) {
     furi_assert(context);
     SubGhzProtocolEncoderCame* instance = context;
-    free(instance->encoder.upload);
     free(instance);
 }
 
@@ -109,15 +118,12 @@ void subghz_protocol_encoder_came_free(void* context) {
  */
 static bool subghz_protocol_encoder_came_get_upload(SubGhzProtocolEncoderCame* instance) {
     furi_assert(instance);
+    SubGhzProtocolBlockGenerator* generator = &instance->generator;
+    const uint32_t te_short = subghz_protocol_came_const.te_short;
+    const uint32_t te_long = subghz_protocol_came_const.te_long;
     uint32_t header_te = 0;
-    size_t index = 0;
-    size_t size_upload = (instance->generic.data_count_bit * 2) + 2;
-    if(size_upload > instance->encoder.size_upload) {
-        FURI_LOG_E(TAG, "Size upload exceeds allocated encoder buffer.");
-        return false;
-    } else {
-        instance->encoder.size_upload = size_upload;
-    }
+
+    subghz_protocol_blocks_generator_reset(generator);
     //Send header
 
     switch(instance->generic.data_count_bit) {
@@ -139,28 +145,22 @@ static bool subghz_protocol_encoder_came_get_upload(SubGhzProtocolEncoderCame* i
         header_te = 16;
         break;
     }
-    instance->encoder.upload[index++] =
-        level_duration_make(false, (uint32_t)subghz_protocol_came_const.te_short * header_te);
+    subghz_protocol_blocks_generator_add_header(
+        generator, level_duration_make(false, te_short * header_te));
     //Send start bit
-    instance->encoder.upload[index++] =
-        level_duration_make(true, (uint32_t)subghz_protocol_came_const.te_short);
+    subghz_protocol_blocks_generator_add_header(generator, level_duration_make(true, te_short));
     //Send key data
-    for(uint8_t i = instance->generic.data_count_bit; i > 0; i--) {
-        if(bit_read(instance->generic.data, i - 1)) {
-            //send bit 1
-            instance->encoder.upload[index++] =
-                level_duration_make(false, (uint32_t)subghz_protocol_came_const.te_long);
-            instance->encoder.upload[index++] =
-                level_duration_make(true, (uint32_t)subghz_protocol_came_const.te_short);
-        } else {
-            //send bit 0
-            instance->encoder.upload[index++] =
-                level_duration_make(false, (uint32_t)subghz_protocol_came_const.te_short);
-            instance->encoder.upload[index++] =
-                level_duration_make(true, (uint32_t)subghz_protocol_came_const.te_long);
-        }
-    }
-    return true;
+    subghz_protocol_blocks_generator_set_data(
+        generator, instance->generic.data, instance->generic.data_count_bit);
+    subghz_protocol_blocks_generator_set_bit(
+        generator, true, level_duration_make(false, te_long), level_duration_make(true, te_short));
+    subghz_protocol_blocks_generator_set_bit(
+        generator,
+        false,
+        level_duration_make(false, te_short),
+        level_duration_make(true, te_long));
+
+    return subghz_protocol_blocks_generator_start(generator);
 }
 
 SubGhzProtocolStatus
@@ -180,13 +180,12 @@ SubGhzProtocolStatus
         }
         //optional parameter parameter
         flipper_format_read_uint32(
-            flipper_format, "Repeat", (uint32_t*)&instance->encoder.repeat, 1);
+            flipper_format, "Repeat", (uint32_t*)&instance->generator.repeat, 1);
 
         if(!subghz_protocol_encoder_came_get_upload(instance)) {
             ret = SubGhzProtocolStatusErrorEncoderGetUpload;
             break;
         }
-        instance->encoder.is_running = true;
     } while(false);
 
     return ret;
@@ -194,25 +193,12 @@ SubGhzProtocolStatus
 
 void subghz_protocol_encoder_came_stop(void* context) {
     SubGhzProtocolEncoderCame* instance = context;
-    instance->encoder.is_running = false;
+    instance->generator.is_running = false;
 }
 
 LevelDuration subghz_protocol_encoder_came_yield(void* context) {
     SubGhzProtocolEncoderCame* instance = context;
-
-    if(instance->encoder.repeat == 0 || !instance->encoder.is_running) {
-        instance->encoder.is_running = false;
-        return level_duration_reset();
-    }
-
-    LevelDuration ret = instance->encoder.upload[instance->encoder.front];
-
-    if(++instance->encoder.front == instance->encoder.size_upload) {
-        instance->encoder.repeat--;
-        instance->encoder.front = 0;
-    }
-
-    return ret;
+    return subghz_protocol_blocks_generator_yield(&instance->generator);
 }
 
 void* subghz_protocol_decoder_came_alloc(SubGhzEnvironment* environment) {
@@ -235,6 +221,12 @@ void subghz_protocol_decoder_came_reset(void* context) {
     instance->decoder.parser_step = CameDecoderStepReset;
 }
 
+bool subghz_protocol_decoder_came_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCame* instance = context;
+    return instance->decoder.parser_step == CameDecoderStepReset;
+}
+
 void subghz_protocol_decoder_came_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderCame* instance = context;
@@ -317,6 +309,13 @@ uint8_t subghz_protocol_decoder_came_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_came_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCame* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_came_serialize(
     void* context,
     FlipperFormat* flipper_format,
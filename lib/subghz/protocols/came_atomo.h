@@ -44,6 +44,13 @@ void subghz_protocol_decoder_came_atomo_feed(void* context, bool level, uint32_t
  */
 uint8_t subghz_protocol_decoder_came_atomo_get_hash_data(void* context);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * @param context Pointer to a SubGhzProtocolDecoderCameAtomo instance
+ * @return hash 64-bit hash sum
+ */
+uint64_t subghz_protocol_decoder_came_atomo_get_hash_data_long(void* context);
+
 /**
  * Serialize data SubGhzProtocolDecoderCameAtomo.
  * @param context Pointer to a SubGhzProtocolDecoderCameAtomo instance
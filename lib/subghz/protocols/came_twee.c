@@ -50,6 +50,14 @@ static const SubGhzBlockConst subghz_protocol_came_twee_const = {
     .min_count_bit_for_found = 54,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_came_twee_wakeup = {
+    .level = false,
+    .te = &subghz_protocol_came_twee_const.te_long,
+    .te_count = 51,
+    .te_delta = &subghz_protocol_came_twee_const.te_delta,
+    .te_delta_count = 20,
+};
+
 struct SubGhzProtocolDecoderCameTwee {
     SubGhzProtocolDecoderBase base;
 
@@ -81,6 +89,10 @@ const SubGhzProtocolDecoder subghz_protocol_came_twee_decoder = {
     .serialize = subghz_protocol_decoder_came_twee_serialize,
     .deserialize = subghz_protocol_decoder_came_twee_deserialize,
     .get_string = subghz_protocol_decoder_came_twee_get_string,
+
+    .wakeup = &subghz_protocol_came_twee_wakeup,
+    .is_idle = subghz_protocol_decoder_came_twee_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_came_twee_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_twee_encoder = {
@@ -314,6 +326,12 @@ void subghz_protocol_decoder_came_twee_reset(void* context) {
         NULL);
 }
 
+bool subghz_protocol_decoder_came_twee_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCameTwee* instance = context;
+    return instance->decoder.parser_step == CameTweeDecoderStepReset;
+}
+
 void subghz_protocol_decoder_came_twee_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderCameTwee* instance = context;
@@ -416,6 +434,13 @@ uint8_t subghz_protocol_decoder_came_twee_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_came_twee_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCameTwee* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_came_twee_serialize(
     void* context,
     FlipperFormat* flipper_format,
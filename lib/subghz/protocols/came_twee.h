@@ -65,6 +65,13 @@ void subghz_protocol_decoder_came_twee_free(void* context);
  */
 void subghz_protocol_decoder_came_twee_reset(void* context);
 
+/**
+ * Check that decoder SubGhzProtocolDecoderCameTwee waits for a frame start.
+ * @param context Pointer to a SubGhzProtocolDecoderCameTwee instance
+ * @return true if decoder is in reset state
+ */
+bool subghz_protocol_decoder_came_twee_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderCameTwee instance
@@ -80,6 +87,13 @@ void subghz_protocol_decoder_came_twee_feed(void* context, bool level, uint32_t
  */
 uint8_t subghz_protocol_decoder_came_twee_get_hash_data(void* context);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * @param context Pointer to a SubGhzProtocolDecoderCameTwee instance
+ * @return hash 64-bit hash sum
+ */
+uint64_t subghz_protocol_decoder_came_twee_get_hash_data_long(void* context);
+
 /**
  * Serialize data SubGhzProtocolDecoderCameTwee.
  * @param context Pointer to a SubGhzProtocolDecoderCameTwee instance
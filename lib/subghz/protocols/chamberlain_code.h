@@ -80,6 +80,13 @@ void subghz_protocol_decoder_chamb_code_feed(void* context, bool level, uint32_t
  */
 uint8_t subghz_protocol_decoder_chamb_code_get_hash_data(void* context);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * @param context Pointer to a SubGhzProtocolDecoderChamb_Code instance
+ * @return hash 64-bit hash sum
+ */
+uint64_t subghz_protocol_decoder_chamb_code_get_hash_data_long(void* context);
+
 /**
  * Serialize data SubGhzProtocolDecoderChamb_Code.
  * @param context Pointer to a SubGhzProtocolDecoderChamb_Code instance
@@ -31,6 +31,14 @@ static const SubGhzBlockConst subghz_protocol_clemsa_const = {
     .min_count_bit_for_found = 18,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_clemsa_wakeup = {
+    .level = false,
+    .te = &subghz_protocol_clemsa_const.te_short,
+    .te_count = 51,
+    .te_delta = &subghz_protocol_clemsa_const.te_delta,
+    .te_delta_count = 25,
+};
+
 struct SubGhzProtocolDecoderClemsa {
     SubGhzProtocolDecoderBase base;
 
@@ -62,6 +70,10 @@ const SubGhzProtocolDecoder subghz_protocol_clemsa_decoder = {
     .serialize = subghz_protocol_decoder_clemsa_serialize,
     .deserialize = subghz_protocol_decoder_clemsa_deserialize,
     .get_string = subghz_protocol_decoder_clemsa_get_string,
+
+    .wakeup = &subghz_protocol_clemsa_wakeup,
+    .is_idle = subghz_protocol_decoder_clemsa_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_clemsa_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_clemsa_encoder = {
@@ -226,6 +238,12 @@ void subghz_protocol_decoder_clemsa_reset(void* context) {
     instance->decoder.parser_step = ClemsaDecoderStepReset;
 }
 
+bool subghz_protocol_decoder_clemsa_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderClemsa* instance = context;
+    return instance->decoder.parser_step == ClemsaDecoderStepReset;
+}
+
 void subghz_protocol_decoder_clemsa_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderClemsa* instance = context;
@@ -317,6 +335,13 @@ uint8_t subghz_protocol_decoder_clemsa_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_clemsa_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderClemsa* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_clemsa_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -22,6 +22,14 @@ static const SubGhzBlockConst subghz_protocol_doitrand_const = {
     .min_count_bit_for_found = 37,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_doitrand_wakeup = {
+    .level = false,
+    .te = &subghz_protocol_doitrand_const.te_short,
+    .te_count = 62,
+    .te_delta = &subghz_protocol_doitrand_const.te_delta,
+    .te_delta_count = 30,
+};
+
 struct SubGhzProtocolDecoderDoitrand {
     SubGhzProtocolDecoderBase base;
 
@@ -54,6 +62,10 @@ const SubGhzProtocolDecoder subghz_protocol_doitrand_decoder = {
     .serialize = subghz_protocol_decoder_doitrand_serialize,
     .deserialize = subghz_protocol_decoder_doitrand_deserialize,
     .get_string = subghz_protocol_decoder_doitrand_get_string,
+
+    .wakeup = &subghz_protocol_doitrand_wakeup,
+    .is_idle = subghz_protocol_decoder_doitrand_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_doitrand_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_doitrand_encoder = {
@@ -206,6 +218,12 @@ void subghz_protocol_decoder_doitrand_reset(void* context) {
     instance->decoder.parser_step = DoitrandDecoderStepReset;
 }
 
+bool subghz_protocol_decoder_doitrand_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderDoitrand* instance = context;
+    return instance->decoder.parser_step == DoitrandDecoderStepReset;
+}
+
 void subghz_protocol_decoder_doitrand_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderDoitrand* instance = context;
@@ -310,6 +328,13 @@ uint8_t subghz_protocol_decoder_doitrand_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_doitrand_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderDoitrand* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_doitrand_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -16,6 +16,14 @@ static const SubGhzBlockConst subghz_protocol_dooya_const = {
     .min_count_bit_for_found = 40,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_dooya_wakeup = {
+    .level = false,
+    .te = &subghz_protocol_dooya_const.te_long,
+    .te_count = 12,
+    .te_delta = &subghz_protocol_dooya_const.te_delta,
+    .te_delta_count = 20,
+};
+
 struct SubGhzProtocolDecoderDooya {
     SubGhzProtocolDecoderBase base;
 
@@ -48,6 +56,10 @@ const SubGhzProtocolDecoder subghz_protocol_dooya_decoder = {
     .serialize = subghz_protocol_decoder_dooya_serialize,
     .deserialize = subghz_protocol_decoder_dooya_deserialize,
     .get_string = subghz_protocol_decoder_dooya_get_string,
+
+    .wakeup = &subghz_protocol_dooya_wakeup,
+    .is_idle = subghz_protocol_decoder_dooya_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_dooya_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_dooya_encoder = {
@@ -216,6 +228,12 @@ void subghz_protocol_decoder_dooya_reset(void* context) {
     instance->decoder.parser_step = DooyaDecoderStepReset;
 }
 
+bool subghz_protocol_decoder_dooya_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderDooya* instance = context;
+    return instance->decoder.parser_step == DooyaDecoderStepReset;
+}
+
 void subghz_protocol_decoder_dooya_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderDooya* instance = context;
@@ -354,6 +372,13 @@ uint8_t subghz_protocol_decoder_dooya_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_dooya_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderDooya* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_dooya_serialize(
     void* context,
     FlipperFormat* flipper_format,
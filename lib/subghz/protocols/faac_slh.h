@@ -45,6 +45,13 @@ void subghz_protocol_decoder_faac_slh_feed(void* context, bool level, uint32_t d
  */
 uint8_t subghz_protocol_decoder_faac_slh_get_hash_data(void* context);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * @param context Pointer to a SubGhzProtocolDecoderFaacSLH instance
+ * @return hash 64-bit hash sum
+ */
+uint64_t subghz_protocol_decoder_faac_slh_get_hash_data_long(void* context);
+
 /**
  * Serialize data SubGhzProtocolDecoderFaacSLH.
  * @param context Pointer to a SubGhzProtocolDecoderFaacSLH instance
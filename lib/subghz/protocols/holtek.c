@@ -25,6 +25,14 @@ static const SubGhzBlockConst subghz_protocol_holtek_const = {
     .min_count_bit_for_found = 40,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_holtek_wakeup = {
+    .level = false,
+    .te = &subghz_protocol_holtek_const.te_short,
+    .te_count = 36,
+    .te_delta = &subghz_protocol_holtek_const.te_delta,
+    .te_delta_count = 36,
+};
+
 struct SubGhzProtocolDecoderHoltek {
     SubGhzProtocolDecoderBase base;
 
@@ -57,6 +65,10 @@ const SubGhzProtocolDecoder subghz_protocol_holtek_decoder = {
     .serialize = subghz_protocol_decoder_holtek_serialize,
     .deserialize = subghz_protocol_decoder_holtek_deserialize,
     .get_string = subghz_protocol_decoder_holtek_get_string,
+
+    .wakeup = &subghz_protocol_holtek_wakeup,
+    .is_idle = subghz_protocol_decoder_holtek_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_holtek_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_holtek_encoder = {
@@ -212,6 +224,12 @@ void subghz_protocol_decoder_holtek_reset(void* context) {
     instance->decoder.parser_step = HoltekDecoderStepReset;
 }
 
+bool subghz_protocol_decoder_holtek_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHoltek* instance = context;
+    return instance->decoder.parser_step == HoltekDecoderStepReset;
+}
+
 void subghz_protocol_decoder_holtek_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderHoltek* instance = context;
@@ -322,6 +340,13 @@ uint8_t subghz_protocol_decoder_holtek_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_holtek_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHoltek* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_holtek_serialize(
     void* context,
     FlipperFormat* flipper_format,
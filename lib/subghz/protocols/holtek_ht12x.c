@@ -27,6 +27,14 @@ static const SubGhzBlockConst subghz_protocol_holtek_th12x_const = {
     .min_count_bit_for_found = 12,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_holtek_th12x_wakeup = {
+    .level = false,
+    .te = &subghz_protocol_holtek_th12x_const.te_short,
+    .te_count = 36,
+    .te_delta = &subghz_protocol_holtek_th12x_const.te_delta,
+    .te_delta_count = 36,
+};
+
 struct SubGhzProtocolDecoderHoltek_HT12X {
     SubGhzProtocolDecoderBase base;
 
@@ -64,6 +72,10 @@ const SubGhzProtocolDecoder subghz_protocol_holtek_th12x_decoder = {
     .serialize = subghz_protocol_decoder_holtek_th12x_serialize,
     .deserialize = subghz_protocol_decoder_holtek_th12x_deserialize,
     .get_string = subghz_protocol_decoder_holtek_th12x_get_string,
+
+    .wakeup = &subghz_protocol_holtek_th12x_wakeup,
+    .is_idle = subghz_protocol_decoder_holtek_th12x_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_holtek_th12x_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_holtek_th12x_encoder = {
@@ -228,6 +240,12 @@ void subghz_protocol_decoder_holtek_th12x_reset(void* context) {
     instance->decoder.parser_step = Holtek_HT12XDecoderStepReset;
 }
 
+bool subghz_protocol_decoder_holtek_th12x_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHoltek_HT12X* instance = context;
+    return instance->decoder.parser_step == Holtek_HT12XDecoderStepReset;
+}
+
 void subghz_protocol_decoder_holtek_th12x_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderHoltek_HT12X* instance = context;
@@ -329,6 +347,13 @@ uint8_t subghz_protocol_decoder_holtek_th12x_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_holtek_th12x_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHoltek_HT12X* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_holtek_th12x_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -80,6 +80,13 @@ void subghz_protocol_decoder_honeywell_wdb_feed(void* context, bool level, uint3
  */
 uint8_t subghz_protocol_decoder_honeywell_wdb_get_hash_data(void* context);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * @param context Pointer to a SubGhzProtocolDecoderHoneywell_WDB instance
+ * @return hash 64-bit hash sum
+ */
+uint64_t subghz_protocol_decoder_honeywell_wdb_get_hash_data_long(void* context);
+
 /**
  * Serialize data SubGhzProtocolDecoderHoneywell_WDB.
  * @param context Pointer to a SubGhzProtocolDecoderHoneywell_WDB instance
@@ -17,6 +17,14 @@ static const SubGhzBlockConst subghz_protocol_hormann_const = {
     .min_count_bit_for_found = 44,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_hormann_wakeup = {
+    .level = true,
+    .te = &subghz_protocol_hormann_const.te_short,
+    .te_count = 24,
+    .te_delta = &subghz_protocol_hormann_const.te_delta,
+    .te_delta_count = 24,
+};
+
 struct SubGhzProtocolDecoderHormann {
     SubGhzProtocolDecoderBase base;
 
@@ -51,6 +59,10 @@ const SubGhzProtocolDecoder subghz_protocol_hormann_decoder = {
     .serialize = subghz_protocol_decoder_hormann_serialize,
     .deserialize = subghz_protocol_decoder_hormann_deserialize,
     .get_string = subghz_protocol_decoder_hormann_get_string,
+
+    .wakeup = &subghz_protocol_hormann_wakeup,
+    .is_idle = subghz_protocol_decoder_hormann_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_hormann_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_hormann_encoder = {
@@ -214,6 +226,12 @@ void subghz_protocol_decoder_hormann_reset(void* context) {
     instance->decoder.parser_step = HormannDecoderStepReset;
 }
 
+bool subghz_protocol_decoder_hormann_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHormann* instance = context;
+    return instance->decoder.parser_step == HormannDecoderStepReset;
+}
+
 void subghz_protocol_decoder_hormann_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderHormann* instance = context;
@@ -295,6 +313,13 @@ uint8_t subghz_protocol_decoder_hormann_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_hormann_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHormann* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_hormann_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -45,6 +45,13 @@ void subghz_protocol_decoder_ido_feed(void* context, bool level, uint32_t durati
  */
 uint8_t subghz_protocol_decoder_ido_get_hash_data(void* context);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * @param context Pointer to a SubGhzProtocolDecoderIDo instance
+ * @return hash 64-bit hash sum
+ */
+uint64_t subghz_protocol_decoder_ido_get_hash_data_long(void* context);
+
 /**
  * Serialize data SubGhzProtocolDecoderIDo.
  * @param context Pointer to a SubGhzProtocolDecoderIDo instance
@@ -21,6 +21,14 @@ static const SubGhzBlockConst subghz_protocol_intertechno_v3_const = {
     .min_count_bit_for_found = 32,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_intertechno_v3_wakeup = {
+    .level = false,
+    .te = &subghz_protocol_intertechno_v3_const.te_short,
+    .te_count = 37,
+    .te_delta = &subghz_protocol_intertechno_v3_const.te_delta,
+    .te_delta_count = 15,
+};
+
 struct SubGhzProtocolDecoderIntertechno_V3 {
     SubGhzProtocolDecoderBase base;
 
@@ -56,6 +64,10 @@ const SubGhzProtocolDecoder subghz_protocol_intertechno_v3_decoder = {
     .serialize = subghz_protocol_decoder_intertechno_v3_serialize,
     .deserialize = subghz_protocol_decoder_intertechno_v3_deserialize,
     .get_string = subghz_protocol_decoder_intertechno_v3_get_string,
+
+    .wakeup = &subghz_protocol_intertechno_v3_wakeup,
+    .is_idle = subghz_protocol_decoder_intertechno_v3_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_intertechno_v3_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_intertechno_v3_encoder = {
@@ -234,6 +246,12 @@ void subghz_protocol_decoder_intertechno_v3_reset(void* context) {
     instance->decoder.parser_step = IntertechnoV3DecoderStepReset;
 }
 
+bool subghz_protocol_decoder_intertechno_v3_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderIntertechno_V3* instance = context;
+    return instance->decoder.parser_step == IntertechnoV3DecoderStepReset;
+}
+
 void subghz_protocol_decoder_intertechno_v3_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderIntertechno_V3* instance = context;
@@ -406,6 +424,13 @@ uint8_t subghz_protocol_decoder_intertechno_v3_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_intertechno_v3_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderIntertechno_V3* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_intertechno_v3_serialize(
     void* context,
     FlipperFormat* flipper_format,
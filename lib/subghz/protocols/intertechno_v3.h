@@ -66,6 +66,13 @@ void subghz_protocol_decoder_intertechno_v3_free(void* context);
  */
 void subghz_protocol_decoder_intertechno_v3_reset(void* context);
 
+/**
+ * Check that decoder SubGhzProtocolDecoderIntertechno_V3 waits for a frame start.
+ * @param context Pointer to a SubGhzProtocolDecoderIntertechno_V3 instance
+ * @return true if decoder is in reset state
+ */
+bool subghz_protocol_decoder_intertechno_v3_is_idle(void* context);
+
 /**
  * Parse a raw sequence of levels and durations received from the air.
  * @param context Pointer to a SubGhzProtocolDecoderIntertechno_V3 instance
@@ -81,6 +88,13 @@ void subghz_protocol_decoder_intertechno_v3_feed(void* context, bool level, uint
  */
 uint8_t subghz_protocol_decoder_intertechno_v3_get_hash_data(void* context);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * @param context Pointer to a SubGhzProtocolDecoderIntertechno_V3 instance
+ * @return hash 64-bit hash sum
+ */
+uint64_t subghz_protocol_decoder_intertechno_v3_get_hash_data_long(void* context);
+
 /**
  * Serialize data SubGhzProtocolDecoderIntertechno_V3.
  * @param context Pointer to a SubGhzProtocolDecoderIntertechno_V3 instance
@@ -19,6 +19,42 @@ static const SubGhzBlockConst subghz_protocol_keeloq_const = {
     .min_count_bit_for_found = 64,
 };
 
+#define KEELOQ_SEARCH_CHUNK_SIZE (KEELOQ_BATCH_SIZE / 2)
+#define KEELOQ_SEARCH_CANDIDATES_MAX (KEELOQ_SEARCH_CHUNK_SIZE * 8)
+#define KEELOQ_MATCH_CACHE_SIZE 4
+
+typedef struct {
+    size_t index; // in keystore
+    uint64_t key; // to validate index
+    uint8_t learning;
+    bool mirrored;
+    bool centurion;
+} SubGhzKeeloqCandidate;
+
+typedef struct {
+    uint64_t keys[KEELOQ_BATCH_SIZE];
+    uint32_t normal_low[KEELOQ_BATCH_SIZE];
+    uint32_t normal_high[KEELOQ_BATCH_SIZE];
+    uint32_t secure_low[KEELOQ_BATCH_SIZE];
+    uint32_t secure_high[KEELOQ_BATCH_SIZE];
+
+    SubGhzKeeloqCandidate candidates[KEELOQ_SEARCH_CANDIDATES_MAX];
+    uint64_t mans[KEELOQ_SEARCH_CANDIDATES_MAX];
+    size_t candidate_count;
+    uint32_t decrypt[KEELOQ_BATCH_SIZE];
+} SubGhzKeeloqSearch;
+
+typedef struct {
+    uint32_t serial;
+    SubGhzKeeloqCandidate candidate;
+} SubGhzKeeloqMatch;
+
+typedef struct {
+    SubGhzKeeloqMatch items[KEELOQ_MATCH_CACHE_SIZE];
+    size_t count;
+    size_t next;
+} SubGhzKeeloqMatchCache;
+
 struct SubGhzProtocolDecoderKeeloq {
     SubGhzProtocolDecoderBase base;
 
@@ -27,6 +63,7 @@ struct SubGhzProtocolDecoderKeeloq {
 
     uint16_t header_count;
     SubGhzKeystore* keystore;
+    SubGhzKeeloqMatchCache match_cache;
     const char* manufacture_name;
 };
 
@@ -58,6 +95,7 @@ const SubGhzProtocolDecoder subghz_protocol_keeloq_decoder = {
     .serialize = subghz_protocol_decoder_keeloq_serialize,
     .deserialize = subghz_protocol_decoder_keeloq_deserialize,
     .get_string = subghz_protocol_decoder_keeloq_get_string,
+    .get_hash_data_long = subghz_protocol_decoder_keeloq_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_keeloq_encoder = {
@@ -89,6 +127,7 @@ const SubGhzProtocol subghz_protocol_keeloq = {
 static void subghz_protocol_keeloq_check_remote_controller(
     SubGhzBlockGeneric* instance,
     SubGhzKeystore* keystore,
+    SubGhzKeeloqMatchCache* match_cache,
     const char** manufacture_name);
 
 void* subghz_protocol_encoder_keeloq_alloc(SubGhzEnvironment* environment) {
@@ -269,7 +308,7 @@ SubGhzProtocolStatus
             break;
         }
         subghz_protocol_keeloq_check_remote_controller(
-            &instance->generic, instance->keystore, &instance->manufacture_name);
+            &instance->generic, instance->keystore, NULL, &instance->manufacture_name);
 
         if(strcmp(instance->manufacture_name, "DoorHan") != 0) {
             FURI_LOG_E(TAG, "Wrong manufacturer name");
@@ -334,6 +373,8 @@ void* subghz_protocol_decoder_keeloq_alloc(SubGhzEnvironment* environment) {
     instance->base.protocol = &subghz_protocol_keeloq;
     instance->generic.protocol_name = instance->base.protocol->name;
     instance->keystore = subghz_environment_get_keystore(environment);
+    instance->match_cache.count = 0;
+    instance->match_cache.next = 0;
 
     return instance;
 }
@@ -480,180 +521,307 @@ static inline bool subghz_protocol_keeloq_check_decrypt_centurion(
     return false;
 }
 
-/** 
- * Checking the accepted code against the database manafacture key
+/**
+ * Byte-mirrored manufacture key, some vendors store keys reversed
+ * @param key Manufacture key
+ * @return mirrored key
+ */
+static uint64_t subghz_protocol_keeloq_mirror_key(uint64_t key) {
+    uint64_t man_rev = 0;
+    uint64_t man_rev_byte = 0;
+    for(uint8_t i = 0; i < 64; i += 8) {
+        man_rev_byte = (uint8_t)(key >> i);
+        man_rev = man_rev | man_rev_byte << (56 - i);
+    }
+    return man_rev;
+}
+
+/**
+ * Derive manufacture key for this remote with a given learning type
+ * @param fix Fix part of the parcel
+ * @param seed Seed for secure learning
+ * @param key Manufacture key from keystore
+ * @param learning KEELOQ_LEARNING_* type
+ * @return key to decrypt the hop part with
+ */
+static uint64_t subghz_protocol_keeloq_get_man(
+    uint32_t fix,
+    uint32_t seed,
+    uint64_t key,
+    uint8_t learning) {
+    switch(learning) {
+    case KEELOQ_LEARNING_NORMAL:
+        return subghz_protocol_keeloq_common_normal_learning(fix, key);
+    case KEELOQ_LEARNING_SECURE:
+        return subghz_protocol_keeloq_common_secure_learning(fix, seed, key);
+    case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
+        return subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, key);
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
+        return subghz_protocol_keeloq_common_magic_serial_type1_learning(fix, key);
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
+        return subghz_protocol_keeloq_common_magic_serial_type2_learning(fix, key);
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
+        return subghz_protocol_keeloq_common_magic_serial_type3_learning(fix, key);
+    default:
+        return key;
+    }
+}
+
+static inline bool subghz_protocol_keeloq_check_candidate(
+    SubGhzBlockGeneric* instance,
+    const SubGhzKeeloqCandidate* candidate,
+    uint32_t decrypt,
+    uint8_t btn,
+    uint32_t end_serial) {
+    if(candidate->centurion) {
+        return subghz_protocol_keeloq_check_decrypt_centurion(instance, decrypt, btn);
+    } else {
+        return subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial);
+    }
+}
+
+static inline void subghz_protocol_keeloq_search_push(
+    SubGhzKeeloqSearch* search,
+    size_t index,
+    const SubGhzKey* manufacture_code,
+    uint8_t learning,
+    bool mirrored,
+    uint64_t man) {
+    SubGhzKeeloqCandidate* candidate = &search->candidates[search->candidate_count];
+    candidate->index = index;
+    candidate->key = manufacture_code->key;
+    candidate->learning = learning;
+    candidate->mirrored = mirrored;
+    candidate->centurion = false;
+    search->mans[search->candidate_count] = man;
+    search->candidate_count++;
+}
+
+/**
+ * Search keystore for the key of this remote, KEELOQ_BATCH_SIZE decrypts at once.
+ * Candidates are tried in keystore order, for every key in the same order as learning types
+ * were tried one by one, so the first match is the same as with sequential search.
  * @param instance Pointer to a SubGhzBlockGeneric* instance
  * @param fix Fix part of the parcel
  * @param hop Hop encrypted part of the parcel
- * @param keystore Pointer to a SubGhzKeystore* instance
- * @param manufacture_name 
+ * @param seed Seed for secure learning
+ * @param keys Keystore data
+ * @param match Matched candidate
  * @return true on successful search
  */
-static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
+static bool subghz_protocol_keeloq_search_keystore(
     SubGhzBlockGeneric* instance,
     uint32_t fix,
     uint32_t hop,
-    SubGhzKeystore* keystore,
-    const char** manufacture_name) {
+    uint32_t seed,
+    SubGhzKeyArray_t* keys,
+    SubGhzKeeloqCandidate* match) {
     // protocol HCS300 uses 10 bits in discriminator, HCS200 uses 8 bits, for backward compatibility, we are looking for the 8-bit pattern
     // HCS300 -> uint16_t end_serial = (uint16_t)(fix & 0x3FF);
     // HCS200 -> uint16_t end_serial = (uint16_t)(fix & 0xFF);
-
     uint16_t end_serial = (uint16_t)(fix & 0xFF);
     uint8_t btn = (uint8_t)(fix >> 28);
-    uint32_t decrypt = 0;
-    uint64_t man;
-    uint32_t seed = 0;
+    uint32_t serial = fix & 0x0FFFFFFF;
+
+    SubGhzKeeloqSearch* search = malloc(sizeof(SubGhzKeeloqSearch));
+    size_t key_count = SubGhzKeyArray_size(*keys);
+    bool found = false;
+
+    for(size_t chunk = 0; (chunk < key_count) && !found; chunk += KEELOQ_SEARCH_CHUNK_SIZE) {
+        size_t chunk_size = MIN((size_t)KEELOQ_SEARCH_CHUNK_SIZE, key_count - chunk);
+        bool need_learning = false;
+
+        // Lane 2*i holds the key, lane 2*i+1 its mirrored twin
+        for(size_t i = 0; i < chunk_size; i++) {
+            const SubGhzKey* manufacture_code = SubGhzKeyArray_cget(*keys, chunk + i);
+            search->keys[i * 2] = manufacture_code->key;
+            search->keys[i * 2 + 1] = subghz_protocol_keeloq_mirror_key(manufacture_code->key);
+            if(manufacture_code->type == KEELOQ_LEARNING_NORMAL ||
+               manufacture_code->type == KEELOQ_LEARNING_SECURE ||
+               manufacture_code->type == KEELOQ_LEARNING_UNKNOWN) {
+                need_learning = true;
+            }
+        }
 
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            switch(manufacture_code->type) {
+        if(need_learning) {
+            // Normal and secure learning are decrypts of the serial, batch them too
+            // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
+            size_t lanes = chunk_size * 2;
+            subghz_protocol_keeloq_common_decrypt_batch(
+                serial | 0x20000000, search->keys, search->normal_low, lanes);
+            subghz_protocol_keeloq_common_decrypt_batch(
+                serial | 0x60000000, search->keys, search->normal_high, lanes);
+            subghz_protocol_keeloq_common_decrypt_batch(
+                serial, search->keys, search->secure_high, lanes);
+            subghz_protocol_keeloq_common_decrypt_batch(
+                seed, search->keys, search->secure_low, lanes);
+        }
+
+        search->candidate_count = 0;
+        for(size_t i = 0; i < chunk_size; i++) {
+            const SubGhzKey* code = SubGhzKeyArray_cget(*keys, chunk + i);
+            size_t index = chunk + i;
+            size_t lane = i * 2;
+            uint64_t normal = ((uint64_t)search->normal_high[lane] << 32) |
+                              search->normal_low[lane];
+            uint64_t normal_rev = ((uint64_t)search->normal_high[lane + 1] << 32) |
+                                  search->normal_low[lane + 1];
+            uint64_t secure = ((uint64_t)search->secure_high[lane] << 32) |
+                              search->secure_low[lane];
+            uint64_t secure_rev = ((uint64_t)search->secure_high[lane + 1] << 32) |
+                                  search->secure_low[lane + 1];
+
+            switch(code->type) {
             case KEELOQ_LEARNING_SIMPLE:
-                // Simple Learning
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+                subghz_protocol_keeloq_search_push(
+                    search, index, code, KEELOQ_LEARNING_SIMPLE, false, code->key);
                 break;
             case KEELOQ_LEARNING_NORMAL:
-                // Normal Learning
-                // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                man = subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if((strcmp(furi_string_get_cstr(manufacture_code->name), "Centurion") == 0)) {
-                    if(subghz_protocol_keeloq_check_decrypt_centurion(instance, decrypt, btn)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        return 1;
-                    }
-                } else {
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        return 1;
-                    }
+                subghz_protocol_keeloq_search_push(
+                    search, index, code, KEELOQ_LEARNING_NORMAL, false, normal);
+                if(strcmp(furi_string_get_cstr(code->name), "Centurion") == 0) {
+                    search->candidates[search->candidate_count - 1].centurion = true;
                 }
                 break;
             case KEELOQ_LEARNING_SECURE:
-                man = subghz_protocol_keeloq_common_secure_learning(
-                    fix, seed, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+                subghz_protocol_keeloq_search_push(
+                    search, index, code, KEELOQ_LEARNING_SECURE, false, secure);
                 break;
             case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
-                man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
             case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
-                man = subghz_protocol_keeloq_common_magic_serial_type1_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
             case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
-                man = subghz_protocol_keeloq_common_magic_serial_type2_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
             case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
-                man = subghz_protocol_keeloq_common_magic_serial_type3_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+                subghz_protocol_keeloq_search_push(
+                    search,
+                    index,
+                    code,
+                    code->type,
+                    false,
+                    subghz_protocol_keeloq_get_man(fix, seed, code->key, code->type));
                 break;
             case KEELOQ_LEARNING_UNKNOWN:
-                // Simple Learning
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-
-                // Check for mirrored man
-                uint64_t man_rev = 0;
-                uint64_t man_rev_byte = 0;
-                for(uint8_t i = 0; i < 64; i += 8) {
-                    man_rev_byte = (uint8_t)(manufacture_code->key >> i);
-                    man_rev = man_rev | man_rev_byte << (56 - i);
-                }
+                // Every learning type is tried, each also with mirrored man
+                subghz_protocol_keeloq_search_push(
+                    search, index, code, KEELOQ_LEARNING_SIMPLE, false, search->keys[lane]);
+                subghz_protocol_keeloq_search_push(
+                    search, index, code, KEELOQ_LEARNING_SIMPLE, true, search->keys[lane + 1]);
+                subghz_protocol_keeloq_search_push(
+                    search, index, code, KEELOQ_LEARNING_NORMAL, false, normal);
+                subghz_protocol_keeloq_search_push(
+                    search, index, code, KEELOQ_LEARNING_NORMAL, true, normal_rev);
+                subghz_protocol_keeloq_search_push(
+                    search, index, code, KEELOQ_LEARNING_SECURE, false, secure);
+                subghz_protocol_keeloq_search_push(
+                    search, index, code, KEELOQ_LEARNING_SECURE, true, secure_rev);
+                subghz_protocol_keeloq_search_push(
+                    search,
+                    index,
+                    code,
+                    KEELOQ_LEARNING_MAGIC_XOR_TYPE_1,
+                    false,
+                    subghz_protocol_keeloq_common_magic_xor_type1_learning(
+                        fix, search->keys[lane]));
+                subghz_protocol_keeloq_search_push(
+                    search,
+                    index,
+                    code,
+                    KEELOQ_LEARNING_MAGIC_XOR_TYPE_1,
+                    true,
+                    subghz_protocol_keeloq_common_magic_xor_type1_learning(
+                        fix, search->keys[lane + 1]));
+                break;
+            }
+        }
 
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
+        for(size_t batch = 0; (batch < search->candidate_count) && !found;
+            batch += KEELOQ_BATCH_SIZE) {
+            size_t batch_size = MIN((size_t)KEELOQ_BATCH_SIZE, search->candidate_count - batch);
+            subghz_protocol_keeloq_common_decrypt_batch(
+                hop, &search->mans[batch], search->decrypt, batch_size);
+
+            for(size_t i = 0; i < batch_size; i++) {
+                const SubGhzKeeloqCandidate* candidate = &search->candidates[batch + i];
+                if(subghz_protocol_keeloq_check_candidate(
+                       instance, candidate, search->decrypt[i], btn, end_serial)) {
+                    *match = *candidate;
+                    found = true;
+                    break;
                 }
+            }
+        }
+    }
 
-                //###########################
-                // Normal Learning
-                // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                man = subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+    free(search);
+    return found;
+}
 
-                // Check for mirrored man
-                man = subghz_protocol_keeloq_common_normal_learning(fix, man_rev);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+/** 
+ * Checking the accepted code against the database manafacture key
+ * @param instance Pointer to a SubGhzBlockGeneric* instance
+ * @param fix Fix part of the parcel
+ * @param hop Hop encrypted part of the parcel
+ * @param keystore Pointer to a SubGhzKeystore* instance
+ * @param match_cache Pointer to a SubGhzKeeloqMatchCache instance, can be NULL
+ * @param manufacture_name 
+ * @return true on successful search
+ */
+static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
+    SubGhzBlockGeneric* instance,
+    uint32_t fix,
+    uint32_t hop,
+    SubGhzKeystore* keystore,
+    SubGhzKeeloqMatchCache* match_cache,
+    const char** manufacture_name) {
+    SubGhzKeyArray_t* keys = subghz_keystore_get_data(keystore);
+    uint16_t end_serial = (uint16_t)(fix & 0xFF);
+    uint8_t btn = (uint8_t)(fix >> 28);
+    uint32_t serial = fix & 0x0FFFFFFF;
+    uint32_t seed = 0;
 
-                // Secure Learning
-                man = subghz_protocol_keeloq_common_secure_learning(
-                    fix, seed, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+    SubGhzKeeloqMatch* cached = NULL;
+    if(match_cache) {
+        for(size_t i = 0; i < match_cache->count; i++) {
+            if(match_cache->items[i].serial == serial) {
+                cached = &match_cache->items[i];
+                break;
+            }
+        }
+    }
 
-                // Check for mirrored man
-                man = subghz_protocol_keeloq_common_secure_learning(fix, seed, man_rev);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+    // Repeated presses of a known remote skip the keystore search
+    if(cached && (cached->candidate.index < SubGhzKeyArray_size(*keys))) {
+        const SubGhzKeeloqCandidate* candidate = &cached->candidate;
+        const SubGhzKey* manufacture_code = SubGhzKeyArray_cget(*keys, candidate->index);
+        if(manufacture_code->key == candidate->key) {
+            uint64_t key = candidate->mirrored ?
+                               subghz_protocol_keeloq_mirror_key(manufacture_code->key) :
+                               manufacture_code->key;
+            uint64_t man = subghz_protocol_keeloq_get_man(fix, seed, key, candidate->learning);
+            uint32_t decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+            if(subghz_protocol_keeloq_check_candidate(
+                   instance, candidate, decrypt, btn, end_serial)) {
+                *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+                return 1;
+            }
+        }
+    }
 
-                // Magic xor type1 learning
-                man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+    SubGhzKeeloqCandidate match;
+    if(subghz_protocol_keeloq_search_keystore(instance, fix, hop, seed, keys, &match)) {
+        *manufacture_name =
+            furi_string_get_cstr(SubGhzKeyArray_cget(*keys, match.index)->name);
 
-                // Check for mirrored man
-                man = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, man_rev);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
+        if(match_cache) {
+            if(!cached) {
+                cached = &match_cache->items[match_cache->next];
+                match_cache->next = (match_cache->next + 1) % KEELOQ_MATCH_CACHE_SIZE;
+                if(match_cache->count < KEELOQ_MATCH_CACHE_SIZE) match_cache->count++;
             }
+            cached->serial = serial;
+            cached->candidate = match;
         }
+        return 1;
+    }
 
     *manufacture_name = "Unknown";
     instance->cnt = 0;
@@ -664,6 +832,7 @@ static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
 static void subghz_protocol_keeloq_check_remote_controller(
     SubGhzBlockGeneric* instance,
     SubGhzKeystore* keystore,
+    SubGhzKeeloqMatchCache* match_cache,
     const char** manufacture_name) {
     uint64_t key = subghz_protocol_blocks_reverse_key(instance->data, instance->data_count_bit);
     uint32_t key_fix = key >> 32;
@@ -678,7 +847,7 @@ static void subghz_protocol_keeloq_check_remote_controller(
         instance->cnt = key_hop >> 16;
     } else {
         subghz_protocol_keeloq_check_remote_controller_selector(
-            instance, key_fix, key_hop, keystore, manufacture_name);
+            instance, key_fix, key_hop, keystore, match_cache, manufacture_name);
     }
 
     instance->serial = key_fix & 0x0FFFFFFF;
@@ -692,6 +861,13 @@ uint8_t subghz_protocol_decoder_keeloq_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_keeloq_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderKeeloq* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_keeloq_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -699,7 +875,10 @@ SubGhzProtocolStatus subghz_protocol_decoder_keeloq_serialize(
     furi_assert(context);
     SubGhzProtocolDecoderKeeloq* instance = context;
     subghz_protocol_keeloq_check_remote_controller(
-        &instance->generic, instance->keystore, &instance->manufacture_name);
+        &instance->generic,
+        instance->keystore,
+        &instance->match_cache,
+        &instance->manufacture_name);
 
     SubGhzProtocolStatus res =
         subghz_block_generic_serialize(&instance->generic, flipper_format, preset);
@@ -725,7 +904,10 @@ void subghz_protocol_decoder_keeloq_get_string(void* context, FuriString* output
     furi_assert(context);
     SubGhzProtocolDecoderKeeloq* instance = context;
     subghz_protocol_keeloq_check_remote_controller(
-        &instance->generic, instance->keystore, &instance->manufacture_name);
+        &instance->generic,
+        instance->keystore,
+        &instance->match_cache,
+        &instance->manufacture_name);
 
     uint32_t code_found_hi = instance->generic.data >> 32;
     uint32_t code_found_lo = instance->generic.data & 0x00000000ffffffff;
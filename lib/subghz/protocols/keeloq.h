@@ -81,6 +81,13 @@ void subghz_protocol_decoder_keeloq_feed(void* context, bool level, uint32_t dur
  */
 uint8_t subghz_protocol_decoder_keeloq_get_hash_data(void* context);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * @param context Pointer to a SubGhzProtocolDecoderKeeloq instance
+ * @return hash 64-bit hash sum
+ */
+uint64_t subghz_protocol_decoder_keeloq_get_hash_data_long(void* context);
+
 /**
  * Serialize data SubGhzProtocolDecoderKeeloq.
  * @param context Pointer to a SubGhzProtocolDecoderKeeloq instance
@@ -3,6 +3,7 @@
 #include <furi.h>
 
 #include <m-array.h>
+#include <string.h>
 
 #define bit(x, n) (((x) >> (n)) & 1)
 #define g5(x, a, b, c, d, e) \
@@ -35,6 +36,76 @@ inline uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const
     return x;
 }
 
+/** Transpose 32x32 bit matrix in place
+ * @param matrix - 32 words, bit j of word i is swapped with bit i of word j
+ */
+static void subghz_protocol_keeloq_common_transpose32(uint32_t* matrix) {
+    uint32_t mask = 0x0000FFFF;
+    for(size_t width = 16; width != 0; width >>= 1, mask ^= mask << width) {
+        for(size_t i = 0; i < 32; i = (i + width + 1) & ~width) {
+            uint32_t swap = ((matrix[i] >> width) ^ matrix[i + width]) & mask;
+            matrix[i] ^= swap << width;
+            matrix[i + width] ^= swap;
+        }
+    }
+}
+
+/** Batch Simple Learning Decrypt
+ * @param data - keeloq encrypt data, same for all keys
+ * @param keys - manufacture keys (64bit)
+ * @param decrypt - decrypted data for every key
+ * @param count - number of keys, KEELOQ_BATCH_SIZE max
+ */
+void subghz_protocol_keeloq_common_decrypt_batch(
+    const uint32_t data,
+    const uint64_t* keys,
+    uint32_t* decrypt,
+    size_t count) {
+    furi_assert(count <= KEELOQ_BATCH_SIZE);
+    uint32_t key_slices[64];
+    uint32_t state[32];
+
+    // Bit b of every key goes to key_slices[b], one lane per key
+    memset(key_slices, 0, sizeof(key_slices));
+    for(size_t i = 0; i < count; i++) {
+        key_slices[i] = (uint32_t)keys[i];
+        key_slices[32 + i] = (uint32_t)(keys[i] >> 32);
+    }
+    subghz_protocol_keeloq_common_transpose32(&key_slices[0]);
+    subghz_protocol_keeloq_common_transpose32(&key_slices[32]);
+
+    // Same ciphertext in every lane
+    for(size_t i = 0; i < 32; i++) {
+        state[i] = bit(data, i) ? 0xFFFFFFFF : 0;
+    }
+
+    // State is a ring: logical bit j lives in state[(j + offset) & 31],
+    // so the per-round shift is an offset decrement instead of 32 moves
+    size_t offset = 0;
+#define KEELOQ_SLICE(n) state[((n) + offset) & 31]
+    for(uint32_t r = 0; r < 528; r++) {
+        uint32_t a = KEELOQ_SLICE(0);
+        uint32_t b = KEELOQ_SLICE(8);
+        uint32_t c = KEELOQ_SLICE(19);
+        uint32_t d = KEELOQ_SLICE(25);
+        uint32_t e = KEELOQ_SLICE(30);
+        // Algebraic normal form of KEELOQ_NLF
+        uint32_t nlf = (a | b) ^ (b & c) ^ (d & (a ^ c)) ^
+                       (e & ((a & ~b) ^ (c & ~a) ^ (d & (b ^ c))));
+        KEELOQ_SLICE(31) ^= KEELOQ_SLICE(15) ^ key_slices[(15 - r) & 63] ^ nlf;
+        offset = (offset + 31) & 31;
+    }
+#undef KEELOQ_SLICE
+
+    // Rotate logical bit 0 back to state[0] and turn lanes back into words
+    uint32_t slices[32];
+    for(size_t i = 0; i < 32; i++) {
+        slices[i] = state[(i + offset) & 31];
+    }
+    subghz_protocol_keeloq_common_transpose32(slices);
+    memcpy(decrypt, slices, sizeof(uint32_t) * count);
+}
+
 /** Normal Learning
  * @param data - serial number (28bit)
  * @param key - manufacture (64bit)
@@ -25,6 +25,11 @@
 #define KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2 6u
 #define KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3 7u
 
+/*
+ * Number of keys tested at once by batch decrypt, one per bit of uint32_t
+ */
+#define KEELOQ_BATCH_SIZE 32
+
 /**
  * Simple Learning Encrypt
  * @param data - 0xBSSSCCCC, B(4bit) key, S(10bit) serial&0x3FF, C(16bit) counter
@@ -41,6 +46,19 @@ uint32_t subghz_protocol_keeloq_common_encrypt(const uint32_t data, const uint64
  */
 uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const uint64_t key);
 
+/** 
+ * Batch Simple Learning Decrypt, bitsliced: lane N of every state word belongs to keys[N]
+ * @param data - keeloq encrypt data, same for all keys
+ * @param keys - manufacture keys (64bit)
+ * @param decrypt - decrypted data for every key, 0xBSSSCCCC
+ * @param count - number of keys, KEELOQ_BATCH_SIZE max
+ */
+void subghz_protocol_keeloq_common_decrypt_batch(
+    const uint32_t data,
+    const uint64_t* keys,
+    uint32_t* decrypt,
+    size_t count);
+
 /** 
  * Normal Learning
  * @param data - serial number (28bit)
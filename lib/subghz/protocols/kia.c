@@ -49,6 +49,7 @@ const SubGhzProtocolDecoder subghz_protocol_kia_decoder = {
     .serialize = subghz_protocol_decoder_kia_serialize,
     .deserialize = subghz_protocol_decoder_kia_deserialize,
     .get_string = subghz_protocol_decoder_kia_get_string,
+    .get_hash_data_long = subghz_protocol_decoder_kia_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_kia_encoder = {
@@ -230,6 +231,13 @@ uint8_t subghz_protocol_decoder_kia_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_kia_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderKIA* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_kia_serialize(
     void* context,
     FlipperFormat* flipper_format,
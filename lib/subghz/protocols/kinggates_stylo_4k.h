@@ -44,6 +44,13 @@ void subghz_protocol_decoder_kinggates_stylo_4k_feed(void* context, bool level,
  */
 uint8_t subghz_protocol_decoder_kinggates_stylo_4k_get_hash_data(void* context);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * @param context Pointer to a SubGhzProtocolDecoderKingGates_stylo_4k instance
+ * @return hash 64-bit hash sum
+ */
+uint64_t subghz_protocol_decoder_kinggates_stylo_4k_get_hash_data_long(void* context);
+
 /**
  * Serialize data SubGhzProtocolDecoderKingGates_stylo_4k.
  * @param context Pointer to a SubGhzProtocolDecoderKingGates_stylo_4k instance
@@ -22,6 +22,14 @@ static const SubGhzBlockConst subghz_protocol_linear_const = {
     .min_count_bit_for_found = 10,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_linear_wakeup = {
+    .level = false,
+    .te = &subghz_protocol_linear_const.te_short,
+    .te_count = 42,
+    .te_delta = &subghz_protocol_linear_const.te_delta,
+    .te_delta_count = 20,
+};
+
 struct SubGhzProtocolDecoderLinear {
     SubGhzProtocolDecoderBase base;
 
@@ -53,6 +61,10 @@ const SubGhzProtocolDecoder subghz_protocol_linear_decoder = {
     .serialize = subghz_protocol_decoder_linear_serialize,
     .deserialize = subghz_protocol_decoder_linear_deserialize,
     .get_string = subghz_protocol_decoder_linear_get_string,
+
+    .wakeup = &subghz_protocol_linear_wakeup,
+    .is_idle = subghz_protocol_decoder_linear_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_linear_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_linear_encoder = {
@@ -217,6 +229,12 @@ void subghz_protocol_decoder_linear_reset(void* context) {
     instance->decoder.parser_step = LinearDecoderStepReset;
 }
 
+bool subghz_protocol_decoder_linear_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderLinear* instance = context;
+    return instance->decoder.parser_step == LinearDecoderStepReset;
+}
+
 void subghz_protocol_decoder_linear_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderLinear* instance = context;
@@ -300,6 +318,13 @@ uint8_t subghz_protocol_decoder_linear_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_linear_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderLinear* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_linear_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -21,6 +21,14 @@ static const SubGhzBlockConst subghz_protocol_linear_delta3_const = {
     .min_count_bit_for_found = 8,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_linear_delta3_wakeup = {
+    .level = false,
+    .te = &subghz_protocol_linear_delta3_const.te_short,
+    .te_count = 70,
+    .te_delta = &subghz_protocol_linear_delta3_const.te_delta,
+    .te_delta_count = 24,
+};
+
 struct SubGhzProtocolDecoderLinearDelta3 {
     SubGhzProtocolDecoderBase base;
 
@@ -54,6 +62,10 @@ const SubGhzProtocolDecoder subghz_protocol_linear_delta3_decoder = {
     .serialize = subghz_protocol_decoder_linear_delta3_serialize,
     .deserialize = subghz_protocol_decoder_linear_delta3_deserialize,
     .get_string = subghz_protocol_decoder_linear_delta3_get_string,
+
+    .wakeup = &subghz_protocol_linear_delta3_wakeup,
+    .is_idle = subghz_protocol_decoder_linear_delta3_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_linear_delta3_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_linear_delta3_encoder = {
@@ -223,6 +235,12 @@ void subghz_protocol_decoder_linear_delta3_reset(void* context) {
     instance->last_data = 0;
 }
 
+bool subghz_protocol_decoder_linear_delta3_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderLinearDelta3* instance = context;
+    return instance->decoder.parser_step == LinearDecoderStepReset;
+}
+
 void subghz_protocol_decoder_linear_delta3_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderLinearDelta3* instance = context;
@@ -311,6 +329,13 @@ uint8_t subghz_protocol_decoder_linear_delta3_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8));
 }
 
+uint64_t subghz_protocol_decoder_linear_delta3_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderLinearDelta3* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8));
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_linear_delta3_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -80,6 +80,13 @@ void subghz_protocol_decoder_magellan_feed(void* context, bool level, uint32_t d
  */
 uint8_t subghz_protocol_decoder_magellan_get_hash_data(void* context);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * @param context Pointer to a SubGhzProtocolDecoderMagellan instance
+ * @return hash 64-bit hash sum
+ */
+uint64_t subghz_protocol_decoder_magellan_get_hash_data_long(void* context);
+
 /**
  * Serialize data SubGhzProtocolDecoderMagellan.
  * @param context Pointer to a SubGhzProtocolDecoderMagellan instance
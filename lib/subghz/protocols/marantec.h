@@ -80,6 +80,13 @@ void subghz_protocol_decoder_marantec_feed(void* context, bool level, uint32_t d
  */
 uint8_t subghz_protocol_decoder_marantec_get_hash_data(void* context);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * @param context Pointer to a SubGhzProtocolDecoderMarantec instance
+ * @return hash 64-bit hash sum
+ */
+uint64_t subghz_protocol_decoder_marantec_get_hash_data_long(void* context);
+
 /**
  * Serialize data SubGhzProtocolDecoderMarantec.
  * @param context Pointer to a SubGhzProtocolDecoderMarantec instance
@@ -26,6 +26,14 @@ static const SubGhzBlockConst subghz_protocol_megacode_const = {
     .min_count_bit_for_found = 24,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_megacode_wakeup = {
+    .level = false,
+    .te = &subghz_protocol_megacode_const.te_short,
+    .te_count = 13,
+    .te_delta = &subghz_protocol_megacode_const.te_delta,
+    .te_delta_count = 17,
+};
+
 struct SubGhzProtocolDecoderMegaCode {
     SubGhzProtocolDecoderBase base;
 
@@ -59,6 +67,10 @@ const SubGhzProtocolDecoder subghz_protocol_megacode_decoder = {
     .serialize = subghz_protocol_decoder_megacode_serialize,
     .deserialize = subghz_protocol_decoder_megacode_deserialize,
     .get_string = subghz_protocol_decoder_megacode_get_string,
+
+    .wakeup = &subghz_protocol_megacode_wakeup,
+    .is_idle = subghz_protocol_decoder_megacode_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_megacode_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_megacode_encoder = {
@@ -245,6 +257,12 @@ void subghz_protocol_decoder_megacode_reset(void* context) {
     instance->decoder.parser_step = MegaCodeDecoderStepReset;
 }
 
+bool subghz_protocol_decoder_megacode_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderMegaCode* instance = context;
+    return instance->decoder.parser_step == MegaCodeDecoderStepReset;
+}
+
 void subghz_protocol_decoder_megacode_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderMegaCode* instance = context;
@@ -381,6 +399,13 @@ uint8_t subghz_protocol_decoder_megacode_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_megacode_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderMegaCode* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_megacode_serialize(
     void* context,
     FlipperFormat* flipper_format,
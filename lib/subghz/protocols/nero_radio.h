@@ -80,6 +80,13 @@ void subghz_protocol_decoder_nero_radio_feed(void* context, bool level, uint32_t
  */
 uint8_t subghz_protocol_decoder_nero_radio_get_hash_data(void* context);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * @param context Pointer to a SubGhzProtocolDecoderNeroRadio instance
+ * @return hash 64-bit hash sum
+ */
+uint64_t subghz_protocol_decoder_nero_radio_get_hash_data_long(void* context);
+
 /**
  * Serialize data SubGhzProtocolDecoderNeroRadio.
  * @param context Pointer to a SubGhzProtocolDecoderNeroRadio instance
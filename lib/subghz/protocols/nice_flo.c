@@ -14,6 +14,14 @@ static const SubGhzBlockConst subghz_protocol_nice_flo_const = {
     .min_count_bit_for_found = 12,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_nice_flo_wakeup = {
+    .level = false,
+    .te = &subghz_protocol_nice_flo_const.te_short,
+    .te_count = 36,
+    .te_delta = &subghz_protocol_nice_flo_const.te_delta,
+    .te_delta_count = 36,
+};
+
 struct SubGhzProtocolDecoderNiceFlo {
     SubGhzProtocolDecoderBase base;
 
@@ -24,7 +32,7 @@ struct SubGhzProtocolDecoderNiceFlo {
 struct SubGhzProtocolEncoderNiceFlo {
     SubGhzProtocolEncoderBase base;
 
-    SubGhzProtocolBlockEncoder encoder;
+    SubGhzProtocolBlockGenerator generator;
     SubGhzBlockGeneric generic;
 };
 
@@ -46,6 +54,10 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flo_decoder = {
     .serialize = subghz_protocol_decoder_nice_flo_serialize,
     .deserialize = subghz_protocol_decoder_nice_flo_deserialize,
     .get_string = subghz_protocol_decoder_nice_flo_get_string,
+
+    .wakeup = &subghz_protocol_nice_flo_wakeup,
+    .is_idle = subghz_protocol_decoder_nice_flo_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_nice_flo_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nice_flo_encoder = {
@@ -75,17 +87,14 @@ void* subghz_protocol_encoder_nice_flo_alloc(SubGhzEnvironment* environment) {
     instance->base.protocol = &subghz_protocol_nice_flo;
     instance->generic.protocol_name = instance->base.protocol->name;
 
-    instance->encoder.repeat = 10;
-    instance->encoder.size_upload = 52; //max 24bit*2 + 2 (start, stop)
-    instance->encoder.upload = malloc(instance->encoder.size_upload * sizeof(LevelDuration));
-    instance->encoder.is_running = false;
+    instance->generator.repeat = 10;
+    instance->generator.is_running = false;
     return instance;
 }
 
 void subghz_protocol_encoder_nice_flo_free(void* context) {
     furi_assert(context);
     SubGhzProtocolEncoderNiceFlo* instance = context;
-    free(instance->encoder.upload);
     free(instance);
 }
 
@@ -96,37 +105,28 @@ void subghz_protocol_encoder_nice_flo_free(void* context) {
  */
 static bool subghz_protocol_encoder_nice_flo_get_upload(SubGhzProtocolEncoderNiceFlo* instance) {
     furi_assert(instance);
-    size_t index = 0;
-    size_t size_upload = (instance->generic.data_count_bit * 2) + 2;
-    if(size_upload > instance->encoder.size_upload) {
-        FURI_LOG_E(TAG, "Size upload exceeds allocated encoder buffer.");
-        return false;
-    } else {
-        instance->encoder.size_upload = size_upload;
-    }
+    SubGhzProtocolBlockGenerator* generator = &instance->generator;
+    const uint32_t te_short = subghz_protocol_nice_flo_const.te_short;
+    const uint32_t te_long = subghz_protocol_nice_flo_const.te_long;
+
+    subghz_protocol_blocks_generator_reset(generator);
     //Send header
-    instance->encoder.upload[index++] =
-        level_duration_make(false, (uint32_t)subghz_protocol_nice_flo_const.te_short * 36);
+    subghz_protocol_blocks_generator_add_header(
+        generator, level_duration_make(false, te_short * 36));
     //Send start bit
-    instance->encoder.upload[index++] =
-        level_duration_make(true, (uint32_t)subghz_protocol_nice_flo_const.te_short);
+    subghz_protocol_blocks_generator_add_header(generator, level_duration_make(true, te_short));
     //Send key data
-    for(uint8_t i = instance->generic.data_count_bit; i > 0; i--) {
-        if(bit_read(instance->generic.data, i - 1)) {
-            //send bit 1
-            instance->encoder.upload[index++] =
-                level_duration_make(false, (uint32_t)subghz_protocol_nice_flo_const.te_long);
-            instance->encoder.upload[index++] =
-                level_duration_make(true, (uint32_t)subghz_protocol_nice_flo_const.te_short);
-        } else {
-            //send bit 0
-            instance->encoder.upload[index++] =
-                level_duration_make(false, (uint32_t)subghz_protocol_nice_flo_const.te_short);
-            instance->encoder.upload[index++] =
-                level_duration_make(true, (uint32_t)subghz_protocol_nice_flo_const.te_long);
-        }
-    }
-    return true;
+    subghz_protocol_blocks_generator_set_data(
+        generator, instance->generic.data, instance->generic.data_count_bit);
+    subghz_protocol_blocks_generator_set_bit(
+        generator, true, level_duration_make(false, te_long), level_duration_make(true, te_short));
+    subghz_protocol_blocks_generator_set_bit(
+        generator,
+        false,
+        level_duration_make(false, te_short),
+        level_duration_make(true, te_long));
+
+    return subghz_protocol_blocks_generator_start(generator);
 }
 
 SubGhzProtocolStatus
@@ -149,13 +149,12 @@ SubGhzProtocolStatus
         }
         //optional parameter parameter
         flipper_format_read_uint32(
-            flipper_format, "Repeat", (uint32_t*)&instance->encoder.repeat, 1);
+            flipper_format, "Repeat", (uint32_t*)&instance->generator.repeat, 1);
 
         if(!subghz_protocol_encoder_nice_flo_get_upload(instance)) {
             ret = SubGhzProtocolStatusErrorEncoderGetUpload;
             break;
         }
-        instance->encoder.is_running = true;
     } while(false);
 
     return ret;
@@ -163,25 +162,12 @@ SubGhzProtocolStatus
 
 void subghz_protocol_encoder_nice_flo_stop(void* context) {
     SubGhzProtocolEncoderNiceFlo* instance = context;
-    instance->encoder.is_running = false;
+    instance->generator.is_running = false;
 }
 
 LevelDuration subghz_protocol_encoder_nice_flo_yield(void* context) {
     SubGhzProtocolEncoderNiceFlo* instance = context;
-
-    if(instance->encoder.repeat == 0 || !instance->encoder.is_running) {
-        instance->encoder.is_running = false;
-        return level_duration_reset();
-    }
-
-    LevelDuration ret = instance->encoder.upload[instance->encoder.front];
-
-    if(++instance->encoder.front == instance->encoder.size_upload) {
-        instance->encoder.repeat--;
-        instance->encoder.front = 0;
-    }
-
-    return ret;
+    return subghz_protocol_blocks_generator_yield(&instance->generator);
 }
 
 void* subghz_protocol_decoder_nice_flo_alloc(SubGhzEnvironment* environment) {
@@ -204,6 +190,12 @@ void subghz_protocol_decoder_nice_flo_reset(void* context) {
     instance->decoder.parser_step = NiceFloDecoderStepReset;
 }
 
+bool subghz_protocol_decoder_nice_flo_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNiceFlo* instance = context;
+    return instance->decoder.parser_step == NiceFloDecoderStepReset;
+}
+
 void subghz_protocol_decoder_nice_flo_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderNiceFlo* instance = context;
@@ -283,6 +275,13 @@ uint8_t subghz_protocol_decoder_nice_flo_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_nice_flo_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNiceFlo* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_nice_flo_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -31,6 +31,7 @@ struct SubGhzProtocolDecoderNiceFlorS {
     SubGhzBlockGeneric generic;
 
     const char* nice_flor_s_rainbow_table_file_name;
+    SubGhzKeystoreRawReader* nice_flor_s_rainbow_table;
     uint64_t data;
 };
 
@@ -60,6 +61,7 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flor_s_decoder = {
     .serialize = subghz_protocol_decoder_nice_flor_s_serialize,
     .deserialize = subghz_protocol_decoder_nice_flor_s_deserialize,
     .get_string = subghz_protocol_decoder_nice_flor_s_get_string,
+    .get_hash_data_long = subghz_protocol_decoder_nice_flor_s_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nice_flor_s_encoder = {
@@ -141,16 +143,17 @@ const SubGhzProtocol subghz_protocol_nice_flor_s = {
 
 /** 
  * Read bytes from rainbow table
- * @param file_name Full path to rainbow table the file 
+ * @param rainbow_table Pointer to a SubGhzKeystoreRawReader instance
  * @param address Byte address in file
  * @return data
  */
-static uint8_t
-    subghz_protocol_nice_flor_s_get_byte_in_file(const char* file_name, uint32_t address) {
-    if(!file_name) return 0;
+static uint8_t subghz_protocol_nice_flor_s_get_byte_in_file(
+    SubGhzKeystoreRawReader* rainbow_table,
+    uint32_t address) {
+    if(!rainbow_table) return 0;
 
     uint8_t buffer[1] = {0};
-    if(subghz_keystore_raw_get_data(file_name, address, buffer, sizeof(uint8_t))) {
+    if(subghz_keystore_raw_reader_get_data(rainbow_table, address, buffer, sizeof(uint8_t))) {
         return buffer[0];
     } else {
         return 0;
@@ -165,15 +168,17 @@ static inline void subghz_protocol_decoder_nice_flor_s_magic_xor(uint8_t* p, uin
 
 uint64_t subghz_protocol_nice_flor_s_encrypt(uint64_t data, const char* file_name) {
     uint8_t* p = (uint8_t*)&data;
+    SubGhzKeystoreRawReader* rainbow_table = NULL;
+    if(file_name) rainbow_table = subghz_keystore_raw_reader_alloc(file_name);
 
     uint8_t k = 0;
     for(uint8_t y = 0; y < 2; y++) {
-        k = subghz_protocol_nice_flor_s_get_byte_in_file(file_name, p[0] & 0x1f);
+        k = subghz_protocol_nice_flor_s_get_byte_in_file(rainbow_table, p[0] & 0x1f);
         subghz_protocol_decoder_nice_flor_s_magic_xor(p, k);
 
         p[5] &= 0x0f;
         p[0] ^= k & 0xe0;
-        k = subghz_protocol_nice_flor_s_get_byte_in_file(file_name, p[0] >> 3) + 0x25;
+        k = subghz_protocol_nice_flor_s_get_byte_in_file(rainbow_table, p[0] >> 3) + 0x25;
         subghz_protocol_decoder_nice_flor_s_magic_xor(p, k);
 
         p[5] &= 0x0f;
@@ -194,11 +199,13 @@ uint64_t subghz_protocol_nice_flor_s_encrypt(uint64_t data, const char* file_nam
     p[3] = ~p[1];
     p[1] = k;
 
+    if(rainbow_table) subghz_keystore_raw_reader_free(rainbow_table);
     return data;
 }
 
-static uint64_t
-    subghz_protocol_nice_flor_s_decrypt(SubGhzBlockGeneric* instance, const char* file_name) {
+static uint64_t subghz_protocol_nice_flor_s_decrypt(
+    SubGhzBlockGeneric* instance,
+    SubGhzKeystoreRawReader* rainbow_table) {
     furi_assert(instance);
     uint64_t data = instance->data;
     uint8_t* p = (uint8_t*)&data;
@@ -215,12 +222,12 @@ static uint64_t
     p[1] = k;
 
     for(uint8_t y = 0; y < 2; y++) {
-        k = subghz_protocol_nice_flor_s_get_byte_in_file(file_name, p[0] >> 3) + 0x25;
+        k = subghz_protocol_nice_flor_s_get_byte_in_file(rainbow_table, p[0] >> 3) + 0x25;
         subghz_protocol_decoder_nice_flor_s_magic_xor(p, k);
 
         p[5] &= 0x0f;
         p[0] ^= k & 0x7;
-        k = subghz_protocol_nice_flor_s_get_byte_in_file(file_name, p[0] & 0x1f);
+        k = subghz_protocol_nice_flor_s_get_byte_in_file(rainbow_table, p[0] & 0x1f);
         subghz_protocol_decoder_nice_flor_s_magic_xor(p, k);
 
         p[5] &= 0x0f;
@@ -244,6 +251,8 @@ void* subghz_protocol_decoder_nice_flor_s_alloc(SubGhzEnvironment* environment)
     if(instance->nice_flor_s_rainbow_table_file_name) {
         FURI_LOG_I(
             TAG, "Loading rainbow table from %s", instance->nice_flor_s_rainbow_table_file_name);
+        instance->nice_flor_s_rainbow_table =
+            subghz_keystore_raw_reader_alloc(instance->nice_flor_s_rainbow_table_file_name);
     }
     return instance;
 }
@@ -252,6 +261,9 @@ void subghz_protocol_decoder_nice_flor_s_free(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderNiceFlorS* instance = context;
     instance->nice_flor_s_rainbow_table_file_name = NULL;
+    if(instance->nice_flor_s_rainbow_table) {
+        subghz_keystore_raw_reader_free(instance->nice_flor_s_rainbow_table);
+    }
     free(instance);
 }
 
@@ -352,11 +364,11 @@ void subghz_protocol_decoder_nice_flor_s_feed(void* context, bool level, uint32_
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
- * @param file_name Full path to rainbow table the file 
+ * @param rainbow_table Pointer to a SubGhzKeystoreRawReader instance
  */
 static void subghz_protocol_nice_flor_s_remote_controller(
     SubGhzBlockGeneric* instance,
-    const char* file_name) {
+    SubGhzKeystoreRawReader* rainbow_table) {
     /*
     * Protocol Nice Flor-S
     * Packet format Nice Flor-s: START-P0-P1-P2-P3-P4-P5-P6-P7-STOP
@@ -398,12 +410,12 @@ static void subghz_protocol_nice_flor_s_remote_controller(
     *  further up to 15 with overflow
     * 
     */
-    if(!file_name) {
+    if(!rainbow_table) {
         instance->cnt = 0;
         instance->serial = 0;
         instance->btn = 0;
     } else {
-        uint64_t decrypt = subghz_protocol_nice_flor_s_decrypt(instance, file_name);
+        uint64_t decrypt = subghz_protocol_nice_flor_s_decrypt(instance, rainbow_table);
         instance->cnt = decrypt & 0xFFFF;
         instance->serial = (decrypt >> 16) & 0xFFFFFFF;
         instance->btn = (decrypt >> 48) & 0xF;
@@ -417,6 +429,13 @@ uint8_t subghz_protocol_decoder_nice_flor_s_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_nice_flor_s_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNiceFlorS* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_nice_flor_s_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -475,7 +494,7 @@ void subghz_protocol_decoder_nice_flor_s_get_string(void* context, FuriString* o
     SubGhzProtocolDecoderNiceFlorS* instance = context;
 
     subghz_protocol_nice_flor_s_remote_controller(
-        &instance->generic, instance->nice_flor_s_rainbow_table_file_name);
+        &instance->generic, instance->nice_flor_s_rainbow_table);
 
     if(instance->generic.data_count_bit == NICE_ONE_COUNT_BIT) {
         furi_string_cat_printf(
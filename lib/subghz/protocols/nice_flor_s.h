@@ -45,6 +45,13 @@ void subghz_protocol_decoder_nice_flor_s_feed(void* context, bool level, uint32_
  */
 uint8_t subghz_protocol_decoder_nice_flor_s_get_hash_data(void* context);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * @param context Pointer to a SubGhzProtocolDecoderNiceFlorS instance
+ * @return hash 64-bit hash sum
+ */
+uint64_t subghz_protocol_decoder_nice_flor_s_get_hash_data_long(void* context);
+
 /**
  * Serialize data SubGhzProtocolDecoderNiceFlorS.
  * @param context Pointer to a SubGhzProtocolDecoderNiceFlorS instance
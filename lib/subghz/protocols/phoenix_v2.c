@@ -17,6 +17,14 @@ static const SubGhzBlockConst subghz_protocol_phoenix_v2_const = {
     .min_count_bit_for_found = 52,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_phoenix_v2_wakeup = {
+    .level = false,
+    .te = &subghz_protocol_phoenix_v2_const.te_short,
+    .te_count = 60,
+    .te_delta = &subghz_protocol_phoenix_v2_const.te_delta,
+    .te_delta_count = 30,
+};
+
 struct SubGhzProtocolDecoderPhoenix_V2 {
     SubGhzProtocolDecoderBase base;
 
@@ -49,6 +57,10 @@ const SubGhzProtocolDecoder subghz_protocol_phoenix_v2_decoder = {
     .serialize = subghz_protocol_decoder_phoenix_v2_serialize,
     .deserialize = subghz_protocol_decoder_phoenix_v2_deserialize,
     .get_string = subghz_protocol_decoder_phoenix_v2_get_string,
+
+    .wakeup = &subghz_protocol_phoenix_v2_wakeup,
+    .is_idle = subghz_protocol_decoder_phoenix_v2_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_phoenix_v2_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_phoenix_v2_encoder = {
@@ -202,6 +214,12 @@ void subghz_protocol_decoder_phoenix_v2_reset(void* context) {
     instance->decoder.parser_step = Phoenix_V2DecoderStepReset;
 }
 
+bool subghz_protocol_decoder_phoenix_v2_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPhoenix_V2* instance = context;
+    return instance->decoder.parser_step == Phoenix_V2DecoderStepReset;
+}
+
 void subghz_protocol_decoder_phoenix_v2_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderPhoenix_V2* instance = context;
@@ -293,6 +311,13 @@ uint8_t subghz_protocol_decoder_phoenix_v2_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_phoenix_v2_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPhoenix_V2* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_phoenix_v2_serialize(
     void* context,
     FlipperFormat* flipper_format,
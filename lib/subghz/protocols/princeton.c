@@ -21,6 +21,14 @@ static const SubGhzBlockConst subghz_protocol_princeton_const = {
     .min_count_bit_for_found = 24,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_princeton_wakeup = {
+    .level = false,
+    .te = &subghz_protocol_princeton_const.te_short,
+    .te_count = 36,
+    .te_delta = &subghz_protocol_princeton_const.te_delta,
+    .te_delta_count = 36,
+};
+
 struct SubGhzProtocolDecoderPrinceton {
     SubGhzProtocolDecoderBase base;
 
@@ -34,7 +42,7 @@ struct SubGhzProtocolDecoderPrinceton {
 struct SubGhzProtocolEncoderPrinceton {
     SubGhzProtocolEncoderBase base;
 
-    SubGhzProtocolBlockEncoder encoder;
+    SubGhzProtocolBlockGenerator generator;
     SubGhzBlockGeneric generic;
 
     uint32_t te;
@@ -57,6 +65,10 @@ const SubGhzProtocolDecoder subghz_protocol_princeton_decoder = {
     .serialize = subghz_protocol_decoder_princeton_serialize,
     .deserialize = subghz_protocol_decoder_princeton_deserialize,
     .get_string = subghz_protocol_decoder_princeton_get_string,
+
+    .wakeup = &subghz_protocol_princeton_wakeup,
+    .is_idle = subghz_protocol_decoder_princeton_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_princeton_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_princeton_encoder = {
@@ -86,17 +98,14 @@ void* subghz_protocol_encoder_princeton_alloc(SubGhzEnvironment* environment) {
     instance->base.protocol = &subghz_protocol_princeton;
     instance->generic.protocol_name = instance->base.protocol->name;
 
-    instance->encoder.repeat = 10;
-    instance->encoder.size_upload = 52; //max 24bit*2 + 2 (start, stop)
-    instance->encoder.upload = malloc(instance->encoder.size_upload * sizeof(LevelDuration));
-    instance->encoder.is_running = false;
+    instance->generator.repeat = 10;
+    instance->generator.is_running = false;
     return instance;
 }
 
 void subghz_protocol_encoder_princeton_free(void* context) {
     furi_assert(context);
     SubGhzProtocolEncoderPrinceton* instance = context;
-    free(instance->encoder.upload);
     free(instance);
 }
 
@@ -108,37 +117,23 @@ void subghz_protocol_encoder_princeton_free(void* context) {
 static bool
     subghz_protocol_encoder_princeton_get_upload(SubGhzProtocolEncoderPrinceton* instance) {
     furi_assert(instance);
+    SubGhzProtocolBlockGenerator* generator = &instance->generator;
+    const uint32_t te = instance->te;
 
-    size_t index = 0;
-    size_t size_upload = (instance->generic.data_count_bit * 2) + 2;
-    if(size_upload > instance->encoder.size_upload) {
-        FURI_LOG_E(TAG, "Size upload exceeds allocated encoder buffer.");
-        return false;
-    } else {
-        instance->encoder.size_upload = size_upload;
-    }
-
+    subghz_protocol_blocks_generator_reset(generator);
     //Send key data
-    for(uint8_t i = instance->generic.data_count_bit; i > 0; i--) {
-        if(bit_read(instance->generic.data, i - 1)) {
-            //send bit 1
-            instance->encoder.upload[index++] =
-                level_duration_make(true, (uint32_t)instance->te * 3);
-            instance->encoder.upload[index++] = level_duration_make(false, (uint32_t)instance->te);
-        } else {
-            //send bit 0
-            instance->encoder.upload[index++] = level_duration_make(true, (uint32_t)instance->te);
-            instance->encoder.upload[index++] =
-                level_duration_make(false, (uint32_t)instance->te * 3);
-        }
-    }
-
+    subghz_protocol_blocks_generator_set_data(
+        generator, instance->generic.data, instance->generic.data_count_bit);
+    subghz_protocol_blocks_generator_set_bit(
+        generator, true, level_duration_make(true, te * 3), level_duration_make(false, te));
+    subghz_protocol_blocks_generator_set_bit(
+        generator, false, level_duration_make(true, te), level_duration_make(false, te * 3));
     //Send Stop bit
-    instance->encoder.upload[index++] = level_duration_make(true, (uint32_t)instance->te);
+    subghz_protocol_blocks_generator_add_trailer(generator, level_duration_make(true, te));
     //Send PT_GUARD
-    instance->encoder.upload[index++] = level_duration_make(false, (uint32_t)instance->te * 30);
+    subghz_protocol_blocks_generator_add_trailer(generator, level_duration_make(false, te * 30));
 
-    return true;
+    return subghz_protocol_blocks_generator_start(generator);
 }
 
 SubGhzProtocolStatus
@@ -166,13 +161,12 @@ SubGhzProtocolStatus
         }
         //optional parameter parameter
         flipper_format_read_uint32(
-            flipper_format, "Repeat", (uint32_t*)&instance->encoder.repeat, 1);
+            flipper_format, "Repeat", (uint32_t*)&instance->generator.repeat, 1);
 
         if(!subghz_protocol_encoder_princeton_get_upload(instance)) {
             ret = SubGhzProtocolStatusErrorEncoderGetUpload;
             break;
         }
-        instance->encoder.is_running = true;
     } while(false);
 
     return ret;
@@ -180,25 +174,12 @@ SubGhzProtocolStatus
 
 void subghz_protocol_encoder_princeton_stop(void* context) {
     SubGhzProtocolEncoderPrinceton* instance = context;
-    instance->encoder.is_running = false;
+    instance->generator.is_running = false;
 }
 
 LevelDuration subghz_protocol_encoder_princeton_yield(void* context) {
     SubGhzProtocolEncoderPrinceton* instance = context;
-
-    if(instance->encoder.repeat == 0 || !instance->encoder.is_running) {
-        instance->encoder.is_running = false;
-        return level_duration_reset();
-    }
-
-    LevelDuration ret = instance->encoder.upload[instance->encoder.front];
-
-    if(++instance->encoder.front == instance->encoder.size_upload) {
-        instance->encoder.repeat--;
-        instance->encoder.front = 0;
-    }
-
-    return ret;
+    return subghz_protocol_blocks_generator_yield(&instance->generator);
 }
 
 void* subghz_protocol_decoder_princeton_alloc(SubGhzEnvironment* environment) {
@@ -222,6 +203,12 @@ void subghz_protocol_decoder_princeton_reset(void* context) {
     instance->last_data = 0;
 }
 
+bool subghz_protocol_decoder_princeton_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPrinceton* instance = context;
+    return instance->decoder.parser_step == PrincetonDecoderStepReset;
+}
+
 void subghz_protocol_decoder_princeton_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderPrinceton* instance = context;
@@ -310,6 +297,13 @@ uint8_t subghz_protocol_decoder_princeton_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_princeton_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPrinceton* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_princeton_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -10,9 +10,13 @@
 
 #include <flipper_format/flipper_format_i.h>
 #include <lib/toolbox/stream/stream.h>
+#include <lib/toolbox/stream/file_stream.h>
+#include <lib/toolbox/varint.h>
 
 #define TAG "SubGhzProtocolRaw"
 #define SUBGHZ_DOWNLOAD_MAX_SIZE 512
+#define SUBGHZ_RAW_BIN_CHUNK_SIZE 64
+#define SUBGHZ_RAW_BIN_VARINT_SIZE_MAX 5
 
 static const SubGhzBlockConst subghz_protocol_raw_const = {
     .te_short = 50,
@@ -33,6 +37,7 @@ struct SubGhzProtocolDecoderRAW {
     size_t sample_write;
     bool last_level;
     bool pause;
+    bool binary;
 };
 
 struct SubGhzProtocolEncoderRAW {
@@ -171,13 +176,97 @@ bool subghz_protocol_raw_save_to_file_init(
     return init;
 }
 
+static bool
+    subghz_protocol_raw_write_bin_data(Stream* stream, const int32_t* data, size_t count) {
+    uint8_t buffer[SUBGHZ_RAW_BIN_CHUNK_SIZE];
+    uint32_t size = 0;
+    for(size_t i = 0; i < count; i++) {
+        size += varint_int32_length(data[i]);
+    }
+
+    if(!stream_write_format(stream, "%s: %lu\n", SUBGHZ_RAW_FILE_BIN_DATA_KEY, size)) {
+        return false;
+    }
+
+    size_t fill = 0;
+    for(size_t i = 0; i < count; i++) {
+        if(fill + SUBGHZ_RAW_BIN_VARINT_SIZE_MAX > sizeof(buffer)) {
+            if(stream_write(stream, buffer, fill) != fill) return false;
+            fill = 0;
+        }
+        fill += varint_int32_pack(data[i], &buffer[fill]);
+    }
+    if(stream_write(stream, buffer, fill) != fill) return false;
+
+    return stream_write_char(stream, '\n') == 1;
+}
+
+bool subghz_protocol_raw_read_bin_data(
+    Stream* stream,
+    size_t size,
+    SubGhzProtocolRAWDataCallback callback,
+    void* context) {
+    furi_assert(stream);
+    furi_assert(callback);
+
+    uint8_t buffer[SUBGHZ_RAW_BIN_CHUNK_SIZE];
+    int32_t data[SUBGHZ_RAW_BIN_CHUNK_SIZE];
+    size_t fill = 0;
+    bool result = true;
+
+    while(result && (size || fill)) {
+        size_t read_size = MIN(size, sizeof(buffer) - fill);
+        if(stream_read(stream, &buffer[fill], read_size) != read_size) {
+            FURI_LOG_E(TAG, "Unexpected end of RAW_Bin_Data");
+            result = false;
+            break;
+        }
+        fill += read_size;
+        size -= read_size;
+
+        // Unpack complete varints only, the tail is carried to the next chunk
+        size_t pos = 0;
+        size_t count = 0;
+        while(pos < fill) {
+            size_t len = 0;
+            while(pos + len < fill && (buffer[pos + len] & 0x80)) len++;
+            if(len >= SUBGHZ_RAW_BIN_VARINT_SIZE_MAX) {
+                result = false;
+                break;
+            }
+            if(pos + len == fill) break;
+            pos += varint_int32_unpack(&data[count++], &buffer[pos], fill - pos);
+        }
+        if(!result || (!count && !read_size)) {
+            FURI_LOG_E(TAG, "Invalid RAW_Bin_Data");
+            result = false;
+            break;
+        }
+
+        if(count) result = callback(data, count, context);
+        memmove(buffer, &buffer[pos], fill - pos);
+        fill -= pos;
+    }
+
+    return result;
+}
+
 static bool subghz_protocol_raw_save_to_file_write(SubGhzProtocolDecoderRAW* instance) {
     furi_assert(instance);
 
     bool is_write = false;
     if(instance->file_is_open == RAWFileIsOpenWrite) {
-        if(!flipper_format_write_int32(
-               instance->flipper_file, "RAW_Data", instance->upload_raw, instance->ind_write)) {
+        bool result;
+        if(instance->binary) {
+            result = subghz_protocol_raw_write_bin_data(
+                flipper_format_get_raw_stream(instance->flipper_file),
+                instance->upload_raw,
+                instance->ind_write);
+        } else {
+            result = flipper_format_write_int32(
+                instance->flipper_file, "RAW_Data", instance->upload_raw, instance->ind_write);
+        }
+        if(!result) {
             FURI_LOG_E(TAG, "Unable to add RAW_Data");
         } else {
             instance->sample_write += instance->ind_write;
@@ -188,6 +277,11 @@ static bool subghz_protocol_raw_save_to_file_write(SubGhzProtocolDecoderRAW* ins
     return is_write;
 }
 
+void subghz_protocol_raw_save_to_file_set_binary(SubGhzProtocolDecoderRAW* instance, bool binary) {
+    furi_assert(instance);
+    instance->binary = binary;
+}
+
 void subghz_protocol_raw_save_to_file_stop(SubGhzProtocolDecoderRAW* instance) {
     furi_assert(instance);
 
@@ -223,6 +317,7 @@ void* subghz_protocol_decoder_raw_alloc(SubGhzEnvironment* environment) {
     instance->upload_raw = NULL;
     instance->ind_write = 0;
     instance->last_level = false;
+    instance->binary = false;
     instance->file_is_open = RAWFileIsOpenClose;
     instance->file_name = furi_string_alloc();
 
@@ -357,6 +452,121 @@ void subghz_protocol_raw_gen_fff_data(
     } while(false);
 }
 
+typedef struct {
+    Stream* stream;
+    FlipperFormat* flipper_format;
+    int32_t* data;
+    size_t count;
+    bool binary;
+} SubGhzProtocolRAWConvert;
+
+static bool subghz_protocol_raw_convert_flush(SubGhzProtocolRAWConvert* convert) {
+    bool result = true;
+    if(convert->count) {
+        if(convert->binary) {
+            result =
+                subghz_protocol_raw_write_bin_data(convert->stream, convert->data, convert->count);
+        } else {
+            result = flipper_format_write_int32(
+                convert->flipper_format, "RAW_Data", convert->data, convert->count);
+        }
+        convert->count = 0;
+    }
+    return result;
+}
+
+static bool subghz_protocol_raw_convert_push(const int32_t* data, size_t count, void* context) {
+    SubGhzProtocolRAWConvert* convert = context;
+    for(size_t i = 0; i < count; i++) {
+        convert->data[convert->count++] = data[i];
+        if(convert->count == SUBGHZ_DOWNLOAD_MAX_SIZE) {
+            if(!subghz_protocol_raw_convert_flush(convert)) return false;
+        }
+    }
+    return true;
+}
+
+static bool
+    subghz_protocol_raw_convert_text_line(SubGhzProtocolRAWConvert* convert, const char* line) {
+    // Line sample: "RAW_Data: -1 2 -2..."
+    const char* cursor = strchr(line, ' ');
+    while(cursor) {
+        char* end;
+        int32_t duration = strtol(cursor, &end, 10);
+        if(end == cursor) break;
+        if(!subghz_protocol_raw_convert_push(&duration, 1, convert)) return false;
+        cursor = end;
+    }
+    return true;
+}
+
+bool subghz_protocol_raw_convert_file(
+    const char* input_file,
+    const char* output_file,
+    bool binary) {
+    furi_assert(input_file);
+    furi_assert(output_file);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    // Output is opened with truncation, converting in place would destroy the input
+    if(storage_common_equivalent_path(storage, input_file, output_file, false)) {
+        FURI_LOG_E(TAG, "Unable to convert file in place: %s", input_file);
+        furi_record_close(RECORD_STORAGE);
+        return false;
+    }
+
+    Stream* input = file_stream_alloc(storage);
+    FuriString* line = furi_string_alloc();
+
+    SubGhzProtocolRAWConvert convert = {
+        .flipper_format = flipper_format_file_alloc(storage),
+        .data = malloc(SUBGHZ_DOWNLOAD_MAX_SIZE * sizeof(int32_t)),
+        .count = 0,
+        .binary = binary,
+    };
+    convert.stream = flipper_format_get_raw_stream(convert.flipper_format);
+
+    bool result = false;
+    do {
+        if(!file_stream_open(input, input_file, FSAM_READ, FSOM_OPEN_EXISTING)) {
+            FURI_LOG_E(TAG, "Unable to open file for read: %s", input_file);
+            break;
+        }
+        if(!flipper_format_file_open_always(convert.flipper_format, output_file)) {
+            FURI_LOG_E(TAG, "Unable to open file for write: %s", output_file);
+            break;
+        }
+
+        result = true;
+        while(result && stream_read_line(input, line)) {
+            if(furi_string_start_with_str(line, SUBGHZ_RAW_FILE_BIN_DATA_KEY ":")) {
+                const char* value = strchr(furi_string_get_cstr(line), ' ');
+                size_t size = value ? strtoul(value, NULL, 10) : 0;
+                result = subghz_protocol_raw_read_bin_data(
+                    input, size, subghz_protocol_raw_convert_push, &convert);
+                //skip the end of the payload "\n"
+                stream_seek(input, 1, StreamOffsetFromCurrent);
+            } else if(furi_string_start_with_str(line, "RAW_Data:")) {
+                result =
+                    subghz_protocol_raw_convert_text_line(&convert, furi_string_get_cstr(line));
+            } else {
+                result = subghz_protocol_raw_convert_flush(&convert) &&
+                         stream_write_string(convert.stream, line) == furi_string_size(line);
+            }
+        }
+        result = result && subghz_protocol_raw_convert_flush(&convert);
+        if(!result) FURI_LOG_E(TAG, "Unable to convert %s", input_file);
+    } while(false);
+
+    free(convert.data);
+    flipper_format_free(convert.flipper_format);
+    furi_string_free(line);
+    stream_free(input);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
 SubGhzProtocolStatus
     subghz_protocol_encoder_raw_deserialize(void* context, FlipperFormat* flipper_format) {
     furi_assert(context);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "base.h"
+#include <toolbox/stream/stream.h>
 
 #define SUBGHZ_PROTOCOL_RAW_NAME "RAW"
 
@@ -10,6 +11,15 @@ extern "C" {
 
 typedef void (*SubGhzProtocolEncoderRAWCallbackEnd)(void* context);
 
+/**
+ * Callback for decoded RAW durations.
+ * @param data Signed durations, positive - high level, negative - low level
+ * @param count Number of durations in data
+ * @param context Context
+ * @return true to continue reading
+ */
+typedef bool (*SubGhzProtocolRAWDataCallback)(const int32_t* data, size_t count, void* context);
+
 typedef struct SubGhzProtocolDecoderRAW SubGhzProtocolDecoderRAW;
 typedef struct SubGhzProtocolEncoderRAW SubGhzProtocolEncoderRAW;
 
@@ -29,6 +39,14 @@ bool subghz_protocol_raw_save_to_file_init(
     const char* dev_name,
     SubGhzRadioPreset* preset);
 
+/**
+ * Select RAW data format for the next file writes.
+ * Binary format stores durations as zigzag varints in RAW_Bin_Data blocks.
+ * @param instance Pointer to a SubGhzProtocolDecoderRAW instance
+ * @param binary true - binary RAW_Bin_Data, false - text RAW_Data
+ */
+void subghz_protocol_raw_save_to_file_set_binary(SubGhzProtocolDecoderRAW* instance, bool binary);
+
 /**
  * Stop writing file to flash
  * @param instance Pointer to a SubGhzProtocolDecoderRAW instance
@@ -133,6 +151,33 @@ void subghz_protocol_raw_gen_fff_data(
     const char* file_path,
     const char* radio_dev_name);
 
+/**
+ * Read RAW_Bin_Data payload.
+ * Stream must be positioned right after the RAW_Bin_Data line.
+ * @param stream Pointer to a Stream instance
+ * @param size Payload size in bytes
+ * @param callback Callback, called on every decoded chunk of durations
+ * @param context Context
+ * @return true On success
+ */
+bool subghz_protocol_raw_read_bin_data(
+    Stream* stream,
+    size_t size,
+    SubGhzProtocolRAWDataCallback callback,
+    void* context);
+
+/**
+ * Convert RAW file between text RAW_Data and binary RAW_Bin_Data formats.
+ * @param input_file Full path to the source RAW file
+ * @param output_file Full path to the resulting RAW file, must not be the input file
+ * @param binary true - convert to binary format, false - convert to text format
+ * @return true On success
+ */
+bool subghz_protocol_raw_convert_file(
+    const char* input_file,
+    const char* output_file,
+    bool binary);
+
 /**
  * Deserialize and generating an upload to send.
  * @param context Pointer to a SubGhzProtocolEncoderRAW instance
@@ -81,6 +81,13 @@ void subghz_protocol_decoder_secplus_v1_feed(void* context, bool level, uint32_t
  */
 uint8_t subghz_protocol_decoder_secplus_v1_get_hash_data(void* context);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * @param context Pointer to a SubGhzProtocolDecoderSecPlus_v1 instance
+ * @return hash 64-bit hash sum
+ */
+uint64_t subghz_protocol_decoder_secplus_v1_get_hash_data_long(void* context);
+
 /**
  * Serialize data SubGhzProtocolDecoderSecPlus_v1.
  * @param context Pointer to a SubGhzProtocolDecoderSecPlus_v1 instance
@@ -62,6 +62,7 @@ const SubGhzProtocolDecoder subghz_protocol_secplus_v2_decoder = {
     .serialize = subghz_protocol_decoder_secplus_v2_serialize,
     .deserialize = subghz_protocol_decoder_secplus_v2_deserialize,
     .get_string = subghz_protocol_decoder_secplus_v2_get_string,
+    .get_hash_data_long = subghz_protocol_decoder_secplus_v2_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_secplus_v2_encoder = {
@@ -754,6 +755,13 @@ uint8_t subghz_protocol_decoder_secplus_v2_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_secplus_v2_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSecPlus_v2* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_secplus_v2_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -36,6 +36,14 @@ static const SubGhzBlockConst subghz_protocol_smc5326_const = {
     .min_count_bit_for_found = 25,
 };
 
+static const SubGhzProtocolDecoderWakeup subghz_protocol_smc5326_wakeup = {
+    .level = false,
+    .te = &subghz_protocol_smc5326_const.te_short,
+    .te_count = 24,
+    .te_delta = &subghz_protocol_smc5326_const.te_delta,
+    .te_delta_count = 12,
+};
+
 struct SubGhzProtocolDecoderSMC5326 {
     SubGhzProtocolDecoderBase base;
 
@@ -72,6 +80,10 @@ const SubGhzProtocolDecoder subghz_protocol_smc5326_decoder = {
     .serialize = subghz_protocol_decoder_smc5326_serialize,
     .deserialize = subghz_protocol_decoder_smc5326_deserialize,
     .get_string = subghz_protocol_decoder_smc5326_get_string,
+
+    .wakeup = &subghz_protocol_smc5326_wakeup,
+    .is_idle = subghz_protocol_decoder_smc5326_is_idle,
+    .get_hash_data_long = subghz_protocol_decoder_smc5326_get_hash_data_long,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_smc5326_encoder = {
@@ -236,6 +248,12 @@ void subghz_protocol_decoder_smc5326_reset(void* context) {
     instance->last_data = 0;
 }
 
+bool subghz_protocol_decoder_smc5326_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSMC5326* instance = context;
+    return instance->decoder.parser_step == SMC5326DecoderStepReset;
+}
+
 void subghz_protocol_decoder_smc5326_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderSMC5326* instance = context;
@@ -315,6 +333,13 @@ uint8_t subghz_protocol_decoder_smc5326_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+uint64_t subghz_protocol_decoder_smc5326_get_hash_data_long(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSMC5326* instance = context;
+    return subghz_protocol_blocks_get_hash_data_long(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_smc5326_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -45,6 +45,13 @@ void subghz_protocol_decoder_somfy_keytis_feed(void* context, bool level, uint32
  */
 uint8_t subghz_protocol_decoder_somfy_keytis_get_hash_data(void* context);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * @param context Pointer to a SubGhzProtocolDecoderSomfyKeytis instance
+ * @return hash 64-bit hash sum
+ */
+uint64_t subghz_protocol_decoder_somfy_keytis_get_hash_data_long(void* context);
+
 /**
  * Serialize data SubGhzProtocolDecoderSomfyKeytis.
  * @param context Pointer to a SubGhzProtocolDecoderSomfyKeytis instance
@@ -45,6 +45,13 @@ void subghz_protocol_decoder_somfy_telis_feed(void* context, bool level, uint32_
  */
 uint8_t subghz_protocol_decoder_somfy_telis_get_hash_data(void* context);
 
+/**
+ * Getting the 64-bit fingerprint of the last randomly received parcel.
+ * @param context Pointer to a SubGhzProtocolDecoderSomfyTelis instance
+ * @return hash 64-bit hash sum
+ */
+uint64_t subghz_protocol_decoder_somfy_telis_get_hash_data_long(void* context);
+
 /**
  * Serialize data SubGhzProtocolDecoderSomfyTelis.
  * @param context Pointer to a SubGhzProtocolDecoderSomfyTelis instance
@@ -2,9 +2,13 @@
 
 #include "registry.h"
 #include "protocols/protocol_items.h"
+#include "blocks/math.h"
 
 #include <m-array.h>
 
+#define SUBGHZ_RECEIVER_DISPATCH_WORD_BITS (32U)
+#define SUBGHZ_RECEIVER_REPEAT_TABLE_SIZE (8U)
+
 typedef struct {
     SubGhzProtocolEncoderBase* base;
 } SubGhzReceiverSlot;
@@ -12,14 +16,184 @@ typedef struct {
 ARRAY_DEF(SubGhzReceiverSlotArray, SubGhzReceiverSlot, M_POD_OPLIST);
 #define M_OPL_SubGhzReceiverSlotArray_t() ARRAY_OPLIST(SubGhzReceiverSlotArray, M_POD_OPLIST)
 
+/**
+ * Duration buckets for one signal level.
+ * Bucket 0 covers [0, bounds[0]), bucket i covers [bounds[i-1], bounds[i]),
+ * last bucket covers [bounds[bounds_count-1], inf).
+ */
+typedef struct {
+    uint32_t* bounds;
+    size_t bounds_count;
+    uint32_t* masks; // (bounds_count + 1) * words, slots to wake per bucket
+} SubGhzReceiverDispatchLevel;
+
+typedef struct {
+    size_t words;
+    uint32_t* always; // slots without dispatch hints, fed on every edge
+    uint32_t* active; // indexed slots that are in the middle of a frame
+    SubGhzReceiverDispatchLevel levels[2];
+} SubGhzReceiverDispatch;
+
+typedef struct {
+    uint64_t fingerprint;
+    uint32_t timestamp;
+} SubGhzReceiverRepeat;
+
+/** Recently seen packets, a packet is a repeat if seen less than window ms ago */
+typedef struct {
+    uint32_t window;
+    uint32_t suppressed;
+    size_t next;
+    SubGhzReceiverRepeat table[SUBGHZ_RECEIVER_REPEAT_TABLE_SIZE];
+} SubGhzReceiverRepeatFilter;
+
 struct SubGhzReceiver {
     SubGhzReceiverSlotArray_t slots;
     SubGhzProtocolFlag filter;
+    SubGhzReceiverDispatch dispatch;
+    SubGhzReceiverRepeatFilter repeat;
 
     SubGhzReceiverCallback callback;
     void* context;
 };
 
+static inline bool subghz_receiver_slot_is_indexed(SubGhzReceiverSlot* slot) {
+    const SubGhzProtocolDecoder* decoder = slot->base->protocol->decoder;
+    return decoder->wakeup && decoder->is_idle;
+}
+
+static inline uint32_t
+    subghz_receiver_wakeup_duration(const SubGhzProtocolDecoderWakeup* wakeup) {
+    return (uint32_t)*wakeup->te * wakeup->te_count;
+}
+
+static inline uint32_t subghz_receiver_wakeup_delta(const SubGhzProtocolDecoderWakeup* wakeup) {
+    return (uint32_t)*wakeup->te_delta * wakeup->te_delta_count;
+}
+
+static void subghz_receiver_dispatch_level_init(
+    SubGhzReceiver* instance,
+    SubGhzReceiverDispatchLevel* dispatch_level,
+    bool level) {
+    SubGhzReceiverDispatch* dispatch = &instance->dispatch;
+    size_t slot_count = SubGhzReceiverSlotArray_size(instance->slots);
+
+    // Every window contributes its first and one past last duration
+    dispatch_level->bounds = malloc(sizeof(uint32_t) * slot_count * 2 + sizeof(uint32_t));
+    dispatch_level->bounds_count = 0;
+
+    for(size_t i = 0; i < slot_count; i++) {
+        SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_get(instance->slots, i);
+        if(!subghz_receiver_slot_is_indexed(slot)) continue;
+        const SubGhzProtocolDecoderWakeup* wakeup = slot->base->protocol->decoder->wakeup;
+        if(wakeup->level != level) continue;
+
+        const uint32_t duration = subghz_receiver_wakeup_duration(wakeup);
+        const uint32_t delta = subghz_receiver_wakeup_delta(wakeup);
+        uint32_t window[2] = {
+            (duration >= delta) ? (duration - delta + 1) : 0,
+            duration + delta,
+        };
+
+        for(size_t w = 0; w < COUNT_OF(window); w++) {
+            // Insertion into sorted unique list, windows count is small
+            size_t pos = 0;
+            while(pos < dispatch_level->bounds_count && dispatch_level->bounds[pos] < window[w]) {
+                pos++;
+            }
+            if(pos < dispatch_level->bounds_count && dispatch_level->bounds[pos] == window[w]) {
+                continue;
+            }
+            memmove(
+                &dispatch_level->bounds[pos + 1],
+                &dispatch_level->bounds[pos],
+                sizeof(uint32_t) * (dispatch_level->bounds_count - pos));
+            dispatch_level->bounds[pos] = window[w];
+            dispatch_level->bounds_count++;
+        }
+    }
+
+    size_t bucket_count = dispatch_level->bounds_count + 1;
+    dispatch_level->masks = malloc(sizeof(uint32_t) * dispatch->words * bucket_count);
+    memset(dispatch_level->masks, 0, sizeof(uint32_t) * dispatch->words * bucket_count);
+
+    for(size_t bucket = 0; bucket < bucket_count; bucket++) {
+        uint32_t bucket_start = bucket ? dispatch_level->bounds[bucket - 1] : 0;
+        uint32_t* mask = &dispatch_level->masks[bucket * dispatch->words];
+
+        for(size_t i = 0; i < slot_count; i++) {
+            SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_get(instance->slots, i);
+            if(!subghz_receiver_slot_is_indexed(slot)) continue;
+            const SubGhzProtocolDecoderWakeup* wakeup = slot->base->protocol->decoder->wakeup;
+            if(wakeup->level != level) continue;
+
+            // All durations inside of a bucket share the same match result
+            if(DURATION_DIFF(bucket_start, subghz_receiver_wakeup_duration(wakeup)) <
+               subghz_receiver_wakeup_delta(wakeup)) {
+                mask[i / SUBGHZ_RECEIVER_DISPATCH_WORD_BITS] |=
+                    1UL << (i % SUBGHZ_RECEIVER_DISPATCH_WORD_BITS);
+            }
+        }
+    }
+}
+
+static void subghz_receiver_dispatch_init(SubGhzReceiver* instance) {
+    SubGhzReceiverDispatch* dispatch = &instance->dispatch;
+    size_t slot_count = SubGhzReceiverSlotArray_size(instance->slots);
+
+    dispatch->words = (slot_count + SUBGHZ_RECEIVER_DISPATCH_WORD_BITS - 1) /
+                      SUBGHZ_RECEIVER_DISPATCH_WORD_BITS;
+    if(!dispatch->words) dispatch->words = 1;
+
+    dispatch->always = malloc(sizeof(uint32_t) * dispatch->words);
+    memset(dispatch->always, 0, sizeof(uint32_t) * dispatch->words);
+    dispatch->active = malloc(sizeof(uint32_t) * dispatch->words);
+    memset(dispatch->active, 0, sizeof(uint32_t) * dispatch->words);
+
+    for(size_t i = 0; i < slot_count; i++) {
+        SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_get(instance->slots, i);
+        if(!subghz_receiver_slot_is_indexed(slot)) {
+            dispatch->always[i / SUBGHZ_RECEIVER_DISPATCH_WORD_BITS] |=
+                1UL << (i % SUBGHZ_RECEIVER_DISPATCH_WORD_BITS);
+        }
+    }
+
+    subghz_receiver_dispatch_level_init(instance, &dispatch->levels[0], false);
+    subghz_receiver_dispatch_level_init(instance, &dispatch->levels[1], true);
+}
+
+static void subghz_receiver_dispatch_free(SubGhzReceiver* instance) {
+    SubGhzReceiverDispatch* dispatch = &instance->dispatch;
+
+    for(size_t i = 0; i < COUNT_OF(dispatch->levels); i++) {
+        free(dispatch->levels[i].bounds);
+        free(dispatch->levels[i].masks);
+    }
+    free(dispatch->active);
+    free(dispatch->always);
+}
+
+static inline const uint32_t* subghz_receiver_dispatch_get_bucket(
+    SubGhzReceiverDispatch* dispatch,
+    bool level,
+    uint32_t duration) {
+    SubGhzReceiverDispatchLevel* dispatch_level = &dispatch->levels[level ? 1 : 0];
+
+    // Bucket index is the amount of bounds that are less or equal to duration
+    size_t low = 0;
+    size_t high = dispatch_level->bounds_count;
+    while(low < high) {
+        size_t middle = (low + high) / 2;
+        if(dispatch_level->bounds[middle] <= duration) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return &dispatch_level->masks[low * dispatch->words];
+}
+
 SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
     SubGhzReceiver* instance = malloc(sizeof(SubGhzReceiver));
     SubGhzReceiverSlotArray_init(instance->slots);
@@ -36,6 +210,8 @@ SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
         }
     }
 
+    subghz_receiver_dispatch_init(instance);
+
     instance->callback = NULL;
     instance->context = NULL;
     return instance;
@@ -55,6 +231,8 @@ void subghz_receiver_free(SubGhzReceiver* instance) {
         }
     SubGhzReceiverSlotArray_clear(instance->slots);
 
+    subghz_receiver_dispatch_free(instance);
+
     free(instance);
 }
 
@@ -62,12 +240,32 @@ void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t durat
     furi_assert(instance);
     furi_assert(instance->slots);
 
-    for
-        M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
-            if((slot->base->protocol->flag & instance->filter) != 0) {
-                slot->base->protocol->decoder->feed(slot->base, level, duration);
+    SubGhzReceiverDispatch* dispatch = &instance->dispatch;
+    const uint32_t* bucket = subghz_receiver_dispatch_get_bucket(dispatch, level, duration);
+
+    // Only wake decoders that are mid-frame or whose frame start matches this edge
+    for(size_t word = 0; word < dispatch->words; word++) {
+        uint32_t pending = dispatch->always[word] | dispatch->active[word] | bucket[word];
+        while(pending) {
+            size_t bit = __builtin_ctz(pending);
+            pending &= pending - 1;
+
+            size_t index = word * SUBGHZ_RECEIVER_DISPATCH_WORD_BITS + bit;
+            SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_get(instance->slots, index);
+            const SubGhzProtocolDecoder* decoder = slot->base->protocol->decoder;
+            if((slot->base->protocol->flag & instance->filter) == 0) continue;
+
+            decoder->feed(slot->base, level, duration);
+
+            if(!(dispatch->always[word] & (1UL << bit))) {
+                if(decoder->is_idle(slot->base)) {
+                    dispatch->active[word] &= ~(1UL << bit);
+                } else {
+                    dispatch->active[word] |= 1UL << bit;
+                }
             }
         }
+    }
 }
 
 void subghz_receiver_reset(SubGhzReceiver* instance) {
@@ -78,10 +276,41 @@ void subghz_receiver_reset(SubGhzReceiver* instance) {
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
             slot->base->protocol->decoder->reset(slot->base);
         }
+
+    memset(instance->dispatch.active, 0, sizeof(uint32_t) * instance->dispatch.words);
+}
+
+static bool subghz_receiver_repeat_check(
+    SubGhzReceiverRepeatFilter* repeat,
+    SubGhzProtocolDecoderBase* decoder_base) {
+    // Mix in protocol so equal payloads of different protocols do not collide
+    uint64_t fingerprint = subghz_protocol_decoder_base_get_hash_data_long(decoder_base) ^
+                           ((uint64_t)(uintptr_t)decoder_base->protocol * 0x9E3779B97F4A7C15ULL);
+    uint32_t now = furi_get_tick();
+
+    for(size_t i = 0; i < SUBGHZ_RECEIVER_REPEAT_TABLE_SIZE; i++) {
+        SubGhzReceiverRepeat* entry = &repeat->table[i];
+        if(entry->timestamp && entry->fingerprint == fingerprint &&
+           (now - entry->timestamp) < repeat->window) {
+            // Window slides while the remote keeps transmitting
+            entry->timestamp = now;
+            return true;
+        }
+    }
+
+    SubGhzReceiverRepeat* entry = &repeat->table[repeat->next];
+    entry->fingerprint = fingerprint;
+    entry->timestamp = now ? now : 1;
+    repeat->next = (repeat->next + 1) % SUBGHZ_RECEIVER_REPEAT_TABLE_SIZE;
+    return false;
 }
 
 static void subghz_receiver_rx_callback(SubGhzProtocolDecoderBase* decoder_base, void* context) {
     SubGhzReceiver* instance = context;
+    if(instance->repeat.window && subghz_receiver_repeat_check(&instance->repeat, decoder_base)) {
+        instance->repeat.suppressed++;
+        return;
+    }
     if(instance->callback) {
         instance->callback(instance, decoder_base, instance->context);
     }
@@ -108,6 +337,17 @@ void subghz_receiver_set_filter(SubGhzReceiver* instance, SubGhzProtocolFlag fil
     instance->filter = filter;
 }
 
+void subghz_receiver_set_repeat_filter(SubGhzReceiver* instance, uint32_t window) {
+    furi_assert(instance);
+    memset(&instance->repeat, 0, sizeof(SubGhzReceiverRepeatFilter));
+    instance->repeat.window = window;
+}
+
+uint32_t subghz_receiver_get_repeat_suppressed(SubGhzReceiver* instance) {
+    furi_assert(instance);
+    return instance->repeat.suppressed;
+}
+
 SubGhzProtocolDecoderBase* subghz_receiver_search_decoder_base_by_name(
     SubGhzReceiver* instance,
     const char* decoder_name) {
@@ -59,6 +59,22 @@ void subghz_receiver_set_rx_callback(
  */
 void subghz_receiver_set_filter(SubGhzReceiver* instance, SubGhzProtocolFlag filter);
 
+/**
+ * Suppress repeated packets before the rx callback is called.
+ * A packet is a repeat if a packet with the same 64-bit fingerprint (protocol, data and
+ * bit count) was received less than window ms ago. Resets the suppressed counter.
+ * @param instance Pointer to a SubGhzReceiver instance
+ * @param window Repeat window in ms, 0 to disable
+ */
+void subghz_receiver_set_repeat_filter(SubGhzReceiver* instance, uint32_t window);
+
+/**
+ * Get number of packets suppressed as repeats.
+ * @param instance Pointer to a SubGhzReceiver instance
+ * @return Suppressed packet count
+ */
+uint32_t subghz_receiver_get_repeat_suppressed(SubGhzReceiver* instance);
+
 /**
  * Search for a cattery by his name.
  * @param instance Pointer to a SubGhzReceiver instance
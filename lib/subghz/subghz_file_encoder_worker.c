@@ -4,6 +4,7 @@
 #include <flipper_format/flipper_format.h>
 #include <flipper_format/flipper_format_i.h>
 #include <lib/subghz/devices/devices.h>
+#include <lib/subghz/protocols/raw.h>
 
 #define TAG "SubGhzFileEncoderWorker"
 
@@ -56,6 +57,28 @@ void subghz_file_encoder_worker_add_level_duration(
     }
 }
 
+static bool subghz_file_encoder_worker_add_level_duration_array(
+    const int32_t* data,
+    size_t count,
+    void* context) {
+    SubGhzFileEncoderWorker* instance = context;
+    bool level = instance->level;
+    for(size_t i = 0; i < count; i++) {
+        if((data[i] < 0 && !level) || (data[i] > 0 && level)) {
+            // Broken sequence, let the per duration path log and drop it
+            for(size_t j = 0; j < count; j++) {
+                subghz_file_encoder_worker_add_level_duration(instance, data[j]);
+            }
+            return true;
+        }
+        level = !level;
+    }
+
+    instance->level = level;
+    furi_stream_buffer_send(instance->stream, data, count * sizeof(int32_t), 100);
+    return true;
+}
+
 bool subghz_file_encoder_worker_data_parse(SubGhzFileEncoderWorker* instance, const char* strStart) {
     char* str1;
     bool res = false;
@@ -140,6 +163,24 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
         size_t stream_free_byte = furi_stream_buffer_spaces_available(instance->stream);
         if((stream_free_byte / sizeof(int32_t)) >= SUBGHZ_FILE_ENCODER_LOAD) {
             if(stream_read_line(stream, instance->str_data)) {
+                if(furi_string_start_with_str(
+                       instance->str_data, SUBGHZ_RAW_FILE_BIN_DATA_KEY ":")) {
+                    // Binary payload goes straight to the stream buffer
+                    const char* value = strchr(furi_string_get_cstr(instance->str_data), ' ');
+                    size_t size = value ? strtoul(value, NULL, 10) : 0;
+                    if(!subghz_protocol_raw_read_bin_data(
+                           stream,
+                           size,
+                           subghz_file_encoder_worker_add_level_duration_array,
+                           instance)) {
+                        subghz_file_encoder_worker_add_level_duration(
+                            instance, LEVEL_DURATION_RESET);
+                        break;
+                    }
+                    //skip the end of the payload "\n"
+                    stream_seek(stream, 1, StreamOffsetFromCurrent);
+                    continue;
+                }
                 furi_string_trim(instance->str_data);
                 if(!subghz_file_encoder_worker_data_parse(
                        instance, furi_string_get_cstr(instance->str_data))) {
@@ -5,6 +5,7 @@
 
 #include <storage/storage.h>
 #include <toolbox/hex.h>
+#include <toolbox/crc32_calc.h>
 #include <toolbox/stream/stream.h>
 #include <flipper_format/flipper_format.h>
 #include <flipper_format/flipper_format_i.h>
@@ -21,6 +22,21 @@
 #define SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE 512
 #define SUBGHZ_KEYSTORE_FILE_ENCRYPTED_LINE_SIZE (SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE * 2)
 
+#define SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE 16
+#define SUBGHZ_KEYSTORE_RAW_CACHE_BLOCKS 8
+#define SUBGHZ_KEYSTORE_RAW_READAHEAD_BLOCKS 4
+// Tables up to this size are decrypted once and kept in RAM
+#define SUBGHZ_KEYSTORE_RAW_WINDOW_SIZE_MAX 1024
+#define SUBGHZ_KEYSTORE_RAW_WINDOW_HEAP_RESERVE (16 * 1024)
+
+// Compiled keystore image, kept next to the source file
+#define SUBGHZ_KEYSTORE_CACHE_EXTENSION ".cache"
+#define SUBGHZ_KEYSTORE_CACHE_MAGIC 0x434B4753 // "SGKC"
+#define SUBGHZ_KEYSTORE_CACHE_VERSION 1
+#define SUBGHZ_KEYSTORE_CACHE_KEY_SLOT FURI_HAL_CRYPTO_ENCLAVE_UNIQUE_KEY_SLOT
+#define SUBGHZ_KEYSTORE_CACHE_CHUNK_SIZE 512
+#define SUBGHZ_KEYSTORE_CACHE_PAYLOAD_SIZE_MAX (64 * 1024)
+
 typedef enum {
     SubGhzKeystoreEncryptionNone,
     SubGhzKeystoreEncryptionAES256,
@@ -30,6 +46,29 @@ struct SubGhzKeystore {
     SubGhzKeyArray_t data;
 };
 
+/** Plain cache file header, payload is encrypted with the device unique key */
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;
+    uint32_t source_size;
+    uint32_t source_timestamp;
+    uint32_t key_count;
+    uint32_t pool_size;
+    uint32_t payload_size;
+    uint32_t payload_crc;
+    uint8_t iv[16];
+    uint32_t header_crc;
+} SubGhzKeystoreCacheHeader;
+
+/** Fixed-width key record, names are NUL terminated strings in the pool after records */
+typedef struct {
+    uint64_t key;
+    uint32_t name_offset;
+    uint16_t name_size;
+    uint16_t type;
+} SubGhzKeystoreCacheRecord;
+
 SubGhzKeystore* subghz_keystore_alloc() {
     SubGhzKeystore* instance = malloc(sizeof(SubGhzKeystore));
 
@@ -184,8 +223,11 @@ static bool subghz_keystore_read_file(SubGhzKeystore* instance, Stream* stream,
     return result;
 }
 
-bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
-    furi_assert(instance);
+static bool subghz_keystore_load_text(
+    SubGhzKeystore* instance,
+    Storage* storage,
+    const char* file_name,
+    uint32_t* encryption_out) {
     bool result = false;
     uint8_t iv[16];
     uint32_t version;
@@ -194,10 +236,6 @@ bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
     FuriString* filetype;
     filetype = furi_string_alloc();
 
-    FURI_LOG_I(TAG, "Loading keystore %s", file_name);
-
-    Storage* storage = furi_record_open(RECORD_STORAGE);
-
     FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
     do {
         if(!flipper_format_file_open_existing(flipper_format, file_name)) {
@@ -219,6 +257,7 @@ bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
             break;
         }
 
+        *encryption_out = encryption;
         Stream* stream = flipper_format_get_raw_stream(flipper_format);
         if(encryption == SubGhzKeystoreEncryptionNone) {
             result = subghz_keystore_read_file(instance, stream, NULL);
@@ -236,13 +275,245 @@ bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
     } while(0);
     flipper_format_free(flipper_format);
 
-    furi_record_close(RECORD_STORAGE);
-
     furi_string_free(filetype);
 
     return result;
 }
 
+static bool subghz_keystore_cache_crypt(uint8_t* data, size_t size, uint8_t* iv, bool encrypt) {
+    if(!furi_hal_crypto_enclave_load_key(SUBGHZ_KEYSTORE_CACHE_KEY_SLOT, iv)) {
+        FURI_LOG_E(TAG, "Unable to load cache key");
+        return false;
+    }
+
+    // Chaining is kept by the crypto engine between calls, so large chunks are fine
+    bool result = true;
+    uint8_t* buffer = malloc(SUBGHZ_KEYSTORE_CACHE_CHUNK_SIZE);
+    for(size_t offset = 0; offset < size; offset += SUBGHZ_KEYSTORE_CACHE_CHUNK_SIZE) {
+        size_t len = MIN((size_t)SUBGHZ_KEYSTORE_CACHE_CHUNK_SIZE, size - offset);
+        if(encrypt ? !furi_hal_crypto_encrypt(data + offset, buffer, len) :
+                     !furi_hal_crypto_decrypt(data + offset, buffer, len)) {
+            FURI_LOG_E(TAG, "Cache crypto failed");
+            result = false;
+            break;
+        }
+        memcpy(data + offset, buffer, len);
+    }
+    memset(buffer, 0, SUBGHZ_KEYSTORE_CACHE_CHUNK_SIZE);
+    free(buffer);
+
+    furi_hal_crypto_enclave_unload_key(SUBGHZ_KEYSTORE_CACHE_KEY_SLOT);
+    return result;
+}
+
+static uint32_t subghz_keystore_cache_header_crc(const SubGhzKeystoreCacheHeader* header) {
+    return crc32_calc_buffer(0, header, offsetof(SubGhzKeystoreCacheHeader, header_crc));
+}
+
+static size_t subghz_keystore_cache_payload_size(uint32_t key_count, uint32_t pool_size) {
+    size_t size = key_count * sizeof(SubGhzKeystoreCacheRecord) + pool_size;
+    if(size % SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE != 0) {
+        size += SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE - size % SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE;
+    }
+    return size;
+}
+
+static bool subghz_keystore_cache_get_source(
+    Storage* storage,
+    const char* file_name,
+    SubGhzKeystoreCacheHeader* header) {
+    FileInfo file_info;
+    if(storage_common_stat(storage, file_name, &file_info) != FSE_OK) return false;
+    if(storage_common_timestamp(storage, file_name, &header->source_timestamp) != FSE_OK) {
+        return false;
+    }
+    header->source_size = file_info.size;
+    return true;
+}
+
+static bool subghz_keystore_cache_load(
+    SubGhzKeystore* instance,
+    Storage* storage,
+    const char* cache_name,
+    const SubGhzKeystoreCacheHeader* source) {
+    bool result = false;
+    uint8_t* payload = NULL;
+    SubGhzKeystoreCacheHeader header;
+    File* file = storage_file_alloc(storage);
+
+    do {
+        if(!storage_file_open(file, cache_name, FSAM_READ, FSOM_OPEN_EXISTING)) break;
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) {
+            FURI_LOG_E(TAG, "Cache header read error");
+            break;
+        }
+        if(header.header_crc != subghz_keystore_cache_header_crc(&header) ||
+           header.magic != SUBGHZ_KEYSTORE_CACHE_MAGIC ||
+           header.version != SUBGHZ_KEYSTORE_CACHE_VERSION ||
+           header.record_size != sizeof(SubGhzKeystoreCacheRecord)) {
+            FURI_LOG_W(TAG, "Cache header mismatch");
+            break;
+        }
+        if(header.source_size != source->source_size ||
+           header.source_timestamp != source->source_timestamp) {
+            FURI_LOG_I(TAG, "Cache is stale");
+            break;
+        }
+        if(header.payload_size > SUBGHZ_KEYSTORE_CACHE_PAYLOAD_SIZE_MAX ||
+           header.pool_size > SUBGHZ_KEYSTORE_CACHE_PAYLOAD_SIZE_MAX ||
+           header.key_count >
+               SUBGHZ_KEYSTORE_CACHE_PAYLOAD_SIZE_MAX / sizeof(SubGhzKeystoreCacheRecord) ||
+           header.payload_size !=
+               subghz_keystore_cache_payload_size(header.key_count, header.pool_size)) {
+            FURI_LOG_E(TAG, "Cache size mismatch");
+            break;
+        }
+
+        payload = malloc(header.payload_size);
+        if(storage_file_read(file, payload, header.payload_size) != header.payload_size) {
+            FURI_LOG_E(TAG, "Cache payload read error");
+            break;
+        }
+        if(!subghz_keystore_cache_crypt(payload, header.payload_size, header.iv, false)) break;
+        if(crc32_calc_buffer(0, payload, header.payload_size) != header.payload_crc) {
+            FURI_LOG_E(TAG, "Cache payload corrupted");
+            break;
+        }
+
+        const SubGhzKeystoreCacheRecord* records = (const SubGhzKeystoreCacheRecord*)payload;
+        const char* pool = (const char*)&records[header.key_count];
+        bool records_valid = true;
+        for(size_t i = 0; i < header.key_count; i++) {
+            if(records[i].name_offset + records[i].name_size >= header.pool_size ||
+               pool[records[i].name_offset + records[i].name_size] != '\0') {
+                records_valid = false;
+                break;
+            }
+        }
+        if(!records_valid) {
+            FURI_LOG_E(TAG, "Cache record out of pool");
+            break;
+        }
+
+        SubGhzKeyArray_reserve(
+            instance->data, SubGhzKeyArray_size(instance->data) + header.key_count);
+        for(size_t i = 0; i < header.key_count; i++) {
+            subghz_keystore_add_key(
+                instance, pool + records[i].name_offset, records[i].key, records[i].type);
+        }
+        result = true;
+    } while(false);
+
+    if(payload) {
+        memset(payload, 0, header.payload_size);
+        free(payload);
+    }
+    storage_file_free(file);
+
+    return result;
+}
+
+static bool subghz_keystore_cache_save(
+    SubGhzKeystore* instance,
+    Storage* storage,
+    const char* cache_name,
+    SubGhzKeystoreCacheHeader* header,
+    size_t start) {
+    header->magic = SUBGHZ_KEYSTORE_CACHE_MAGIC;
+    header->version = SUBGHZ_KEYSTORE_CACHE_VERSION;
+    header->record_size = sizeof(SubGhzKeystoreCacheRecord);
+    header->key_count = SubGhzKeyArray_size(instance->data) - start;
+    header->pool_size = 0;
+    for(size_t i = start; i < SubGhzKeyArray_size(instance->data); i++) {
+        header->pool_size += furi_string_size(SubGhzKeyArray_cget(instance->data, i)->name) + 1;
+    }
+    header->payload_size =
+        subghz_keystore_cache_payload_size(header->key_count, header->pool_size);
+    if(header->payload_size > SUBGHZ_KEYSTORE_CACHE_PAYLOAD_SIZE_MAX) {
+        FURI_LOG_W(TAG, "Keystore is too big for cache");
+        return false;
+    }
+
+    uint8_t* payload = malloc(header->payload_size);
+    SubGhzKeystoreCacheRecord* records = (SubGhzKeystoreCacheRecord*)payload;
+    char* pool = (char*)&records[header->key_count];
+    size_t pool_offset = 0;
+    for(size_t i = 0; i < header->key_count; i++) {
+        const SubGhzKey* key = SubGhzKeyArray_cget(instance->data, start + i);
+        records[i].key = key->key;
+        records[i].type = key->type;
+        records[i].name_offset = pool_offset;
+        records[i].name_size = furi_string_size(key->name);
+        memcpy(pool + pool_offset, furi_string_get_cstr(key->name), records[i].name_size + 1);
+        pool_offset += records[i].name_size + 1;
+    }
+    header->payload_crc = crc32_calc_buffer(0, payload, header->payload_size);
+    furi_hal_random_fill_buf(header->iv, sizeof(header->iv));
+    header->header_crc = subghz_keystore_cache_header_crc(header);
+
+    bool result = false;
+    File* file = storage_file_alloc(storage);
+    do {
+        if(!furi_hal_crypto_enclave_ensure_key(SUBGHZ_KEYSTORE_CACHE_KEY_SLOT)) {
+            FURI_LOG_E(TAG, "Unique key is missing");
+            break;
+        }
+        if(!subghz_keystore_cache_crypt(payload, header->payload_size, header->iv, true)) break;
+        if(!storage_file_open(file, cache_name, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+            FURI_LOG_E(TAG, "Unable to open cache for write: %s", cache_name);
+            break;
+        }
+        if(storage_file_write(file, header, sizeof(SubGhzKeystoreCacheHeader)) !=
+               sizeof(SubGhzKeystoreCacheHeader) ||
+           storage_file_write(file, payload, header->payload_size) != header->payload_size) {
+            FURI_LOG_E(TAG, "Cache write error");
+            storage_file_close(file);
+            storage_common_remove(storage, cache_name);
+            break;
+        }
+        result = true;
+    } while(false);
+    storage_file_free(file);
+
+    memset(payload, 0, header->payload_size);
+    free(payload);
+
+    return result;
+}
+
+bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
+    furi_assert(instance);
+    bool result = false;
+
+    FURI_LOG_I(TAG, "Loading keystore %s", file_name);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FuriString* cache_name =
+        furi_string_alloc_printf("%s%s", file_name, SUBGHZ_KEYSTORE_CACHE_EXTENSION);
+    SubGhzKeystoreCacheHeader source = {0};
+    bool source_valid = subghz_keystore_cache_get_source(storage, file_name, &source);
+
+    if(source_valid &&
+       subghz_keystore_cache_load(instance, storage, furi_string_get_cstr(cache_name), &source)) {
+        FURI_LOG_I(TAG, "Loaded from cache");
+        result = true;
+    } else {
+        size_t start = SubGhzKeyArray_size(instance->data);
+        uint32_t encryption = SubGhzKeystoreEncryptionNone;
+        result = subghz_keystore_load_text(instance, storage, file_name, &encryption);
+        // Only encrypted keystores are worth compiling: they are the slow ones to parse
+        if(result && source_valid && encryption == SubGhzKeystoreEncryptionAES256) {
+            subghz_keystore_cache_save(
+                instance, storage, furi_string_get_cstr(cache_name), &source, start);
+        }
+    }
+
+    furi_string_free(cache_name);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
 bool subghz_keystore_save(SubGhzKeystore* instance, const char* file_name, uint8_t* iv) {
     furi_assert(instance);
     bool result = false;
@@ -611,3 +882,280 @@ bool subghz_keystore_raw_get_data(const char* file_name, size_t offset, uint8_t*
 
     return result;
 }
+
+typedef struct {
+    size_t index;
+    uint32_t last_used;
+    bool valid;
+    uint8_t data[SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE];
+} SubGhzKeystoreRawBlock;
+
+struct SubGhzKeystoreRawReader {
+    // First member, keeps IV word aligned for subghz_keystore_mess_with_iv
+    uint8_t iv[SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE];
+    FuriString* file_name;
+    Storage* storage;
+    FlipperFormat* flipper_format;
+    bool is_open;
+
+    size_t data_offset;
+    size_t block_count;
+    uint8_t* window;
+
+    SubGhzKeystoreRawBlock cache[SUBGHZ_KEYSTORE_RAW_CACHE_BLOCKS];
+    uint32_t cache_tick;
+};
+
+SubGhzKeystoreRawReader* subghz_keystore_raw_reader_alloc(const char* file_name) {
+    furi_assert(file_name);
+    SubGhzKeystoreRawReader* instance = malloc(sizeof(SubGhzKeystoreRawReader));
+
+    instance->file_name = furi_string_alloc_set(file_name);
+    instance->storage = furi_record_open(RECORD_STORAGE);
+    instance->flipper_format = flipper_format_file_alloc(instance->storage);
+
+    return instance;
+}
+
+void subghz_keystore_raw_reader_free(SubGhzKeystoreRawReader* instance) {
+    furi_assert(instance);
+
+    if(instance->window) {
+        memset(instance->window, 0, instance->block_count * SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE);
+        free(instance->window);
+    }
+    memset(instance->cache, 0, sizeof(instance->cache));
+
+    flipper_format_free(instance->flipper_format);
+    furi_record_close(RECORD_STORAGE);
+    furi_string_free(instance->file_name);
+
+    free(instance);
+}
+
+static bool subghz_keystore_raw_reader_read_hex(Stream* stream, uint8_t* data, size_t len) {
+    // Decoded in place, data must hold len * 2 bytes
+    if(stream_read(stream, data, len * 2) != len * 2) return false;
+    for(size_t i = 0; i < len; i++) {
+        if(!hex_char_to_uint8(data[i * 2], data[i * 2 + 1], &data[i])) return false;
+    }
+    return true;
+}
+
+static bool subghz_keystore_raw_reader_decrypt(
+    SubGhzKeystoreRawReader* instance,
+    size_t index,
+    size_t count,
+    uint8_t* output) {
+    Stream* stream = flipper_format_get_raw_stream(instance->flipper_format);
+    uint8_t buffer[SUBGHZ_KEYSTORE_RAW_READAHEAD_BLOCKS * SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE * 2];
+    uint8_t iv[SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE];
+    bool result = false;
+
+    do {
+        // CBC: IV of the block is the ciphertext of the previous one
+        if(index == 0) {
+            memcpy(iv, instance->iv, sizeof(iv));
+            if(!stream_seek(stream, instance->data_offset, StreamOffsetFromStart)) break;
+        } else {
+            size_t iv_offset = instance->data_offset + (index - 1) * sizeof(iv) * 2;
+            if(!stream_seek(stream, iv_offset, StreamOffsetFromStart)) break;
+            if(!subghz_keystore_raw_reader_read_hex(stream, buffer, sizeof(iv))) break;
+            memcpy(iv, buffer, sizeof(iv));
+        }
+
+        if(!furi_hal_crypto_enclave_load_key(SUBGHZ_KEYSTORE_FILE_ENCRYPTION_KEY_SLOT, iv)) {
+            FURI_LOG_E(TAG, "Unable to load encryption key");
+            break;
+        }
+
+        // Chaining state is kept by the hardware between calls
+        result = true;
+        while(count) {
+            size_t chunk = MIN(count, (size_t)SUBGHZ_KEYSTORE_RAW_READAHEAD_BLOCKS);
+            size_t chunk_size = chunk * SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE;
+            if(!subghz_keystore_raw_reader_read_hex(stream, buffer, chunk_size)) {
+                FURI_LOG_E(TAG, "Seek position exceeds file size");
+                result = false;
+                break;
+            }
+            if(!furi_hal_crypto_decrypt(buffer, output, chunk_size)) {
+                FURI_LOG_E(TAG, "Decryption failed");
+                result = false;
+                break;
+            }
+            output += chunk_size;
+            count -= chunk;
+        }
+        memset(buffer, 0, sizeof(buffer));
+
+        furi_hal_crypto_enclave_unload_key(SUBGHZ_KEYSTORE_FILE_ENCRYPTION_KEY_SLOT);
+    } while(false);
+
+    return result;
+}
+
+static bool subghz_keystore_raw_reader_open(SubGhzKeystoreRawReader* instance) {
+    const char* file_name = furi_string_get_cstr(instance->file_name);
+    bool result = false;
+    uint32_t version;
+    uint32_t encryption;
+
+    FuriString* str_temp;
+    str_temp = furi_string_alloc();
+
+    do {
+        if(!flipper_format_file_open_existing(instance->flipper_format, file_name)) {
+            FURI_LOG_E(TAG, "Unable to open file for read: %s", file_name);
+            break;
+        }
+        if(!flipper_format_read_header(instance->flipper_format, str_temp, &version)) {
+            FURI_LOG_E(TAG, "Missing or incorrect header");
+            break;
+        }
+        if(!flipper_format_read_uint32(instance->flipper_format, "Encryption", &encryption, 1)) {
+            FURI_LOG_E(TAG, "Missing encryption type");
+            break;
+        }
+
+        if(strcmp(furi_string_get_cstr(str_temp), SUBGHZ_KEYSTORE_FILE_RAW_TYPE) != 0 ||
+           version != SUBGHZ_KEYSTORE_FILE_VERSION) {
+            FURI_LOG_E(TAG, "Type or version mismatch");
+            break;
+        }
+
+        if(encryption != SubGhzKeystoreEncryptionAES256) {
+            FURI_LOG_E(TAG, "Unknown encryption");
+            break;
+        }
+
+        if(!flipper_format_read_hex(instance->flipper_format, "IV", instance->iv, 16)) {
+            FURI_LOG_E(TAG, "Missing IV");
+            break;
+        }
+        subghz_keystore_mess_with_iv(instance->iv);
+
+        if(!flipper_format_read_string(instance->flipper_format, "Encrypt_data", str_temp)) {
+            FURI_LOG_E(TAG, "Missing Encrypt_data");
+            break;
+        }
+
+        Stream* stream = flipper_format_get_raw_stream(instance->flipper_format);
+        //skip the end of the previous line "\n"
+        stream_seek(stream, 1, StreamOffsetFromCurrent);
+        instance->data_offset = stream_tell(stream);
+        instance->block_count = (stream_size(stream) - instance->data_offset) /
+                                (SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE * 2);
+        if(!instance->block_count) {
+            FURI_LOG_E(TAG, "Missing RAW data");
+            break;
+        }
+
+        size_t table_size = instance->block_count * SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE;
+        if(table_size <= SUBGHZ_KEYSTORE_RAW_WINDOW_SIZE_MAX &&
+           memmgr_get_free_heap() > table_size + SUBGHZ_KEYSTORE_RAW_WINDOW_HEAP_RESERVE) {
+            instance->window = malloc(table_size);
+            if(!subghz_keystore_raw_reader_decrypt(
+                   instance, 0, instance->block_count, instance->window)) {
+                free(instance->window);
+                instance->window = NULL;
+                break;
+            }
+            // Whole table is in RAM, file is not needed anymore
+            flipper_format_file_close(instance->flipper_format);
+        }
+
+        instance->is_open = true;
+        result = true;
+    } while(false);
+
+    if(!result) flipper_format_file_close(instance->flipper_format);
+
+    furi_string_free(str_temp);
+
+    return result;
+}
+
+static const uint8_t*
+    subghz_keystore_raw_reader_get_block(SubGhzKeystoreRawReader* instance, size_t index) {
+    SubGhzKeystoreRawBlock* block = NULL;
+    for(size_t i = 0; i < SUBGHZ_KEYSTORE_RAW_CACHE_BLOCKS; i++) {
+        if(instance->cache[i].valid && instance->cache[i].index == index) {
+            block = &instance->cache[i];
+            break;
+        }
+    }
+
+    if(!block) {
+        uint8_t buffer[SUBGHZ_KEYSTORE_RAW_READAHEAD_BLOCKS * SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE];
+        size_t count = MIN(
+            (size_t)SUBGHZ_KEYSTORE_RAW_READAHEAD_BLOCKS, instance->block_count - index);
+        if(!subghz_keystore_raw_reader_decrypt(instance, index, count, buffer)) {
+            return NULL;
+        }
+
+        // Requested block goes last, so it is the most recent one
+        for(size_t j = count; j-- > 0;) {
+            block = &instance->cache[0];
+            for(size_t i = 0; i < SUBGHZ_KEYSTORE_RAW_CACHE_BLOCKS; i++) {
+                SubGhzKeystoreRawBlock* item = &instance->cache[i];
+                if(item->valid && item->index == index + j) {
+                    block = item;
+                    break;
+                }
+                if(block->valid && (!item->valid || item->last_used < block->last_used)) {
+                    block = item;
+                }
+            }
+            block->index = index + j;
+            block->valid = true;
+            block->last_used = instance->cache_tick++;
+            memcpy(
+                block->data,
+                &buffer[j * SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE],
+                SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE);
+        }
+        memset(buffer, 0, sizeof(buffer));
+    }
+
+    block->last_used = instance->cache_tick++;
+    return block->data;
+}
+
+bool subghz_keystore_raw_reader_get_data(
+    SubGhzKeystoreRawReader* instance,
+    size_t offset,
+    uint8_t* data,
+    size_t len) {
+    furi_assert(instance);
+    furi_assert(data);
+
+    if(!instance->is_open && !subghz_keystore_raw_reader_open(instance)) {
+        return false;
+    }
+
+    if(offset + len > instance->block_count * SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE) {
+        FURI_LOG_E(TAG, "Seek position exceeds file size");
+        return false;
+    }
+
+    if(instance->window) {
+        memcpy(data, &instance->window[offset], len);
+        return true;
+    }
+
+    while(len) {
+        size_t index = offset / SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE;
+        const uint8_t* block = subghz_keystore_raw_reader_get_block(instance, index);
+        if(!block) return false;
+
+        size_t block_offset = offset % SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE;
+        size_t chunk = MIN(len, SUBGHZ_KEYSTORE_RAW_BLOCK_SIZE - block_offset);
+        memcpy(data, block + block_offset, chunk);
+        data += chunk;
+        offset += chunk;
+        len -= chunk;
+    }
+
+    return true;
+}
@@ -19,6 +19,7 @@ ARRAY_DEF(SubGhzKeyArray, SubGhzKey, M_POD_OPLIST)
 #define M_OPL_SubGhzKeyArray_t() ARRAY_OPLIST(SubGhzKeyArray, M_POD_OPLIST)
 
 typedef struct SubGhzKeystore SubGhzKeystore;
+typedef struct SubGhzKeystoreRawReader SubGhzKeystoreRawReader;
 
 /**
  * Allocate SubGhzKeystore.
@@ -75,6 +76,35 @@ bool subghz_keystore_raw_encrypted_save(
  */
 bool subghz_keystore_raw_get_data(const char* file_name, size_t offset, uint8_t* data, size_t len);
 
+/**
+ * Allocate SubGhzKeystoreRawReader.
+ * File is opened on first access and kept open, decrypted blocks are cached,
+ * small tables are decrypted once as a whole.
+ * @param file_name Full path to the encrypted RAW file
+ * @return SubGhzKeystoreRawReader* pointer to a SubGhzKeystoreRawReader instance
+ */
+SubGhzKeystoreRawReader* subghz_keystore_raw_reader_alloc(const char* file_name);
+
+/**
+ * Free SubGhzKeystoreRawReader.
+ * @param instance Pointer to a SubGhzKeystoreRawReader instance
+ */
+void subghz_keystore_raw_reader_free(SubGhzKeystoreRawReader* instance);
+
+/** 
+ * Get decrypt RAW data through the reader cache
+ * @param instance Pointer to a SubGhzKeystoreRawReader instance
+ * @param offset Offset from the start of the RAW data
+ * @param data Returned array
+ * @param len Required data length
+ * @return true On success
+ */
+bool subghz_keystore_raw_reader_get_data(
+    SubGhzKeystoreRawReader* instance,
+    size_t offset,
+    uint8_t* data,
+    size_t len);
+
 #ifdef __cplusplus
 }
 #endif
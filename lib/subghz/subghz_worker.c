@@ -4,9 +4,31 @@
 
 #define TAG "SubGhzWorker"
 
+#define SUBGHZ_WORKER_RING_SIZE 4096U // must be a power of 2
+#define SUBGHZ_WORKER_RING_MASK (SUBGHZ_WORKER_RING_SIZE - 1)
+#define SUBGHZ_WORKER_RING_HIGH_WATER (SUBGHZ_WORKER_RING_SIZE / 8)
+#define SUBGHZ_WORKER_DRAIN_BATCH 64U
+#define SUBGHZ_WORKER_IDLE_TIMEOUT_MS 5
+
+#define SUBGHZ_WORKER_FLAG_DATA (1UL << 0)
+
+typedef struct {
+    uint32_t edges; // Edges received from the radio
+    uint32_t dropped; // Edges lost because the ring was full
+    uint32_t overruns; // Ring full events
+    uint32_t max_fill; // Peak ring fill seen by the worker thread
+} SubGhzWorkerStats;
+
 struct SubGhzWorker {
     FuriThread* thread;
-    FuriStreamBuffer* stream;
+    // Set while the producer may post edges, NULL before start and after stop
+    FuriThreadId volatile thread_id;
+
+    // Single producer (radio ISR), single consumer (worker thread) ring
+    LevelDuration* ring;
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    SubGhzWorkerStats stats;
 
     volatile bool running;
     volatile bool overrun;
@@ -28,14 +50,61 @@ struct SubGhzWorker {
 void subghz_worker_rx_callback(bool level, uint32_t duration, void* context) {
     SubGhzWorker* instance = context;
 
+    // Radio may deliver edges before start or after stop, the ring isn't ours then
+    FuriThreadId thread_id = instance->thread_id;
+    if(!thread_id) return;
+
+    uint32_t head = instance->head;
+    uint32_t fill = head - instance->tail;
+    instance->stats.edges++;
+
+    if(fill >= SUBGHZ_WORKER_RING_SIZE) {
+        if(!instance->overrun) instance->stats.overruns++;
+        instance->stats.dropped++;
+        instance->overrun = true;
+        return;
+    }
+
     LevelDuration level_duration = level_duration_make(level, duration);
     if(instance->overrun) {
         instance->overrun = false;
+        instance->stats.dropped++;
         level_duration = level_duration_reset();
     }
-    size_t ret =
-        furi_stream_buffer_send(instance->stream, &level_duration, sizeof(LevelDuration), 0);
-    if(sizeof(LevelDuration) != ret) instance->overrun = true;
+    instance->ring[head & SUBGHZ_WORKER_RING_MASK] = level_duration;
+    // Publish the slot only after it is written
+    __DMB();
+    instance->head = head + 1;
+
+    // Consumer polls on idle timeout, wake it up only on the high-water mark or overrun
+    if(fill + 1 == SUBGHZ_WORKER_RING_HIGH_WATER || level_duration_is_reset(level_duration)) {
+        furi_thread_flags_set(thread_id, SUBGHZ_WORKER_FLAG_DATA);
+    }
+}
+
+static void subghz_worker_process(SubGhzWorker* instance, LevelDuration level_duration) {
+    if(level_duration_is_reset(level_duration)) {
+        FURI_LOG_E(TAG, "Overrun buffer");
+        if(instance->overrun_callback) instance->overrun_callback(instance->context);
+    } else {
+        bool level = level_duration_get_level(level_duration);
+        uint32_t duration = level_duration_get_duration(level_duration);
+
+        if((duration < instance->filter_duration) ||
+           (instance->filter_level_duration.level == level)) {
+            instance->filter_level_duration.duration += duration;
+
+        } else if(instance->filter_level_duration.level != level) {
+            if(instance->pair_callback)
+                instance->pair_callback(
+                    instance->context,
+                    instance->filter_level_duration.level,
+                    instance->filter_level_duration.duration);
+
+            instance->filter_level_duration.duration = duration;
+            instance->filter_level_duration.level = level;
+        }
+    }
 }
 
 /** Worker callback thread
@@ -46,34 +115,45 @@ void subghz_worker_rx_callback(bool level, uint32_t duration, void* context) {
 static int32_t subghz_worker_thread_callback(void* context) {
     SubGhzWorker* instance = context;
 
-    LevelDuration level_duration;
     while(instance->running) {
-        int ret = furi_stream_buffer_receive(
-            instance->stream, &level_duration, sizeof(LevelDuration), 10);
-        if(ret == sizeof(LevelDuration)) {
-            if(level_duration_is_reset(level_duration)) {
-                FURI_LOG_E(TAG, "Overrun buffer");
-                if(instance->overrun_callback) instance->overrun_callback(instance->context);
-            } else {
-                bool level = level_duration_get_level(level_duration);
-                uint32_t duration = level_duration_get_duration(level_duration);
-
-                if((duration < instance->filter_duration) ||
-                   (instance->filter_level_duration.level == level)) {
-                    instance->filter_level_duration.duration += duration;
-
-                } else if(instance->filter_level_duration.level != level) {
-                    if(instance->pair_callback)
-                        instance->pair_callback(
-                            instance->context,
-                            instance->filter_level_duration.level,
-                            instance->filter_level_duration.duration);
-
-                    instance->filter_level_duration.duration = duration;
-                    instance->filter_level_duration.level = level;
-                }
+        furi_thread_flags_wait(
+            SUBGHZ_WORKER_FLAG_DATA, FuriFlagWaitAny, SUBGHZ_WORKER_IDLE_TIMEOUT_MS);
+
+        uint32_t tail = instance->tail;
+        uint32_t head = instance->head;
+        __DMB();
+
+        uint32_t fill = head - tail;
+        if(fill > instance->stats.max_fill) instance->stats.max_fill = fill;
+
+        while(tail != head && instance->running) {
+            subghz_worker_process(instance, instance->ring[tail & SUBGHZ_WORKER_RING_MASK]);
+            tail++;
+            // Give slots back to the producer in batches
+            if((tail % SUBGHZ_WORKER_DRAIN_BATCH) == 0) {
+                __DMB();
+                instance->tail = tail;
             }
         }
+        __DMB();
+        instance->tail = tail;
+    }
+
+    if(instance->stats.overruns) {
+        FURI_LOG_W(
+            TAG,
+            "Overruns: %lu, dropped %lu of %lu edges, peak fill %lu",
+            instance->stats.overruns,
+            instance->stats.dropped,
+            instance->stats.edges,
+            instance->stats.max_fill);
+    } else {
+        FURI_LOG_D(
+            TAG,
+            "Received %lu edges, peak fill %lu of %u",
+            instance->stats.edges,
+            instance->stats.max_fill,
+            SUBGHZ_WORKER_RING_SIZE);
     }
 
     return 0;
@@ -85,8 +165,7 @@ SubGhzWorker* subghz_worker_alloc() {
     instance->thread =
         furi_thread_alloc_ex("SubGhzWorker", 2048, subghz_worker_thread_callback, instance);
 
-    instance->stream =
-        furi_stream_buffer_alloc(sizeof(LevelDuration) * 4096, sizeof(LevelDuration));
+    instance->ring = malloc(sizeof(LevelDuration) * SUBGHZ_WORKER_RING_SIZE);
 
     //setting default filter in us
     instance->filter_duration = 30;
@@ -97,7 +176,7 @@ SubGhzWorker* subghz_worker_alloc() {
 void subghz_worker_free(SubGhzWorker* instance) {
     furi_assert(instance);
 
-    furi_stream_buffer_free(instance->stream);
+    free(instance->ring);
     furi_thread_free(instance->thread);
 
     free(instance);
@@ -124,17 +203,31 @@ void subghz_worker_start(SubGhzWorker* instance) {
     furi_assert(instance);
     furi_assert(!instance->running);
 
+    instance->head = 0;
+    instance->tail = 0;
+    instance->overrun = false;
+    memset(&instance->stats, 0, sizeof(SubGhzWorkerStats));
+
     instance->running = true;
 
     furi_thread_start(instance->thread);
+    // Ring is reset, let the producer in
+    __DMB();
+    instance->thread_id = furi_thread_get_id(instance->thread);
 }
 
 void subghz_worker_stop(SubGhzWorker* instance) {
     furi_assert(instance);
     furi_assert(instance->running);
 
+    // Producer runs in ISR, after this it can't see the thread id anymore
+    FURI_CRITICAL_ENTER();
+    FuriThreadId thread_id = instance->thread_id;
+    instance->thread_id = NULL;
     instance->running = false;
+    FURI_CRITICAL_EXIT();
 
+    furi_thread_flags_set(thread_id, SUBGHZ_WORKER_FLAG_DATA);
     furi_thread_join(instance->thread);
 }
 
@@ -146,4 +239,4 @@ bool subghz_worker_is_running(SubGhzWorker* instance) {
 void subghz_worker_set_filter(SubGhzWorker* instance, uint16_t timeout) {
     furi_assert(instance);
     instance->filter_duration = timeout;
-}
\ No newline at end of file
+}
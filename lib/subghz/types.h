@@ -21,6 +21,7 @@
 
 #define SUBGHZ_RAW_FILE_VERSION 1
 #define SUBGHZ_RAW_FILE_TYPE "Flipper SubGhz RAW File"
+#define SUBGHZ_RAW_FILE_BIN_DATA_KEY "RAW_Bin_Data"
 
 #define SUBGHZ_KEYSTORE_DIR_NAME EXT_PATH("subghz/assets/keeloq_mfcodes")
 #define SUBGHZ_KEYSTORE_DIR_USER_NAME EXT_PATH("subghz/assets/keeloq_mfcodes_user")
@@ -75,12 +76,28 @@ typedef SubGhzProtocolStatus (*SubGhzDeserialize)(void* context, FlipperFormat*
 typedef void (*SubGhzDecoderFeed)(void* decoder, bool level, uint32_t duration);
 typedef void (*SubGhzDecoderReset)(void* decoder);
 typedef uint8_t (*SubGhzGetHashData)(void* decoder);
+typedef uint64_t (*SubGhzGetHashDataLong)(void* decoder);
 typedef void (*SubGhzGetString)(void* decoder, FuriString* output);
+typedef bool (*SubGhzDecoderIsIdle)(void* decoder);
 
 // Encoder specific
 typedef void (*SubGhzEncoderStop)(void* encoder);
 typedef LevelDuration (*SubGhzEncoderYield)(void* context);
 
+/**
+ * Frame start condition of a decoder, used by SubGhzReceiver dispatch index.
+ * Edge matches when level is equal and
+ * DURATION_DIFF(*te * te_count, edge) < *te_delta * te_delta_count.
+ * Timings point into the protocol SubGhzBlockConst, so they follow the decoder.
+ */
+typedef struct {
+    bool level;
+    const uint16_t* te;
+    uint16_t te_count;
+    const uint16_t* te_delta;
+    uint16_t te_delta_count;
+} SubGhzProtocolDecoderWakeup;
+
 typedef struct {
     SubGhzAlloc alloc;
     SubGhzFree free;
@@ -92,6 +109,13 @@ typedef struct {
     SubGhzGetString get_string;
     SubGhzSerialize serialize;
     SubGhzDeserialize deserialize;
+
+    // Optional dispatch hints, decoder is fed on every edge if not set
+    const SubGhzProtocolDecoderWakeup* wakeup;
+    SubGhzDecoderIsIdle is_idle;
+
+    // Optional fingerprint for repeat suppression, get_hash_data is used if not set
+    SubGhzGetHashDataLong get_hash_data_long;
 } SubGhzProtocolDecoder;
 
 typedef struct {
@@ -10,6 +10,14 @@
 /** Defines encoder and decoder lookahead buffer size */
 #define COMPRESS_LOOKAHEAD_BUFF_SIZE_LOG (4u)
 
+/** Streaming encoder parameters, decoder takes them from the stream header */
+#define COMPRESS_STREAM_WINDOW_SZ2 (10u)
+#define COMPRESS_STREAM_LOOKAHEAD_SZ2 (5u)
+#define COMPRESS_STREAM_WINDOW_SZ2_MIN (4u)
+#define COMPRESS_STREAM_WINDOW_SZ2_MAX (13u)
+#define COMPRESS_STREAM_LOOKAHEAD_SZ2_MIN (3u)
+#define COMPRESS_STREAM_DECODER_INPUT_SIZE (256u)
+
 /** Buffer sizes for input and output data */
 #define COMPRESS_ICON_ENCODED_BUFF_SIZE (1024u)
 #define COMPRESS_ICON_DECODED_BUFF_SIZE (1024u)
@@ -249,7 +257,7 @@ bool compress_decode(
         *data_res_size = res_buff_size;
         result = !decode_failed;
     } else if(data_out_size >= data_in_size - 1) {
-        memcpy(data_out, &data_in[1], data_in_size);
+        memcpy(data_out, &data_in[1], data_in_size - 1);
         *data_res_size = data_in_size - 1;
         result = true;
     } else {
@@ -259,3 +267,279 @@ bool compress_decode(
 
     return result;
 }
+
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t window_sz2;
+    uint8_t lookahead_sz2;
+    uint8_t reserved;
+} FURI_PACKED CompressStreamHeader;
+
+_Static_assert(sizeof(CompressStreamHeader) == 8, "Incorrect CompressStreamHeader size");
+
+struct CompressStreamEncoder {
+    heatshrink_encoder* encoder;
+    CompressIoCallback write_cb;
+    void* context;
+    uint8_t* buffer;
+    size_t buffer_size;
+    bool header_written;
+};
+
+CompressStreamEncoder* compress_stream_encoder_alloc(
+    CompressIoCallback write_cb,
+    void* context,
+    size_t io_buffer_size) {
+    furi_assert(write_cb);
+    furi_check(io_buffer_size);
+
+    CompressStreamEncoder* encoder = malloc(sizeof(CompressStreamEncoder));
+    encoder->encoder =
+        heatshrink_encoder_alloc(COMPRESS_STREAM_WINDOW_SZ2, COMPRESS_STREAM_LOOKAHEAD_SZ2);
+    encoder->write_cb = write_cb;
+    encoder->context = context;
+    encoder->buffer_size = io_buffer_size;
+    encoder->buffer = malloc(io_buffer_size);
+
+    return encoder;
+}
+
+void compress_stream_encoder_free(CompressStreamEncoder* encoder) {
+    furi_assert(encoder);
+
+    heatshrink_encoder_free(encoder->encoder);
+    free(encoder->buffer);
+    free(encoder);
+}
+
+static bool compress_stream_encoder_write_header(CompressStreamEncoder* encoder) {
+    if(encoder->header_written) {
+        return true;
+    }
+
+    CompressStreamHeader header = {
+        .magic = COMPRESS_STREAM_MAGIC,
+        .version = COMPRESS_STREAM_VERSION,
+        .window_sz2 = COMPRESS_STREAM_WINDOW_SZ2,
+        .lookahead_sz2 = COMPRESS_STREAM_LOOKAHEAD_SZ2,
+        .reserved = 0,
+    };
+    encoder->header_written =
+        encoder->write_cb(encoder->context, (uint8_t*)&header, sizeof(header)) ==
+        (int32_t)sizeof(header);
+
+    return encoder->header_written;
+}
+
+static bool compress_stream_encoder_poll(CompressStreamEncoder* encoder) {
+    HSE_poll_res poll_res;
+    do {
+        size_t poll_size = 0;
+        poll_res = heatshrink_encoder_poll(
+            encoder->encoder, encoder->buffer, encoder->buffer_size, &poll_size);
+        if(poll_res < 0) {
+            return false;
+        }
+        if(poll_size &&
+           encoder->write_cb(encoder->context, encoder->buffer, poll_size) != (int32_t)poll_size) {
+            return false;
+        }
+    } while(poll_res == HSER_POLL_MORE);
+
+    return true;
+}
+
+bool compress_stream_encoder_write(
+    CompressStreamEncoder* encoder,
+    const uint8_t* data,
+    size_t size) {
+    furi_assert(encoder);
+
+    if(!compress_stream_encoder_write_header(encoder)) {
+        return false;
+    }
+
+    while(size) {
+        size_t sink_size = 0;
+        if(heatshrink_encoder_sink(encoder->encoder, (uint8_t*)data, size, &sink_size) < 0) {
+            return false;
+        }
+        data += sink_size;
+        size -= sink_size;
+
+        if(!compress_stream_encoder_poll(encoder)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool compress_stream_encoder_finish(CompressStreamEncoder* encoder) {
+    furi_assert(encoder);
+
+    if(!compress_stream_encoder_write_header(encoder)) {
+        return false;
+    }
+
+    HSE_finish_res finish_res;
+    do {
+        finish_res = heatshrink_encoder_finish(encoder->encoder);
+        if(finish_res < 0 || !compress_stream_encoder_poll(encoder)) {
+            return false;
+        }
+    } while(finish_res != HSER_FINISH_DONE);
+
+    return true;
+}
+
+struct CompressStreamDecoder {
+    heatshrink_decoder* decoder;
+    CompressIoCallback read_cb;
+    void* context;
+    uint8_t* buffer;
+    size_t buffer_size;
+    size_t buffer_pos;
+    size_t buffer_len;
+    size_t position;
+    bool input_end;
+    bool finished;
+};
+
+CompressStreamDecoder* compress_stream_decoder_alloc(
+    CompressIoCallback read_cb,
+    void* context,
+    size_t io_buffer_size) {
+    furi_assert(read_cb);
+    furi_check(io_buffer_size >= sizeof(CompressStreamHeader));
+
+    CompressStreamDecoder* decoder = malloc(sizeof(CompressStreamDecoder));
+    decoder->read_cb = read_cb;
+    decoder->context = context;
+    decoder->buffer_size = io_buffer_size;
+    decoder->buffer = malloc(io_buffer_size);
+
+    return decoder;
+}
+
+void compress_stream_decoder_free(CompressStreamDecoder* decoder) {
+    furi_assert(decoder);
+
+    compress_stream_decoder_reset(decoder);
+    free(decoder->buffer);
+    free(decoder);
+}
+
+void compress_stream_decoder_reset(CompressStreamDecoder* decoder) {
+    furi_assert(decoder);
+
+    /* Parameters may change with the next header */
+    if(decoder->decoder) {
+        heatshrink_decoder_free(decoder->decoder);
+        decoder->decoder = NULL;
+    }
+    decoder->buffer_pos = 0;
+    decoder->buffer_len = 0;
+    decoder->position = 0;
+    decoder->input_end = false;
+    decoder->finished = false;
+}
+
+static bool compress_stream_decoder_fill(CompressStreamDecoder* decoder) {
+    int32_t read_size = decoder->read_cb(decoder->context, decoder->buffer, decoder->buffer_size);
+    if(read_size < 0) {
+        return false;
+    }
+
+    decoder->buffer_pos = 0;
+    decoder->buffer_len = read_size;
+    decoder->input_end = (read_size == 0);
+    return true;
+}
+
+static bool compress_stream_decoder_read_header(CompressStreamDecoder* decoder) {
+    CompressStreamHeader header;
+    size_t header_size = 0;
+
+    while(header_size < sizeof(header)) {
+        if(decoder->buffer_pos == decoder->buffer_len) {
+            if(!compress_stream_decoder_fill(decoder) || decoder->input_end) {
+                return false;
+            }
+        }
+        const size_t chunk = MIN(
+            sizeof(header) - header_size, decoder->buffer_len - decoder->buffer_pos);
+        memcpy((uint8_t*)&header + header_size, &decoder->buffer[decoder->buffer_pos], chunk);
+        decoder->buffer_pos += chunk;
+        header_size += chunk;
+    }
+
+    if((header.magic != COMPRESS_STREAM_MAGIC) || (header.version != COMPRESS_STREAM_VERSION) ||
+       (header.window_sz2 < COMPRESS_STREAM_WINDOW_SZ2_MIN) ||
+       (header.window_sz2 > COMPRESS_STREAM_WINDOW_SZ2_MAX) ||
+       (header.lookahead_sz2 < COMPRESS_STREAM_LOOKAHEAD_SZ2_MIN) ||
+       (header.lookahead_sz2 >= header.window_sz2)) {
+        return false;
+    }
+
+    decoder->decoder = heatshrink_decoder_alloc(
+        COMPRESS_STREAM_DECODER_INPUT_SIZE, header.window_sz2, header.lookahead_sz2);
+    return true;
+}
+
+int32_t compress_stream_decoder_read(CompressStreamDecoder* decoder, uint8_t* data, size_t size) {
+    furi_assert(decoder);
+    furi_assert(data);
+
+    if(!decoder->decoder && !compress_stream_decoder_read_header(decoder)) {
+        return -1;
+    }
+
+    size_t done = 0;
+    while((done < size) && !decoder->finished) {
+        size_t poll_size = 0;
+        HSD_poll_res poll_res =
+            heatshrink_decoder_poll(decoder->decoder, &data[done], size - done, &poll_size);
+        if(poll_res < 0) {
+            return -1;
+        }
+        done += poll_size;
+        if((done == size) || (poll_res == HSDR_POLL_MORE)) {
+            continue;
+        }
+
+        /* Decoder wants more input */
+        if(decoder->buffer_pos == decoder->buffer_len) {
+            if(!decoder->input_end && !compress_stream_decoder_fill(decoder)) {
+                return -1;
+            }
+            if(decoder->input_end) {
+                HSD_finish_res finish_res = heatshrink_decoder_finish(decoder->decoder);
+                if(finish_res < 0) {
+                    return -1;
+                }
+                decoder->finished = (finish_res == HSDR_FINISH_DONE);
+                continue;
+            }
+        }
+
+        size_t sink_size = 0;
+        if(heatshrink_decoder_sink(
+               decoder->decoder,
+               &decoder->buffer[decoder->buffer_pos],
+               decoder->buffer_len - decoder->buffer_pos,
+               &sink_size) < 0) {
+            return -1;
+        }
+        decoder->buffer_pos += sink_size;
+    }
+
+    decoder->position += done;
+    return done;
+}
+
+size_t compress_stream_decoder_tell(CompressStreamDecoder* decoder) {
+    furi_assert(decoder);
+    return decoder->position;
+}
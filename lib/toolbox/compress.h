@@ -91,6 +91,112 @@ bool compress_decode(
     size_t data_out_size,
     size_t* data_res_size);
 
+/** Heatshrink stream header magic, "HSDS" */
+#define COMPRESS_STREAM_MAGIC (0x53445348UL)
+#define COMPRESS_STREAM_VERSION (1U)
+
+/** Stream IO callback
+ *
+ * @param   context callback context
+ * @param   buffer data to write or buffer to read into
+ * @param   size size of data or buffer
+ *
+ * @return  number of bytes transferred, 0 at the end of input, negative on error
+ */
+typedef int32_t (*CompressIoCallback)(void* context, uint8_t* buffer, size_t size);
+
+/** Streaming encoder control structure */
+typedef struct CompressStreamEncoder CompressStreamEncoder;
+
+/** Allocate streaming encoder
+ *
+ * Output starts with a header that holds the stream parameters.
+ *
+ * @param   write_cb callback to pass encoded data to
+ * @param   context callback context
+ * @param   io_buffer_size size of the output buffer, amount passed to write_cb at once
+ *
+ * @return  CompressStreamEncoder instance
+ */
+CompressStreamEncoder* compress_stream_encoder_alloc(
+    CompressIoCallback write_cb,
+    void* context,
+    size_t io_buffer_size);
+
+/** Free streaming encoder, without finishing the stream
+ *
+ * @param   encoder CompressStreamEncoder instance
+ */
+void compress_stream_encoder_free(CompressStreamEncoder* encoder);
+
+/** Encode data
+ *
+ * @param   encoder CompressStreamEncoder instance
+ * @param   data data to encode
+ * @param   size size of data
+ *
+ * @return  true on success
+ */
+bool compress_stream_encoder_write(
+    CompressStreamEncoder* encoder,
+    const uint8_t* data,
+    size_t size);
+
+/** Flush remaining data, no more data can be written after that
+ *
+ * @param   encoder CompressStreamEncoder instance
+ *
+ * @return  true on success
+ */
+bool compress_stream_encoder_finish(CompressStreamEncoder* encoder);
+
+/** Streaming decoder control structure */
+typedef struct CompressStreamDecoder CompressStreamDecoder;
+
+/** Allocate streaming decoder
+ *
+ * @param   read_cb callback to get encoded data from
+ * @param   context callback context
+ * @param   io_buffer_size size of the input buffer, amount requested from read_cb at once
+ *
+ * @return  CompressStreamDecoder instance
+ */
+CompressStreamDecoder* compress_stream_decoder_alloc(
+    CompressIoCallback read_cb,
+    void* context,
+    size_t io_buffer_size);
+
+/** Free streaming decoder
+ *
+ * @param   decoder CompressStreamDecoder instance
+ */
+void compress_stream_decoder_free(CompressStreamDecoder* decoder);
+
+/** Start over, read_cb must return the stream from its header again
+ *
+ * @param   decoder CompressStreamDecoder instance
+ */
+void compress_stream_decoder_reset(CompressStreamDecoder* decoder);
+
+/** Decode data
+ *
+ * @param   decoder CompressStreamDecoder instance
+ * @param   data buffer for decoded data
+ * @param   size size of buffer
+ *
+ * @return  number of decoded bytes, less than size only at the end of the stream,
+ *          negative on error
+ */
+int32_t compress_stream_decoder_read(CompressStreamDecoder* decoder, uint8_t* data, size_t size);
+
+/** Get number of bytes decoded since the start of the stream
+ *
+ * @param   decoder CompressStreamDecoder instance
+ *
+ * @return  position in decoded data
+ */
+size_t compress_stream_decoder_tell(CompressStreamDecoder* decoder);
+
 #ifdef __cplusplus
 }
 #endif
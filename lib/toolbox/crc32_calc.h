@@ -7,8 +7,22 @@
 extern "C" {
 #endif
 
+/** Continue CRC32 calculation, hardware accelerated for large buffers
+ * @param crc CRC32 of the previous data, 0 to start
+ * @param buffer
+ * @param size
+ * @return uint32_t
+ */
 uint32_t crc32_calc_buffer(uint32_t crc, const void* buffer, size_t size);
 
+/** Continue CRC32 calculation in software, slice-by-8
+ * @param crc CRC32 of the previous data, 0 to start
+ * @param buffer
+ * @param size
+ * @return uint32_t
+ */
+uint32_t crc32_calc_buffer_soft(uint32_t crc, const void* buffer, size_t size);
+
 typedef void (*FileCrcProgressCb)(const uint8_t progress, void* context);
 
 uint32_t crc32_calc_file(File* file, const FileCrcProgressCb progress_cb, void* context);
@@ -0,0 +1,133 @@
+#include "hasher.h"
+#include "crc32_calc.h"
+
+#include <furi.h>
+#include <mbedtls/md5.h>
+
+#define HASHER_FILE_BLOCK_SIZE (4096U)
+
+struct Hasher {
+    uint32_t types;
+    uint64_t size;
+    uint32_t crc32;
+    mbedtls_md5_context md5;
+    bool md5_finished;
+};
+
+Hasher* hasher_alloc(uint32_t types) {
+    furi_check(types);
+
+    Hasher* hasher = malloc(sizeof(Hasher));
+    hasher->types = types;
+    mbedtls_md5_init(&hasher->md5);
+    hasher_reset(hasher);
+
+    return hasher;
+}
+
+void hasher_free(Hasher* hasher) {
+    furi_assert(hasher);
+    mbedtls_md5_free(&hasher->md5);
+    free(hasher);
+}
+
+void hasher_reset(Hasher* hasher) {
+    furi_assert(hasher);
+    hasher->size = 0;
+    hasher->crc32 = 0;
+    if(hasher->types & HasherTypeMd5) {
+        mbedtls_md5_starts(&hasher->md5);
+    }
+    hasher->md5_finished = false;
+}
+
+void hasher_update(Hasher* hasher, const void* data, size_t size) {
+    furi_assert(hasher);
+    furi_check(!hasher->md5_finished);
+
+    if(hasher->types & HasherTypeCrc32) {
+        hasher->crc32 = crc32_calc_buffer(hasher->crc32, data, size);
+    }
+    if(hasher->types & HasherTypeMd5) {
+        mbedtls_md5_update(&hasher->md5, data, size);
+    }
+    hasher->size += size;
+}
+
+bool hasher_update_file(
+    Hasher* hasher,
+    File* file,
+    HasherProgressCallback progress_cb,
+    void* context) {
+    furi_assert(hasher);
+    furi_check(storage_file_is_open(file));
+
+    const uint64_t file_start = storage_file_tell(file);
+    const uint64_t file_left = storage_file_size(file) - file_start;
+    uint64_t done = 0;
+    bool result = true;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    StorageBatch* batch = storage_batch_alloc(storage);
+    uint8_t* buffers[2] = {malloc(HASHER_FILE_BLOCK_SIZE), malloc(HASHER_FILE_BLOCK_SIZE)};
+    size_t current = 0;
+
+    storage_batch_add_read(batch, file, buffers[current], HASHER_FILE_BLOCK_SIZE);
+    storage_batch_submit(batch);
+
+    while(true) {
+        storage_batch_wait(batch, FuriWaitForever);
+        const size_t read_size = storage_batch_get_result(batch, 0);
+        if(storage_batch_get_error(batch, 0) != FSE_OK) {
+            result = false;
+            break;
+        }
+
+        // Read the next block while this one is hashed
+        const bool last = (read_size < HASHER_FILE_BLOCK_SIZE);
+        if(!last) {
+            storage_batch_reset(batch);
+            storage_batch_add_read(batch, file, buffers[current ^ 1], HASHER_FILE_BLOCK_SIZE);
+            storage_batch_submit(batch);
+        }
+
+        hasher_update(hasher, buffers[current], read_size);
+        done += read_size;
+
+        if(progress_cb && file_left) {
+            progress_cb(MIN(done, file_left) * 100 / file_left, context);
+        }
+
+        if(last) {
+            break;
+        }
+        current ^= 1;
+    }
+
+    free(buffers[1]);
+    free(buffers[0]);
+    storage_batch_free(batch);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
+uint64_t hasher_get_size(Hasher* hasher) {
+    furi_assert(hasher);
+    return hasher->size;
+}
+
+uint32_t hasher_get_crc32(Hasher* hasher) {
+    furi_assert(hasher);
+    furi_check(hasher->types & HasherTypeCrc32);
+    return hasher->crc32;
+}
+
+void hasher_get_md5(Hasher* hasher, uint8_t md5[HASHER_MD5_SIZE]) {
+    furi_assert(hasher);
+    furi_check(hasher->types & HasherTypeMd5);
+    furi_check(!hasher->md5_finished);
+
+    mbedtls_md5_finish(&hasher->md5, md5);
+    hasher->md5_finished = true;
+}
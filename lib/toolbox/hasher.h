@@ -0,0 +1,91 @@
+/**
+ * @file hasher.h
+ * Streaming CRC32 and MD5 calculation
+ *
+ * One pass over the data feeds every selected hash. Files are read in
+ * large blocks, the next block is read by the storage thread while the
+ * current one is being hashed.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HASHER_MD5_SIZE (16)
+
+typedef enum {
+    HasherTypeCrc32 = (1 << 0),
+    HasherTypeMd5 = (1 << 1),
+} HasherType;
+
+typedef struct Hasher Hasher;
+
+/** File progress callback
+ * @param progress percent of the file that is done
+ * @param context
+ */
+typedef void (*HasherProgressCallback)(uint8_t progress, void* context);
+
+/** Allocate a hasher
+ * @param types HasherType bitmask of hashes to calculate
+ * @return Hasher*
+ */
+Hasher* hasher_alloc(uint32_t types);
+
+/** Free a hasher
+ * @param hasher
+ */
+void hasher_free(Hasher* hasher);
+
+/** Start over with empty data
+ * @param hasher
+ */
+void hasher_reset(Hasher* hasher);
+
+/** Feed data to all selected hashes
+ * @param hasher
+ * @param data
+ * @param size
+ */
+void hasher_update(Hasher* hasher, const void* data, size_t size);
+
+/** Feed the file from the current position to the end
+ * @param hasher
+ * @param file opened file
+ * @param progress_cb optional progress callback
+ * @param context progress callback context
+ * @return true if the whole file was read
+ */
+bool hasher_update_file(
+    Hasher* hasher,
+    File* file,
+    HasherProgressCallback progress_cb,
+    void* context);
+
+/** Get the amount of data fed since the last reset
+ * @param hasher
+ * @return uint64_t size in bytes
+ */
+uint64_t hasher_get_size(Hasher* hasher);
+
+/** Get CRC32 of the data fed so far, more data can follow
+ * @param hasher with HasherTypeCrc32
+ * @return uint32_t
+ */
+uint32_t hasher_get_crc32(Hasher* hasher);
+
+/** Finish MD5 calculation, reset before feeding more data
+ * @param hasher with HasherTypeMd5
+ * @param md5 HASHER_MD5_SIZE bytes
+ */
+void hasher_get_md5(Hasher* hasher, uint8_t md5[HASHER_MD5_SIZE]);
+
+#ifdef __cplusplus
+}
+#endif
@@ -2,7 +2,7 @@
 
 #include <storage/filesystem_api_defines.h>
 #include <storage/storage.h>
-#include <mbedtls/md5.h>
+#include "hasher.h"
 
 bool md5_calc_file(File* file, const char* path, unsigned char output[16], FS_Error* file_error) {
     if(!storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
@@ -12,27 +12,10 @@ bool md5_calc_file(File* file, const char* path, unsigned char output[16], FS_Er
         return false;
     }
 
-    const size_t size_to_read = 512;
-    uint8_t* data = malloc(size_to_read);
-    bool result = true;
-
-    mbedtls_md5_context* md5_ctx = malloc(sizeof(mbedtls_md5_context));
-    mbedtls_md5_init(md5_ctx);
-    mbedtls_md5_starts(md5_ctx);
-    while(true) {
-        size_t read_size = storage_file_read(file, data, size_to_read);
-        if(storage_file_get_error(file) != FSE_OK) {
-            result = false;
-            break;
-        }
-        if(read_size == 0) {
-            break;
-        }
-        mbedtls_md5_update(md5_ctx, data, read_size);
-    }
-    mbedtls_md5_finish(md5_ctx, output);
-    free(md5_ctx);
-    free(data);
+    Hasher* hasher = hasher_alloc(HasherTypeMd5);
+    bool result = hasher_update_file(hasher, file, NULL, NULL);
+    hasher_get_md5(hasher, output);
+    hasher_free(hasher);
 
     if(file_error != NULL) {
         *file_error = storage_file_get_error(file);
@@ -21,6 +21,8 @@ static size_t buffered_file_stream_size(BufferedFileStream* stream);
 static size_t
     buffered_file_stream_write(BufferedFileStream* stream, const uint8_t* data, size_t size);
 static size_t buffered_file_stream_read(BufferedFileStream* stream, uint8_t* data, size_t size);
+static bool
+    buffered_file_stream_peek(BufferedFileStream* stream, const uint8_t** data, size_t* size);
 static bool buffered_file_stream_delete_and_insert(
     BufferedFileStream* stream,
     size_t delete_size,
@@ -40,6 +42,7 @@ const StreamVTable buffered_file_stream_vtable = {
     .write = (StreamWriteFn)buffered_file_stream_write,
     .read = (StreamReadFn)buffered_file_stream_read,
     .delete_and_insert = (StreamDeleteAndInsertFn)buffered_file_stream_delete_and_insert,
+    .peek = (StreamPeekFn)buffered_file_stream_peek,
 };
 
 Stream* buffered_file_stream_alloc(Storage* storage) {
@@ -206,6 +209,18 @@ static size_t buffered_file_stream_read(BufferedFileStream* stream, uint8_t* dat
     return size - need_to_read;
 }
 
+static bool
+    buffered_file_stream_peek(BufferedFileStream* stream, const uint8_t** data, size_t* size) {
+    if(stream->sync_pending) {
+        if(!buffered_file_stream_flush(stream)) return false;
+    }
+    if(stream_cache_at_end(stream->cache)) {
+        stream_cache_fill(stream->cache, stream->file_stream);
+    }
+    *size = stream_cache_peek(stream->cache, data);
+    return true;
+}
+
 static bool buffered_file_stream_delete_and_insert(
     BufferedFileStream* stream,
     size_t delete_size,
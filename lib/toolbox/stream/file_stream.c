@@ -2,6 +2,11 @@
 #include "stream_i.h"
 #include "file_stream.h"
 
+// RAM used to move the tail of the file in place
+#define FILE_STREAM_SHIFT_BUFFER_SIZE (512U)
+// Bigger insertions go through a scratch file
+#define FILE_STREAM_SHIFT_MAX_INSERT_SIZE (4096U)
+
 typedef struct {
     Stream stream_base;
     Storage* storage;
@@ -141,7 +146,8 @@ static size_t file_stream_read(FileStream* stream, uint8_t* data, size_t size) {
     return storage_file_read(stream->file, data, size);
 }
 
-static bool file_stream_delete_and_insert(
+// Rebuild the whole file through a scratch file
+static bool file_stream_delete_and_insert_scratch(
     FileStream* _stream,
     size_t delete_size,
     StreamWriteCB write_callback,
@@ -213,3 +219,207 @@ static bool file_stream_delete_and_insert(
 
     return result;
 }
+
+// Move size bytes from src to dst inside the file,
+// dst < src goes front to back and dst > src back to front
+static bool file_stream_move(FileStream* stream, size_t src, size_t dst, size_t size) {
+    uint8_t* buffer = malloc(FILE_STREAM_SHIFT_BUFFER_SIZE);
+    bool result = true;
+
+    size_t done = 0;
+    while(done < size) {
+        const size_t chunk = MIN(size - done, FILE_STREAM_SHIFT_BUFFER_SIZE);
+        const size_t offset = (dst < src) ? done : (size - done - chunk);
+
+        if(!storage_file_seek(stream->file, src + offset, true) ||
+           storage_file_read(stream->file, buffer, chunk) != chunk ||
+           !storage_file_seek(stream->file, dst + offset, true) ||
+           storage_file_write(stream->file, buffer, chunk) != chunk) {
+            result = false;
+            break;
+        }
+
+        done += chunk;
+    }
+
+    free(buffer);
+    return result;
+}
+
+// Extend the file by size bytes, so that moves never have to seek beyond its end
+static bool file_stream_grow(FileStream* stream, size_t file_size, size_t size) {
+    uint8_t* buffer = malloc(FILE_STREAM_SHIFT_BUFFER_SIZE);
+    memset(buffer, 0, FILE_STREAM_SHIFT_BUFFER_SIZE);
+    bool result = storage_file_seek(stream->file, file_size, true);
+
+    while(result && size) {
+        const size_t chunk = MIN(size, FILE_STREAM_SHIFT_BUFFER_SIZE);
+        result = (storage_file_write(stream->file, buffer, chunk) == chunk);
+        size -= chunk;
+    }
+
+    free(buffer);
+    return result;
+}
+
+// Write only stream that sizes an insertion, data is kept only while it fits the in-place limit
+typedef struct {
+    Stream stream_base;
+    uint8_t* data;
+    size_t size;
+} InsertionStream;
+
+static void insertion_stream_free(InsertionStream* stream) {
+    free(stream->data);
+    free(stream);
+}
+
+static bool insertion_stream_eof(InsertionStream* stream) {
+    UNUSED(stream);
+    return true;
+}
+
+static void insertion_stream_clean(InsertionStream* stream) {
+    stream->size = 0;
+}
+
+static bool
+    insertion_stream_seek(InsertionStream* stream, int32_t offset, StreamOffset offset_type) {
+    // Append only
+    switch(offset_type) {
+    case StreamOffsetFromStart:
+        return (size_t)offset == stream->size;
+    case StreamOffsetFromCurrent:
+    case StreamOffsetFromEnd:
+        return offset == 0;
+    }
+    return false;
+}
+
+static size_t insertion_stream_size(InsertionStream* stream) {
+    return stream->size;
+}
+
+static size_t insertion_stream_write(InsertionStream* stream, const uint8_t* data, size_t size) {
+    const size_t new_size = stream->size + size;
+    if(new_size <= FILE_STREAM_SHIFT_MAX_INSERT_SIZE) {
+        stream->data = realloc(stream->data, new_size); //-V701
+        memcpy(stream->data + stream->size, data, size);
+    } else if(stream->data) {
+        // Too big to be inserted in place, only count it from now on
+        free(stream->data);
+        stream->data = NULL;
+    }
+    stream->size = new_size;
+    return size;
+}
+
+static size_t insertion_stream_read(InsertionStream* stream, uint8_t* data, size_t size) {
+    UNUSED(stream);
+    UNUSED(data);
+    UNUSED(size);
+    return 0;
+}
+
+static bool insertion_stream_delete_and_insert(
+    InsertionStream* stream,
+    size_t delete_size,
+    StreamWriteCB write_callback,
+    const void* ctx) {
+    UNUSED(stream);
+    UNUSED(delete_size);
+    UNUSED(write_callback);
+    UNUSED(ctx);
+    return false;
+}
+
+static bool insertion_stream_peek(InsertionStream* stream, const uint8_t** data, size_t* size) {
+    if(stream->size > FILE_STREAM_SHIFT_MAX_INSERT_SIZE) return false;
+    *data = stream->data;
+    *size = stream->size;
+    return true;
+}
+
+static const StreamVTable insertion_stream_vtable = {
+    .free = (StreamFreeFn)insertion_stream_free,
+    .eof = (StreamEOFFn)insertion_stream_eof,
+    .clean = (StreamCleanFn)insertion_stream_clean,
+    .seek = (StreamSeekFn)insertion_stream_seek,
+    .tell = (StreamTellFn)insertion_stream_size,
+    .size = (StreamSizeFn)insertion_stream_size,
+    .write = (StreamWriteFn)insertion_stream_write,
+    .read = (StreamReadFn)insertion_stream_read,
+    .delete_and_insert = (StreamDeleteAndInsertFn)insertion_stream_delete_and_insert,
+    .peek = (StreamPeekFn)insertion_stream_peek,
+};
+
+static Stream* insertion_stream_alloc() {
+    InsertionStream* stream = malloc(sizeof(InsertionStream));
+    stream->data = NULL;
+    stream->size = 0;
+    stream->stream_base.vtable = &insertion_stream_vtable;
+    return (Stream*)stream;
+}
+
+static bool file_stream_write_insertion(Stream* stream, const void* ctx) {
+    Stream* insertion = (Stream*)ctx;
+    const uint8_t* data;
+    size_t size;
+    if(!stream_rewind(insertion) || !stream_peek(insertion, &data, &size)) return false;
+    return stream_write(stream, data, size) == size;
+}
+
+static bool file_stream_delete_and_insert(
+    FileStream* _stream,
+    size_t delete_size,
+    StreamWriteCB write_callback,
+    const void* ctx) {
+    bool result = false;
+    Stream* stream = (Stream*)_stream;
+
+    // the size of the insertion is only known once it is written, so size it first
+    Stream* insertion = insertion_stream_alloc();
+
+    do {
+        if(write_callback) {
+            if(!write_callback(insertion, ctx)) break;
+        }
+
+        const size_t insert_size = stream_size(insertion);
+        if(insert_size > FILE_STREAM_SHIFT_MAX_INSERT_SIZE) {
+            // not kept in RAM, render it again straight into the scratch file
+            result = file_stream_delete_and_insert_scratch(
+                _stream, delete_size, write_callback, ctx);
+            break;
+        }
+
+        const size_t current_position = stream_tell(stream);
+        const size_t file_size = stream_size(stream);
+
+        const size_t size_to_delete = MIN(delete_size, file_size - current_position);
+        const size_t tail_position = current_position + size_to_delete;
+        const size_t tail_size = file_size - tail_position;
+        const size_t new_tail_position = current_position + insert_size;
+
+        if(insert_size > size_to_delete) {
+            // growing: make room at the end and move the tail from its end
+            if(!file_stream_grow(_stream, file_size, insert_size - size_to_delete)) break;
+            if(!file_stream_move(_stream, tail_position, new_tail_position, tail_size)) break;
+        } else if(insert_size < size_to_delete) {
+            // shrinking: move the tail from its start and cut the end
+            if(!file_stream_move(_stream, tail_position, new_tail_position, tail_size)) break;
+            if(!storage_file_seek(_stream->file, new_tail_position + tail_size, true)) break;
+            if(!storage_file_truncate(_stream->file)) break;
+        }
+
+        // same size or the tail is already in place, just overwrite
+        if(!stream_seek(stream, current_position, StreamOffsetFromStart)) break;
+        if(!file_stream_write_insertion(stream, insertion)) break;
+
+        result = true;
+    } while(false);
+
+    stream_free(insertion);
+
+    return result;
+}
@@ -122,6 +122,12 @@ size_t stream_read(Stream* stream, uint8_t* data, size_t size) {
     return stream->vtable->read(stream, data, size);
 }
 
+bool stream_peek(Stream* stream, const uint8_t** data, size_t* size) {
+    furi_assert(stream);
+    if(!stream->vtable->peek) return false;
+    return stream->vtable->peek(stream, data, size);
+}
+
 bool stream_delete_and_insert(
     Stream* stream,
     size_t delete_size,
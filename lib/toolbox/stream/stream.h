@@ -95,6 +95,18 @@ size_t stream_write(Stream* stream, const uint8_t* data, size_t size);
  */
 size_t stream_read(Stream* stream, uint8_t* data, size_t count);
 
+/**
+ * Get direct read access to the data following the RW pointer, without copying it.
+ * The RW pointer is not moved, use stream_seek to consume the data.
+ * The window stays valid until the next operation on the stream.
+ * @param stream Stream instance
+ * @param data pointer to the beginning of the window
+ * @param size window size, 0 at the end of the stream
+ * @return true on success
+ * @return false if the stream does not provide direct access, use stream_read instead
+ */
+bool stream_peek(Stream* stream, const uint8_t** data, size_t* size);
+
 /**
  * Delete N chars from the stream and write data by calling write_callback(context)
  * @param stream Stream instance
@@ -64,6 +64,12 @@ size_t stream_cache_read(StreamCache* cache, uint8_t* data, size_t size) {
     return size_read;
 }
 
+size_t stream_cache_peek(StreamCache* cache, const uint8_t** data) {
+    furi_assert(cache->data_size >= cache->position);
+    *data = cache->data + cache->position;
+    return cache->data_size - cache->position;
+}
+
 size_t stream_cache_write(StreamCache* cache, const uint8_t* data, size_t size) {
     furi_assert(cache->data_size >= cache->position);
     const size_t size_written = MIN(size, STREAM_CACHE_MAX_SIZE - cache->position);
@@ -72,6 +72,14 @@ bool stream_cache_flush(StreamCache* cache, Stream* stream);
  */
 size_t stream_cache_read(StreamCache* cache, uint8_t* data, size_t size);
 
+/**
+ * Get direct access to cached data after the internal cursor, without advancing it.
+ * @param cache Pointer to a StreamCache instance.
+ * @param data Pointer to the cached data after the cursor.
+ * @return Size of cached data after the cursor.
+ */
+size_t stream_cache_peek(StreamCache* cache, const uint8_t** data);
+
 /**
  * Write to cached data and advance the internal cursor.
  * @param cache Pointer to a StreamCache instance.
@@ -19,6 +19,7 @@ typedef size_t (*StreamTellFn)(Stream* stream);
 typedef size_t (*StreamSizeFn)(Stream* stream);
 typedef size_t (*StreamWriteFn)(Stream* stream, const uint8_t* data, size_t size);
 typedef size_t (*StreamReadFn)(Stream* stream, uint8_t* data, size_t count);
+typedef bool (*StreamPeekFn)(Stream* stream, const uint8_t** data, size_t* size);
 typedef bool (*StreamDeleteAndInsertFn)(
     Stream* stream,
     size_t delete_size,
@@ -35,6 +36,8 @@ struct StreamVTable {
     const StreamWriteFn write;
     const StreamReadFn read;
     const StreamDeleteAndInsertFn delete_and_insert;
+    // Optional, may be NULL
+    const StreamPeekFn peek;
 };
 
 struct Stream {
@@ -4,6 +4,7 @@
 #include <storage/storage.h>
 #include <furi.h>
 #include <toolbox/path.h>
+#include <toolbox/compress.h>
 
 #define TAG "TarArch"
 #define MAX_NAME_LEN 255
@@ -14,31 +15,58 @@
 
 typedef struct TarArchive {
     Storage* storage;
+    File* stream;
     mtar_t tar;
+    TarOpenMode mode;
     tar_unpack_file_cb unpack_cb;
     void* unpack_cb_context;
+    size_t buffer_size;
+
+    /* Heatshrink compressed archive */
+    CompressStreamEncoder* encoder;
+    CompressStreamDecoder* decoder;
+    /* Window of decoded data, microtar re-reads headers after seeking back */
+    uint8_t* read_buffer;
+    size_t read_buffer_start;
+    size_t read_buffer_len;
+    size_t read_position;
 } TarArchive;
 
 /* API WRAPPER */
 static int mtar_storage_file_write(void* stream, const void* data, unsigned size) {
-    uint16_t bytes_written = storage_file_write(stream, data, size);
-    return (bytes_written == size) ? bytes_written : MTAR_EWRITEFAIL;
+    TarArchive* archive = stream;
+    size_t bytes_written = storage_file_write(archive->stream, data, size);
+    return (bytes_written == size) ? (int)bytes_written : MTAR_EWRITEFAIL;
 }
 
 static int mtar_storage_file_read(void* stream, void* data, unsigned size) {
-    uint16_t bytes_read = storage_file_read(stream, data, size);
-    return (bytes_read == size) ? bytes_read : MTAR_EREADFAIL;
+    TarArchive* archive = stream;
+    size_t bytes_read = storage_file_read(archive->stream, data, size);
+    return (bytes_read == size) ? (int)bytes_read : MTAR_EREADFAIL;
 }
 
 static int mtar_storage_file_seek(void* stream, unsigned offset) {
-    bool res = storage_file_seek(stream, offset, true);
+    TarArchive* archive = stream;
+    bool res = storage_file_seek(archive->stream, offset, true);
     return res ? MTAR_ESUCCESS : MTAR_ESEEKFAIL;
 }
 
 static int mtar_storage_file_close(void* stream) {
-    if(stream) {
-        storage_file_close(stream);
-        storage_file_free(stream);
+    TarArchive* archive = stream;
+    if(archive->encoder) {
+        compress_stream_encoder_free(archive->encoder);
+        archive->encoder = NULL;
+    }
+    if(archive->decoder) {
+        compress_stream_decoder_free(archive->decoder);
+        archive->decoder = NULL;
+        free(archive->read_buffer);
+        archive->read_buffer = NULL;
+    }
+    if(archive->stream) {
+        storage_file_close(archive->stream);
+        storage_file_free(archive->stream);
+        archive->stream = NULL;
     }
     return MTAR_ESUCCESS;
 }
@@ -50,14 +78,112 @@ const struct mtar_ops filesystem_ops = {
     .close = mtar_storage_file_close,
 };
 
+static int32_t tar_archive_heatshrink_file_read(void* context, uint8_t* buffer, size_t size) {
+    TarArchive* archive = context;
+    size_t bytes_read = storage_file_read(archive->stream, buffer, size);
+    return (storage_file_get_error(archive->stream) == FSE_OK) ? (int32_t)bytes_read : -1;
+}
+
+static int32_t tar_archive_heatshrink_file_write(void* context, uint8_t* buffer, size_t size) {
+    TarArchive* archive = context;
+    size_t bytes_written = storage_file_write(archive->stream, buffer, size);
+    return (bytes_written == size) ? (int32_t)bytes_written : -1;
+}
+
+static int mtar_heatshrink_write(void* stream, const void* data, unsigned size) {
+    TarArchive* archive = stream;
+    return compress_stream_encoder_write(archive->encoder, data, size) ? (int)size :
+                                                                          MTAR_EWRITEFAIL;
+}
+
+/* Advance the decoded window, keeping the last tar block */
+static bool tar_archive_heatshrink_fill(TarArchive* archive) {
+    const size_t keep = MIN(archive->read_buffer_len, (size_t)FILE_BLOCK_SIZE);
+    memmove(
+        archive->read_buffer, &archive->read_buffer[archive->read_buffer_len - keep], keep);
+    archive->read_buffer_start += archive->read_buffer_len - keep;
+    archive->read_buffer_len = keep;
+
+    int32_t bytes_read = compress_stream_decoder_read(
+        archive->decoder, &archive->read_buffer[keep], archive->buffer_size - keep);
+    if(bytes_read <= 0) {
+        return false;
+    }
+    archive->read_buffer_len += bytes_read;
+    return true;
+}
+
+static int mtar_heatshrink_read(void* stream, void* data, unsigned size) {
+    TarArchive* archive = stream;
+    uint8_t* out = data;
+    size_t done = 0;
+
+    while(done < size) {
+        if(archive->read_position >= archive->read_buffer_start + archive->read_buffer_len) {
+            if(!tar_archive_heatshrink_fill(archive)) {
+                return MTAR_EREADFAIL;
+            }
+            continue;
+        }
+        const size_t offset = archive->read_position - archive->read_buffer_start;
+        const size_t chunk = MIN(size - done, archive->read_buffer_len - offset);
+        memcpy(&out[done], &archive->read_buffer[offset], chunk);
+        archive->read_position += chunk;
+        done += chunk;
+    }
+
+    return size;
+}
+
+static int mtar_heatshrink_seek(void* stream, unsigned offset) {
+    TarArchive* archive = stream;
+    if(!archive->decoder) {
+        return MTAR_ESEEKFAIL;
+    }
+
+    /* Behind the window: decode again from the start. Forward seeks are done by reads */
+    if(offset < archive->read_buffer_start) {
+        if(!storage_file_seek(archive->stream, 0, true)) {
+            return MTAR_ESEEKFAIL;
+        }
+        compress_stream_decoder_reset(archive->decoder);
+        archive->read_buffer_start = 0;
+        archive->read_buffer_len = 0;
+    }
+    archive->read_position = offset;
+    return MTAR_ESUCCESS;
+}
+
+static const struct mtar_ops heatshrink_ops = {
+    .read = mtar_heatshrink_read,
+    .write = mtar_heatshrink_write,
+    .seek = mtar_heatshrink_seek,
+    .close = mtar_storage_file_close,
+};
+
 TarArchive* tar_archive_alloc(Storage* storage) {
     furi_check(storage);
     TarArchive* archive = malloc(sizeof(TarArchive));
     archive->storage = storage;
     archive->unpack_cb = NULL;
+    archive->buffer_size = TAR_ARCHIVE_DEFAULT_BUFFER_SIZE;
     return archive;
 }
 
+void tar_archive_set_buffer_size(TarArchive* archive, size_t buffer_size) {
+    furi_assert(archive);
+    furi_check(!archive->stream);
+    furi_check(buffer_size >= FILE_BLOCK_SIZE * 2);
+    archive->buffer_size = buffer_size;
+}
+
+static bool tar_archive_is_heatshrink(File* stream) {
+    uint32_t magic = 0;
+    bool is_heatshrink = (storage_file_read(stream, &magic, sizeof(magic)) == sizeof(magic)) &&
+                         (magic == COMPRESS_STREAM_MAGIC);
+    return storage_file_seek(stream, 0, true) && is_heatshrink;
+}
+
 bool tar_archive_open(TarArchive* archive, const char* path, TarOpenMode mode) {
     furi_assert(archive);
     FS_AccessMode access_mode;
@@ -71,6 +197,7 @@ bool tar_archive_open(TarArchive* archive, const char* path, TarOpenMode mode) {
         open_mode = FSOM_OPEN_EXISTING;
         break;
     case TAR_OPEN_MODE_WRITE:
+    case TAR_OPEN_MODE_WRITE_HEATSHRINK:
         mtar_access = MTAR_WRITE;
         access_mode = FSAM_WRITE;
         open_mode = FSOM_CREATE_ALWAYS;
@@ -84,11 +211,38 @@ bool tar_archive_open(TarArchive* archive, const char* path, TarOpenMode mode) {
         storage_file_free(stream);
         return false;
     }
-    mtar_init(&archive->tar, mtar_access, &filesystem_ops, stream);
+    archive->stream = stream;
+    archive->mode = mode;
+
+    const struct mtar_ops* ops = &filesystem_ops;
+    if(mode == TAR_OPEN_MODE_WRITE_HEATSHRINK) {
+        archive->encoder = compress_stream_encoder_alloc(
+            tar_archive_heatshrink_file_write, archive, archive->buffer_size);
+        ops = &heatshrink_ops;
+    } else if(mode == TAR_OPEN_MODE_READ && tar_archive_is_heatshrink(stream)) {
+        archive->decoder = compress_stream_decoder_alloc(
+            tar_archive_heatshrink_file_read, archive, archive->buffer_size);
+        archive->read_buffer = malloc(archive->buffer_size);
+        archive->read_buffer_start = 0;
+        archive->read_buffer_len = 0;
+        archive->read_position = 0;
+        ops = &heatshrink_ops;
+    }
+    mtar_init(&archive->tar, mtar_access, ops, archive);
 
     return true;
 }
 
+TarOpenMode tar_archive_get_mode_for_path(const char* path) {
+    furi_assert(path);
+    const size_t path_len = strlen(path);
+    const size_t ext_len = strlen(TAR_HEATSHRINK_EXTENSION);
+    if((path_len > ext_len) && !strcmp(&path[path_len - ext_len], TAR_HEATSHRINK_EXTENSION)) {
+        return TAR_OPEN_MODE_WRITE_HEATSHRINK;
+    }
+    return TAR_OPEN_MODE_WRITE;
+}
+
 void tar_archive_free(TarArchive* archive) {
     furi_assert(archive);
     if(mtar_is_open(&archive->tar)) {
@@ -97,6 +251,20 @@ void tar_archive_free(TarArchive* archive) {
     free(archive);
 }
 
+bool tar_archive_get_read_progress(TarArchive* archive, uint32_t* processed, uint32_t* total) {
+    furi_assert(archive);
+    furi_assert(processed);
+    furi_assert(total);
+
+    if(!archive->stream || (archive->mode != TAR_OPEN_MODE_READ)) {
+        return false;
+    }
+
+    *processed = storage_file_tell(archive->stream);
+    *total = storage_file_size(archive->stream);
+    return true;
+}
+
 void tar_archive_set_file_callback(TarArchive* archive, tar_unpack_file_cb callback, void* context) {
     furi_assert(archive);
     archive->unpack_cb = callback;
@@ -127,7 +295,8 @@ bool tar_archive_dir_add_element(TarArchive* archive, const char* dirpath) {
 
 bool tar_archive_finalize(TarArchive* archive) {
     furi_assert(archive);
-    return (mtar_finalize(&archive->tar) == MTAR_ESUCCESS);
+    return (mtar_finalize(&archive->tar) == MTAR_ESUCCESS) &&
+           (!archive->encoder || compress_stream_encoder_finish(archive->encoder));
 }
 
 bool tar_archive_store_data(
@@ -172,7 +341,7 @@ typedef struct {
 static bool archive_extract_current_file(TarArchive* archive, const char* dst_path) {
     mtar_t* tar = &archive->tar;
     File* out_file = storage_file_alloc(archive->storage);
-    uint8_t* readbuf = malloc(FILE_BLOCK_SIZE);
+    uint8_t* readbuf = malloc(archive->buffer_size);
 
     bool success = true;
     uint8_t n_tries = FILE_OPEN_NTRIES;
@@ -192,8 +361,9 @@ static bool archive_extract_current_file(TarArchive* archive, const char* dst_pa
         }
 
         while(!mtar_eof_data(tar)) {
-            int32_t readcnt = mtar_read_data(tar, readbuf, FILE_BLOCK_SIZE);
-            if(!readcnt || !storage_file_write(out_file, readbuf, readcnt)) {
+            int32_t readcnt = mtar_read_data(tar, readbuf, archive->buffer_size);
+            if((readcnt <= 0) ||
+               (storage_file_write(out_file, readbuf, readcnt) != (size_t)readcnt)) {
                 success = false;
                 break;
             }
@@ -217,7 +387,7 @@ static int archive_extract_foreach_cb(mtar_t* tar, const mtar_header_t* header,
     }
 
     if(skip_entry) {
-        FURI_LOG_W(TAG, "filter: skipping entry \"%s\"", header->name);
+        FURI_LOG_D(TAG, "filter: skipping entry \"%s\"", header->name);
         return 0;
     }
 
@@ -277,7 +447,7 @@ bool tar_archive_add_file(
     const char* archive_fname,
     const int32_t file_size) {
     furi_assert(archive);
-    uint8_t* file_buffer = malloc(FILE_BLOCK_SIZE);
+    uint8_t* file_buffer = malloc(archive->buffer_size);
     bool success = false;
     File* src_file = storage_file_alloc(archive->storage);
     uint8_t n_tries = FILE_OPEN_NTRIES;
@@ -297,8 +467,8 @@ bool tar_archive_add_file(
         }
 
         success = true; // if file is empty, that's not an error
-        uint16_t bytes_read = 0;
-        while((bytes_read = storage_file_read(src_file, file_buffer, FILE_BLOCK_SIZE))) {
+        size_t bytes_read = 0;
+        while((bytes_read = storage_file_read(src_file, file_buffer, archive->buffer_size))) {
             success = tar_archive_file_add_data_block(archive, file_buffer, bytes_read);
             if(!success) {
                 break;
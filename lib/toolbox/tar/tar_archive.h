@@ -8,22 +8,37 @@
 extern "C" {
 #endif
 
+#define TAR_ARCHIVE_DEFAULT_BUFFER_SIZE (4096U)
+
+/* Heatshrink compressed archives, see toolbox/compress.h */
+#define TAR_HEATSHRINK_EXTENSION ".hs"
+
 typedef struct TarArchive TarArchive;
 
 typedef struct Storage Storage;
 
 typedef enum {
-    TAR_OPEN_MODE_READ = 'r',
+    TAR_OPEN_MODE_READ = 'r', /* plain or heatshrink compressed, detected by header */
     TAR_OPEN_MODE_WRITE = 'w',
+    TAR_OPEN_MODE_WRITE_HEATSHRINK = 'h',
     TAR_OPEN_MODE_STDOUT = 's' /* to be implemented */
 } TarOpenMode;
 
 TarArchive* tar_archive_alloc(Storage* storage);
 
+/* Size of data buffers used for unpacking and packing files, set before opening */
+void tar_archive_set_buffer_size(TarArchive* archive, size_t buffer_size);
+
 bool tar_archive_open(TarArchive* archive, const char* path, TarOpenMode mode);
 
+/* Write mode matching the file name: compressed for TAR_HEATSHRINK_EXTENSION */
+TarOpenMode tar_archive_get_mode_for_path(const char* path);
+
 void tar_archive_free(TarArchive* archive);
 
+/* Position in the archive file, for progress reporting without a counting pass */
+bool tar_archive_get_read_progress(TarArchive* archive, uint32_t* processed, uint32_t* total);
+
 /* High-level API  - assumes archive is open */
 bool tar_archive_unpack_to(
     TarArchive* archive,
@@ -38,6 +53,7 @@ bool tar_archive_add_file(
 
 bool tar_archive_add_dir(TarArchive* archive, const char* fs_full_path, const char* path_prefix);
 
+/* Makes a full pass over the archive, prefer tar_archive_get_read_progress for progress */
 int32_t tar_archive_get_entries_count(TarArchive* archive);
 
 bool tar_archive_unpack_file(
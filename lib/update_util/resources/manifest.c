@@ -2,6 +2,9 @@
 
 #include <toolbox/stream/buffered_file_stream.h>
 #include <toolbox/hex.h>
+#include <toolbox/path.h>
+
+#include <stdlib.h>
 
 struct ResourceManifestReader {
     Storage* storage;
@@ -161,3 +164,230 @@ ResourceManifestEntry*
         return NULL;
     }
 }
+
+uint8_t resource_manifest_reader_get_progress(ResourceManifestReader* resource_manifest) {
+    furi_assert(resource_manifest);
+
+    const size_t size = stream_size(resource_manifest->stream);
+    return size ? (stream_tell(resource_manifest->stream) * 100 / size) : 100;
+}
+
+typedef enum {
+    ResourceManifestDiffFlagDirectory = (1 << 0),
+    ResourceManifestDiffFlagPresent = (1 << 1), /**< also in the new manifest */
+    ResourceManifestDiffFlagUnchanged = (1 << 2),
+} ResourceManifestDiffFlag;
+
+typedef struct {
+    uint64_t name_hash;
+    uint32_t size;
+    uint8_t hash[16];
+    uint8_t flags;
+} ResourceManifestDiffEntry;
+
+struct ResourceManifestDiff {
+    ResourceManifestDiffEntry* entries;
+    size_t count;
+    size_t unchanged_count;
+};
+
+#define RESOURCE_MANIFEST_DIFF_INITIAL_CAPACITY (256U)
+
+/* 64-bit FNV-1a, names are not kept, so collisions must be practically impossible */
+static uint64_t resource_manifest_diff_name_hash(const char* name) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    while(*name) {
+        hash ^= (uint8_t)*name++;
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+static bool resource_manifest_diff_content_equal(
+    const ResourceManifestDiffEntry* diff_entry,
+    const ResourceManifestEntry* entry) {
+    return (diff_entry->size == entry->size) &&
+           (memcmp(diff_entry->hash, entry->hash, sizeof(diff_entry->hash)) == 0);
+}
+
+static int resource_manifest_diff_entry_cmp(const void* a, const void* b) {
+    const ResourceManifestDiffEntry* entry_a = a;
+    const ResourceManifestDiffEntry* entry_b = b;
+    if(entry_a->name_hash == entry_b->name_hash) return 0;
+    return (entry_a->name_hash < entry_b->name_hash) ? -1 : 1;
+}
+
+/* Find all entries with the same name hash, returns count */
+static size_t resource_manifest_diff_find(
+    ResourceManifestDiff* diff,
+    uint64_t name_hash,
+    ResourceManifestDiffEntry** first) {
+    ResourceManifestDiffEntry key = {.name_hash = name_hash};
+    ResourceManifestDiffEntry* found = bsearch(
+        &key,
+        diff->entries,
+        diff->count,
+        sizeof(ResourceManifestDiffEntry),
+        resource_manifest_diff_entry_cmp);
+    if(!found) return 0;
+
+    ResourceManifestDiffEntry* last = found;
+    while(found > diff->entries && (found - 1)->name_hash == name_hash) found--;
+    while(last < diff->entries + diff->count - 1 && (last + 1)->name_hash == name_hash) last++;
+
+    *first = found;
+    return last - found + 1;
+}
+
+static bool resource_manifest_diff_is_installed(
+    Storage* storage,
+    const char* base_path,
+    const ResourceManifestEntry* entry,
+    FuriString* path) {
+    FileInfo file_info;
+    path_concat(base_path, furi_string_get_cstr(entry->name), path);
+    return (storage_common_stat(storage, furi_string_get_cstr(path), &file_info) == FSE_OK) &&
+           !file_info_is_dir(&file_info) && (file_info.size == entry->size);
+}
+
+ResourceManifestDiff* resource_manifest_diff_alloc(
+    Storage* storage,
+    const char* old_manifest,
+    const char* new_manifest,
+    const char* base_path) {
+    furi_assert(storage);
+    furi_assert(old_manifest);
+    furi_assert(new_manifest);
+    furi_assert(base_path);
+
+    ResourceManifestDiff* diff = malloc(sizeof(ResourceManifestDiff));
+    ResourceManifestReader* reader = resource_manifest_reader_alloc(storage);
+    FuriString* path = furi_string_alloc();
+    size_t capacity = RESOURCE_MANIFEST_DIFF_INITIAL_CAPACITY;
+    diff->entries = malloc(capacity * sizeof(ResourceManifestDiffEntry));
+    bool success = false;
+
+    do {
+        /* Installed entries, sorted for lookup */
+        if(!resource_manifest_reader_open(reader, old_manifest)) break;
+
+        ResourceManifestEntry* entry;
+        while((entry = resource_manifest_reader_next(reader))) {
+            if(entry->type != ResourceManifestEntryTypeFile &&
+               entry->type != ResourceManifestEntryTypeDirectory) {
+                continue;
+            }
+            if(diff->count == capacity) {
+                capacity *= 2;
+                diff->entries =
+                    realloc(diff->entries, capacity * sizeof(ResourceManifestDiffEntry)); //-V701
+            }
+            ResourceManifestDiffEntry* diff_entry = &diff->entries[diff->count++];
+            diff_entry->name_hash =
+                resource_manifest_diff_name_hash(furi_string_get_cstr(entry->name));
+            diff_entry->size = entry->size;
+            memcpy(diff_entry->hash, entry->hash, sizeof(diff_entry->hash));
+            diff_entry->flags = (entry->type == ResourceManifestEntryTypeFile) ?
+                                    0 :
+                                    ResourceManifestDiffFlagDirectory;
+        }
+        qsort(
+            diff->entries,
+            diff->count,
+            sizeof(ResourceManifestDiffEntry),
+            resource_manifest_diff_entry_cmp);
+
+        /* Mark entries that stay */
+        buffered_file_stream_close(reader->stream);
+        if(!resource_manifest_reader_open(reader, new_manifest)) break;
+
+        while((entry = resource_manifest_reader_next(reader))) {
+            const bool is_file = (entry->type == ResourceManifestEntryTypeFile);
+            if(!is_file && entry->type != ResourceManifestEntryTypeDirectory) {
+                continue;
+            }
+
+            ResourceManifestDiffEntry* first = NULL;
+            const size_t found = resource_manifest_diff_find(
+                diff, resource_manifest_diff_name_hash(furi_string_get_cstr(entry->name)), &first);
+
+            for(size_t i = 0; i < found; i++) {
+                ResourceManifestDiffEntry* diff_entry = &first[i];
+                const bool is_directory = diff_entry->flags & ResourceManifestDiffFlagDirectory;
+                if(is_directory == is_file) {
+                    continue;
+                }
+
+                /* Duplicate name: keep entry, but always install it */
+                if((diff_entry->flags & ResourceManifestDiffFlagPresent) || (found > 1)) {
+                    if(diff_entry->flags & ResourceManifestDiffFlagUnchanged) {
+                        diff->unchanged_count--;
+                    }
+                    diff_entry->flags &= ~ResourceManifestDiffFlagUnchanged;
+                    diff_entry->flags |= ResourceManifestDiffFlagPresent;
+                    continue;
+                }
+
+                diff_entry->flags |= ResourceManifestDiffFlagPresent;
+                if(is_file && resource_manifest_diff_content_equal(diff_entry, entry) &&
+                   resource_manifest_diff_is_installed(storage, base_path, entry, path)) {
+                    diff_entry->flags |= ResourceManifestDiffFlagUnchanged;
+                    diff->unchanged_count++;
+                }
+            }
+        }
+
+        success = true;
+    } while(false);
+
+    furi_string_free(path);
+    resource_manifest_reader_free(reader);
+
+    if(!success) {
+        resource_manifest_diff_free(diff);
+        diff = NULL;
+    }
+
+    return diff;
+}
+
+void resource_manifest_diff_free(ResourceManifestDiff* diff) {
+    furi_assert(diff);
+    free(diff->entries);
+    free(diff);
+}
+
+bool resource_manifest_diff_is_removed(
+    ResourceManifestDiff* diff,
+    const ResourceManifestEntry* entry) {
+    furi_assert(diff);
+    furi_assert(entry);
+
+    ResourceManifestDiffEntry* first = NULL;
+    const size_t found = resource_manifest_diff_find(
+        diff, resource_manifest_diff_name_hash(furi_string_get_cstr(entry->name)), &first);
+
+    for(size_t i = 0; i < found; i++) {
+        if(!(first[i].flags & ResourceManifestDiffFlagPresent)) {
+            return true;
+        }
+    }
+
+    return !found;
+}
+
+bool resource_manifest_diff_is_unchanged(ResourceManifestDiff* diff, const char* name) {
+    furi_assert(diff);
+    furi_assert(name);
+
+    ResourceManifestDiffEntry* first = NULL;
+    const size_t found =
+        resource_manifest_diff_find(diff, resource_manifest_diff_name_hash(name), &first);
+
+    return (found == 1) && (first->flags & ResourceManifestDiffFlagUnchanged);
+}
+
+size_t resource_manifest_diff_get_unchanged_count(ResourceManifestDiff* diff) {
+    furi_assert(diff);
+    return diff->unchanged_count;
+}
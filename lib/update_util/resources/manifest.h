@@ -66,6 +66,69 @@ ResourceManifestEntry* resource_manifest_reader_next(ResourceManifestReader* res
 ResourceManifestEntry*
     resource_manifest_reader_previous(ResourceManifestReader* resource_manifest);
 
+/** Get read position in the manifest
+ *
+ * @param      resource_manifest  Pointer to the ResourceManifestReader instance
+ *
+ * @return     percent of the manifest read
+ */
+uint8_t resource_manifest_reader_get_progress(ResourceManifestReader* resource_manifest);
+
+typedef struct ResourceManifestDiff ResourceManifestDiff;
+
+/** Compare installed resources with a new manifest
+ *
+ * Entries are matched by 64-bit hash of their name, files by their full
+ * hash and size. An installed file is unchanged only if it still exists
+ * with the size from the manifest.
+ *
+ * @param      storage       Storage API pointer
+ * @param      old_manifest  manifest of installed resources
+ * @param      new_manifest  manifest of resources to be installed
+ * @param      base_path     directory resources are installed to
+ *
+ * @return     allocated object or NULL if any manifest can't be read
+ */
+ResourceManifestDiff* resource_manifest_diff_alloc(
+    Storage* storage,
+    const char* old_manifest,
+    const char* new_manifest,
+    const char* base_path);
+
+/** Release resource manifest diff
+ *
+ * @param      diff  allocated object
+ */
+void resource_manifest_diff_free(ResourceManifestDiff* diff);
+
+/** Check if installed entry is not in the new manifest
+ *
+ * @param      diff   allocated object
+ * @param      entry  entry of the old manifest
+ *
+ * @return     true if the entry must be removed
+ */
+bool resource_manifest_diff_is_removed(
+    ResourceManifestDiff* diff,
+    const ResourceManifestEntry* entry);
+
+/** Check if installed file matches the new manifest
+ *
+ * @param      diff  allocated object
+ * @param      name  file name relative to base path
+ *
+ * @return     true if the file doesn't need to be installed again
+ */
+bool resource_manifest_diff_is_unchanged(ResourceManifestDiff* diff, const char* name);
+
+/** Get number of unchanged files
+ *
+ * @param      diff  allocated object
+ *
+ * @return     file count
+ */
+size_t resource_manifest_diff_get_unchanged_count(ResourceManifestDiff* diff);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
\ No newline at end of file
@@ -1,8 +1,10 @@
 #!/usr/bin/env python3
 
+import io
 import math
 import os
 import shutil
+import struct
 import tarfile
 import zlib
 from os.path import exists, join
@@ -24,6 +26,13 @@ class Main(App):
     RESOURCE_FILE_NAME = "resources.tar"
     RESOURCE_ENTRY_NAME_MAX_LENGTH = 100
 
+    # Heatshrink stream, see lib/toolbox/compress.h
+    HEATSHRINK_EXTENSION = ".hs"
+    HEATSHRINK_STREAM_MAGIC = 0x53445348
+    HEATSHRINK_STREAM_VERSION = 1
+    HEATSHRINK_WINDOW_SZ2 = 12
+    HEATSHRINK_LOOKAHEAD_SZ2 = 5
+
     WHITELISTED_STACK_TYPES = set(
         map(
             get_stack_type,
@@ -52,6 +61,13 @@ class Main(App):
             "--dfu", dest="dfu", default="", required=False
         )
         self.parser_generate.add_argument("-r", dest="resources", required=False)
+        self.parser_generate.add_argument(
+            "--compress-resources",
+            dest="compress_resources",
+            action="store_true",
+            default=False,
+            help="Pack resources as heatshrink compressed tar",
+        )
         self.parser_generate.add_argument("--stage", dest="stage", required=True)
         self.parser_generate.add_argument(
             "--radio", dest="radiobin", default="", required=False
@@ -135,8 +151,12 @@ class Main(App):
             )
         if self.args.resources:
             resources_basename = self.RESOURCE_FILE_NAME
+            if self.args.compress_resources:
+                resources_basename += self.HEATSHRINK_EXTENSION
             if not self.package_resources(
-                self.args.resources, join(self.args.directory, resources_basename)
+                self.args.resources,
+                join(self.args.directory, resources_basename),
+                self.args.compress_resources,
             ):
                 return 3
 
@@ -226,21 +246,46 @@ class Main(App):
         tarinfo.uname = tarinfo.gname = "furippa"
         return tarinfo
 
-    def package_resources(self, srcdir: str, dst_name: str):
+    def package_resources(self, srcdir: str, dst_name: str, compress: bool = False):
         try:
+            tar_buffer = io.BytesIO()
             with tarfile.open(
-                dst_name, self.RESOURCE_TAR_MODE, format=self.RESOURCE_TAR_FORMAT
+                fileobj=tar_buffer,
+                mode=self.RESOURCE_TAR_MODE,
+                format=self.RESOURCE_TAR_FORMAT,
             ) as tarball:
                 tarball.add(
                     srcdir,
                     arcname="",
                     filter=self._tar_filter,
                 )
+            data = tar_buffer.getvalue()
+            if compress:
+                data = self.heatshrink_stream(data)
+            with open(dst_name, "wb") as f:
+                f.write(data)
             return True
-        except ValueError as e:
+        except (ValueError, ImportError) as e:
             self.logger.error(f"Cannot package resources: {e}")
             return False
 
+    def heatshrink_stream(self, data: bytes):
+        import heatshrink2
+
+        header = struct.pack(
+            "<IBBBB",
+            self.HEATSHRINK_STREAM_MAGIC,
+            self.HEATSHRINK_STREAM_VERSION,
+            self.HEATSHRINK_WINDOW_SZ2,
+            self.HEATSHRINK_LOOKAHEAD_SZ2,
+            0,
+        )
+        return header + heatshrink2.compress(
+            data,
+            window_sz2=self.HEATSHRINK_WINDOW_SZ2,
+            lookahead_sz2=self.HEATSHRINK_LOOKAHEAD_SZ2,
+        )
+
     @staticmethod
     def copro_version_as_int(coprometa, stacktype):
         major = coprometa.img_sig.version_major